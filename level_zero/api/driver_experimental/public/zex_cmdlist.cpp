@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,4 +67,42 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendEventsReset(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numEvents,
+    zex_event_handle_t *phEvents) {
+    if (!hCommandList || numEvents == 0 || !phEvents) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (!phEvents[i]) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->appendEventsReset(numEvents, phEvents);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    zex_command_list_handle_t hCommandList) {
+    if (!hCommandList) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->beginGraphCapture();
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    zex_command_list_handle_t hCommandList,
+    ze_command_list_handle_t *phGraph) {
+    if (!hCommandList || !phGraph) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->endGraphCapture(phGraph);
+}
 } // namespace L0
@@ -54,6 +54,16 @@ typedef struct _zex_write_to_mem_desc_t {
     zex_mem_action_scope_flags_t writeScope;
 } zex_write_to_mem_desc_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Usm allocation cache statistics
+typedef struct _zex_usm_allocation_cache_stats_t {
+    uint64_t hits;      ///< [out] number of allocations served from the cache
+    uint64_t misses;    ///< [out] number of allocations not found in the cache
+    uint64_t evictions; ///< [out] number of cached allocations released by trimming
+    uint64_t bytesHeld; ///< [out] total size of allocations currently held in the cache
+    uint64_t maxSize;   ///< [out] size limit of the cache
+} zex_usm_allocation_cache_stats_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef ZE_SYNCHRONIZED_DISPATCH_EXP_NAME
 /// @brief Synchronized Dispatch extension name
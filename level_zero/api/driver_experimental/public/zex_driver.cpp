@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/driver/driver.h"
@@ -41,6 +42,26 @@ zexDriverGetHostPointerBaseAddress(
     return L0::DriverHandle::fromHandle(hDriver)->getHostPointerBaseAddress(ptr, baseAddress);
 }
 
+ze_result_t ZE_APICALL
+zexDriverGetUsmAllocationCacheStats(
+    ze_driver_handle_t hDriver,
+    zex_usm_allocation_cache_stats_t *pDeviceCacheStats,
+    zex_usm_allocation_cache_stats_t *pHostCacheStats) {
+    auto svmAllocsManager = L0::DriverHandle::fromHandle(hDriver)->getSvmAllocsManager();
+    auto copyStats = [](const NEO::SvmAllocationCacheStats &stats, zex_usm_allocation_cache_stats_t *pStats) {
+        if (pStats) {
+            pStats->hits = stats.hits;
+            pStats->misses = stats.misses;
+            pStats->evictions = stats.evictions;
+            pStats->bytesHeld = stats.bytesHeld;
+            pStats->maxSize = stats.maxSize;
+        }
+    };
+    copyStats(svmAllocsManager->getUSMDeviceAllocCacheStats(), pDeviceCacheStats);
+    copyStats(svmAllocsManager->getUSMHostAllocCacheStats(), pHostCacheStats);
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
 
 ze_result_t ZE_APICALL
@@ -86,4 +107,12 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress) {
     return L0::zexDriverGetHostPointerBaseAddress(hDriver, ptr, baseAddress);
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexDriverGetUsmAllocationCacheStats(
+    ze_driver_handle_t hDriver,
+    zex_usm_allocation_cache_stats_t *pDeviceCacheStats,
+    zex_usm_allocation_cache_stats_t *pHostCacheStats) {
+    return L0::zexDriverGetUsmAllocationCacheStats(hDriver, pDeviceCacheStats, pHostCacheStats);
+}
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,13 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress          ///< [out] if not null, returns address of the base pointer of the imported pointer
 );
 
+ze_result_t ZE_APICALL
+zexDriverGetUsmAllocationCacheStats(
+    ze_driver_handle_t hDriver,                          ///< [in] handle of the driver
+    zex_usm_allocation_cache_stats_t *pDeviceCacheStats, ///< [out][optional] statistics of device usm allocation cache
+    zex_usm_allocation_cache_stats_t *pHostCacheStats    ///< [out][optional] statistics of host usm allocation cache
+);
+
 } // namespace L0
 
 #endif // _ZEX_DRIVER_H
@@ -16,6 +16,8 @@
 #include "level_zero/core/source/driver/driver_handle.h"
 #include "level_zero/core/source/event/event.h"
 
+#include <vector>
+
 namespace L0 {
 
 ZE_APIEXPORT ze_result_t ZE_APICALL
@@ -84,6 +86,23 @@ zexCounterBasedEventCreate(ze_context_handle_t hContext, ze_device_handle_t hDev
     return ZE_RESULT_SUCCESS;
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout, ze_bool_t waitAll, uint32_t *pSignaledEventIndex) {
+    if (numEvents == 0 || !phEvents) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    std::vector<Event *> events(numEvents);
+    for (uint32_t i = 0; i < numEvents; i++) {
+        events[i] = Event::fromHandle(phEvents[i]);
+        if (!events[i]) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    return Event::hostSynchronizeMultiple(numEvents, events.data(), timeout, waitAll, pSignaledEventIndex);
+}
+
 ZE_APIEXPORT ze_result_t ZE_APICALL zexIntelAllocateNetworkInterrupt(ze_context_handle_t hContext, uint32_t &networkInterruptId) {
     auto context = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
 
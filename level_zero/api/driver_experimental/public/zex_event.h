@@ -27,6 +27,14 @@ zexCounterBasedEventCreate(
     const ze_event_desc_t *desc,
     ze_event_handle_t *phEvent);
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    uint64_t timeout,
+    ze_bool_t waitAll,
+    uint32_t *pSignaledEventIndex);
+
 ZE_APIEXPORT ze_result_t ZE_APICALL zexIntelAllocateNetworkInterrupt(ze_context_handle_t hContext, uint32_t &networkInterruptId);
 
 ZE_APIEXPORT ze_result_t ZE_APICALL zexIntelReleaseNetworkInterrupt(ze_context_handle_t hContext, uint32_t networkInterruptId);
@@ -39,4 +39,15 @@ typedef struct _zex_kernel_register_file_size_exp_t {
     uint32_t registerFileSize;                                               ///< [out] Register file size used in kernel
 } zex_kernel_register_file_size_exp_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Native binary file descriptor.
+/// May be passed to zeModuleCreate via pNext member of ze_module_desc_t with ZE_MODULE_FORMAT_NATIVE format.
+/// The native binary (or archive of binaries) is read from pFilePath and pInputModule/inputSize are ignored.
+/// The file is memory mapped for the lifetime of the module instead of being copied.
+typedef struct _zex_module_file_exp_desc_t {
+    ze_structure_type_t stype = ZEX_INTEL_STRUCTURE_TYPE_MODULE_FILE_EXP_DESC; ///< [in] type of this structure
+    const void *pNext = nullptr;                                               ///< [in][optional] must be null
+    const char *pFilePath = nullptr;                                           ///< [in] path to the native binary file
+} zex_module_file_exp_desc_t;
+
 #endif // _ZEX_MODULE_H
@@ -62,9 +62,17 @@ struct CommandList : _ze_command_list_handle_t {
     using CommandsToPatch = StackVec<CommandToPatch, 16>;
     using CmdListReturnPoints = StackVec<CmdListReturnPoint, 32>;
 
+    // Mutable command updates implemented by the driver, reported together with platform capabilities
+    static constexpr ze_mutable_command_exp_flags_t supportedMutableCommandFlags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS |
+                                                                                   ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT |
+                                                                                   ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET |
+                                                                                   ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT |
+                                                                                   ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS;
+
     virtual ze_result_t close() = 0;
     virtual ze_result_t destroy() = 0;
     virtual ze_result_t appendEventReset(ze_event_handle_t hEvent) = 0;
+    virtual ze_result_t appendEventsReset(uint32_t numEvents, ze_event_handle_t *phEvents) = 0;
     virtual ze_result_t appendBarrier(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                                       ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) = 0;
     virtual ze_result_t appendMemoryRangesBarrier(uint32_t numRanges, const size_t *pRangeSizes,
@@ -140,6 +148,26 @@ struct CommandList : _ze_command_list_handle_t {
 
     virtual void *asMutable() { return nullptr; };
 
+    virtual ze_result_t getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint64_t *pCommandId) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    virtual ze_result_t beginGraphCapture() {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t endGraphCapture(ze_command_list_handle_t *phGraph) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
 
@@ -359,6 +387,14 @@ struct CommandList : _ze_command_list_handle_t {
         return heaplessModeEnabled;
     }
 
+    bool isMutableCommandListEnabled() const {
+        return mutableCommandListEnabled;
+    }
+
+    void enableMutableCommandList() {
+        mutableCommandListEnabled = true;
+    }
+
     bool isHeaplessStateInitEnabled() const {
         return heaplessStateInitEnabled;
     }
@@ -478,6 +514,7 @@ struct CommandList : _ze_command_list_handle_t {
     bool dispatchCmdListBatchBufferAsPrimary = false;
     bool copyThroughLockedPtrEnabled = false;
     bool useOnlyGlobalTimestamps = false;
+    bool mutableCommandListEnabled = false;
     bool heaplessModeEnabled = false;
     bool heaplessStateInitEnabled = false;
     bool scratchAddressPatchingEnabled = false;
@@ -81,6 +81,7 @@ struct CommandListCoreFamily : public CommandListImp {
 
     ze_result_t close() override;
     ze_result_t appendEventReset(ze_event_handle_t hEvent) override;
+    ze_result_t appendEventsReset(uint32_t numEvents, ze_event_handle_t *phEvents) override;
     ze_result_t appendBarrier(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                               ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
     ze_result_t appendMemoryRangesBarrier(uint32_t numRanges,
@@ -204,6 +205,11 @@ struct CommandListCoreFamily : public CommandListImp {
     ze_result_t appendCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists,
                                    ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
 
+    ze_result_t getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint64_t *pCommandId) override;
+    ze_result_t updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) override;
+    ze_result_t updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) override;
+    ze_result_t updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+
     ze_result_t reserveSpace(size_t size, void **ptr) override;
     ze_result_t reset() override;
     ze_result_t executeCommandListImmediate(bool performMigration) override;
@@ -286,6 +292,8 @@ struct CommandListCoreFamily : public CommandListImp {
                                           Event *signalEvent,
                                           CmdListKernelLaunchParams &launchParams);
 
+    ze_result_t appendEventsRangeFill(NEO::GraphicsAllocation *eventPoolAllocation, size_t offset, size_t size, CmdListKernelLaunchParams &launchParams);
+
     void appendWaitOnSingleEvent(Event *event, CommandToPatchContainer *outWaitCmds, bool relaxedOrderingAllowed, CommandToPatch::CommandType storedSemaphore);
 
     void appendSdiInOrderCounterSignalling(uint64_t baseGpuVa, uint64_t signalValue, bool copyOffloadOperation);
@@ -372,13 +380,27 @@ struct CommandListCoreFamily : public CommandListImp {
     void disablePatching(size_t inOrderPatchIndex);
     void enablePatching(size_t inOrderPatchIndex);
 
+    MutableKernelDispatch *getMutableKernelDispatch(uint64_t commandId);
+    void storeMutableKernelDispatch(MutableKernelDispatch &mutableDispatch, Kernel *kernel, const ze_group_count_t &threadGroupDimensions,
+                                    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, Event *signalEvent);
+    ze_result_t updateMutableKernelArgument(MutableKernelDispatch &mutableDispatch, const ze_mutable_kernel_argument_exp_desc_t &desc);
+    ze_result_t updateMutableGroupCount(MutableKernelDispatch &mutableDispatch, const ze_mutable_group_count_exp_desc_t &desc);
+    ze_result_t updateMutableGlobalOffset(MutableKernelDispatch &mutableDispatch, const ze_mutable_global_offset_exp_desc_t &desc);
+    void patchMutableKernelCrossThreadData(MutableKernelDispatch &mutableDispatch);
+    void patchMutableKernelGroupCount(MutableKernelDispatch &mutableDispatch);
+    ze_result_t patchMutableKernelSignalEvent(MutableKernelDispatch &mutableDispatch, Event *signalEvent);
+
     void appendCopyOperationFence(Event *signalEvent, NEO::GraphicsAllocation *srcAllocation, NEO::GraphicsAllocation *dstAllocation, bool copyOffloadOperation);
     bool isDeviceToHostCopyEventFenceRequired(Event *signalEvent) const;
     bool isDeviceToHostBcsCopy(NEO::GraphicsAllocation *srcAllocation, NEO::GraphicsAllocation *dstAllocation, bool copyOffloadOperation) const;
 
     NEO::InOrderPatchCommandsContainer<GfxFamily> inOrderPatchCmds;
+    std::vector<MutableKernelDispatch> mutableKernelDispatches;
 
     uint64_t latestHostWaitedInOrderSyncValue = 0;
+    uint64_t lastMutableCommandId = 0;
+    uint64_t pendingMutableCommandId = 0;
+    ze_mutable_command_exp_flags_t pendingMutableCommandFlags = 0;
     bool latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
     bool duplicatedInOrderCounterStorageEnabled = false;
     bool inOrderAtomicSignalingEnabled = false;
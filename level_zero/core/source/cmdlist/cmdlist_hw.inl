@@ -157,6 +157,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
 
     this->inOrderPatchCmds.clear();
 
+    this->mutableKernelDispatches.clear();
+    this->pendingMutableCommandId = 0;
+    this->pendingMutableCommandFlags = 0;
+
     return ZE_RESULT_SUCCESS;
 }
 
@@ -392,7 +396,12 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
         callId = neoDevice->getRootDeviceEnvironment().tagsManager->currentCallCount;
     }
 
-    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, launchParams.outListCommands, relaxedOrderingDispatch, true, true, launchParams.omitAddingWaitEventsResidency);
+    MutableKernelDispatch mutableDispatch = {};
+    const bool storeMutableDispatch = (this->pendingMutableCommandId != 0) && !launchParams.isBuiltInKernel && !launchParams.isKernelSplitOperation &&
+                                      !launchParams.makeKernelCommandView && (launchParams.outListCommands == nullptr);
+    auto outWaitCmds = storeMutableDispatch ? &mutableDispatch.waitEventCommands : launchParams.outListCommands;
+
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, outWaitCmds, relaxedOrderingDispatch, true, true, launchParams.omitAddingWaitEventsResidency);
     if (ret) {
         return ret;
     }
@@ -415,9 +424,20 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    if (storeMutableDispatch) {
+        launchParams.outMutableDispatch = &mutableDispatch;
+    }
+
     auto res = appendLaunchKernelWithParams(Kernel::fromHandle(kernelHandle), threadGroupDimensions,
                                             event, launchParams);
 
+    if (storeMutableDispatch) {
+        launchParams.outMutableDispatch = nullptr;
+        if (res == ZE_RESULT_SUCCESS) {
+            storeMutableKernelDispatch(mutableDispatch, Kernel::fromHandle(kernelHandle), threadGroupDimensions, numWaitEvents, phWaitEvents, event);
+        }
+    }
+
     if (!launchParams.skipInOrderNonWalkerSignaling) {
         handleInOrderDependencyCounter(event, isInOrderNonWalkerSignalingRequired(event), false);
     }
@@ -595,6 +615,164 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_hand
     return ZE_RESULT_SUCCESS;
 }
 
+// Resets all events with one fill kernel per contiguous range of event pool memory and a single barrier,
+// instead of a post sync operation per event. Fill writes Event::STATE_CLEARED to every byte, so events with
+// 64-bit packets, as well as copy-only lists, fall back to post sync operations batched in one append.
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventsReset(uint32_t numEvents, ze_event_handle_t *phEvents) {
+    std::vector<Event *> events;
+    events.reserve(numEvents);
+
+    bool fillAllowed = !isCopyOnly();
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(phEvents[i]);
+
+        event->disableImplicitCounterBasedMode();
+
+        if (event->isCounterBased()) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        fillAllowed &= (event->getTimestampSizeInDw() == 1);
+        events.push_back(event);
+    }
+
+    NEO::Device *neoDevice = device->getNEODevice();
+    uint32_t callId = 0;
+    if (NEO::debugManager.flags.EnableSWTags.get()) {
+        neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::CallNameBeginTag>(
+            *commandContainer.getCommandStream(),
+            *neoDevice,
+            "zexCommandListAppendEventsReset",
+            ++neoDevice->getRootDeviceEnvironment().tagsManager->currentCallCount);
+        callId = neoDevice->getRootDeviceEnvironment().tagsManager->currentCallCount;
+    }
+
+    if (this->isInOrderExecutionEnabled()) {
+        handleInOrderImplicitDependencies(isRelaxedOrderingDispatchAllowed(0, false));
+    }
+
+    appendSynchronizedDispatchInitializationSection();
+
+    for (auto event : events) {
+        event->resetPackets(false);
+        event->disableHostCaching(!isImmediateType());
+        commandContainer.addToResidencyContainer(event->getPoolAllocation(this->device));
+    }
+
+    if (fillAllowed) {
+        std::sort(events.begin(), events.end(), [this](const Event *lhs, const Event *rhs) {
+            return lhs->getGpuAddress(this->device) < rhs->getGpuAddress(this->device);
+        });
+
+        auto lock = device->getBuiltinFunctionsLib()->obtainUniqueOwnership();
+
+        CmdListKernelLaunchParams launchParams = {};
+        launchParams.isBuiltInKernel = true;
+        launchParams.isKernelSplitOperation = true;
+
+        size_t eventIndex = 0;
+        while (eventIndex < events.size()) {
+            auto rangeAllocation = events[eventIndex]->getPoolAllocation(this->device);
+            size_t rangeStart = events[eventIndex]->getEventPoolOffset();
+            size_t rangeEnd = rangeStart + events[eventIndex]->getTotalEventSize();
+
+            for (eventIndex++; eventIndex < events.size(); eventIndex++) {
+                auto event = events[eventIndex];
+                if (event->getPoolAllocation(this->device) != rangeAllocation || event->getEventPoolOffset() > rangeEnd) {
+                    break;
+                }
+                rangeEnd = std::max(rangeEnd, event->getEventPoolOffset() + event->getTotalEventSize());
+            }
+
+            auto ret = appendEventsRangeFill(rangeAllocation, rangeStart, rangeEnd - rangeStart, launchParams);
+            if (ret) {
+                return ret;
+            }
+        }
+
+        NEO::PipeControlArgs args;
+        args.dcFlushEnable = getDcFlushRequired(true);
+        NEO::MemorySynchronizationCommands<GfxFamily>::addSingleBarrier(*commandContainer.getCommandStream(), args);
+    } else {
+        for (auto event : events) {
+            bool useMaxPackets = event->isEventTimestampFlagSet() || (event->getPacketsInUse() < this->partitionCount);
+            bool appendPipeControlWithPostSync = (!isCopyOnly()) && (event->isSignalScope() || event->isEventTimestampFlagSet());
+            dispatchEventPostSyncOperation(event, nullptr, nullptr, Event::STATE_CLEARED, false, useMaxPackets, appendPipeControlWithPostSync, false, isCopyOnly());
+        }
+    }
+
+    if (!isCopyOnly()) {
+        if (this->partitionCount > 1) {
+            appendMultiTileBarrier(*neoDevice);
+        }
+    }
+
+    if (this->isInOrderExecutionEnabled()) {
+        appendSignalInOrderDependencyCounter(nullptr, false);
+    }
+    handleInOrderDependencyCounter(nullptr, false, false);
+
+    appendSynchronizedDispatchCleanupSection();
+
+    if (NEO::debugManager.flags.EnableSWTags.get()) {
+        neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::CallNameEndTag>(
+            *commandContainer.getCommandStream(),
+            *neoDevice,
+            "zexCommandListAppendEventsReset",
+            callId);
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventsRangeFill(NEO::GraphicsAllocation *eventPoolAllocation, size_t offset, size_t size, CmdListKernelLaunchParams &launchParams) {
+    const bool isStateless = this->cmdListHeapAddressModel == NEO::HeapAddressModel::globalStateless;
+    const bool isHeapless = this->isHeaplessModeEnabled();
+    const uint8_t pattern = static_cast<uint8_t>(Event::STATE_CLEARED);
+
+    AlignedAllocationData dstAllocation = {static_cast<uintptr_t>(eventPoolAllocation->getGpuAddress()), offset, eventPoolAllocation, false};
+
+    auto builtin = BuiltinTypeHelper::adjustBuiltinType<Builtin::fillBufferImmediate>(isStateless, isHeapless);
+    Kernel *builtinKernel = device->getBuiltinFunctionsLib()->getFunction(builtin);
+
+    CmdListFillKernelArguments fillArguments = {};
+    setupFillKernelArguments(dstAllocation.offset, sizeof(pattern), size, fillArguments, builtinKernel);
+
+    ze_result_t res = ZE_RESULT_SUCCESS;
+    if (fillArguments.leftRemainingBytes > 0) {
+        res = appendUnalignedFillKernel(isStateless, fillArguments.leftRemainingBytes, dstAllocation, &pattern, nullptr, launchParams);
+        if (res) {
+            return res;
+        }
+    }
+
+    res = builtinKernel->setGroupSize(static_cast<uint32_t>(fillArguments.mainGroupSize), 1u, 1u);
+    if (res) {
+        DEBUG_BREAK_IF(true);
+        return res;
+    }
+
+    ze_group_count_t dispatchKernelArgs{static_cast<uint32_t>(fillArguments.groups), 1u, 1u};
+
+    uint32_t value = 0;
+    memset(&value, pattern, sizeof(value));
+    builtinKernel->setArgBufferWithAlloc(0, dstAllocation.alignedAllocationPtr, dstAllocation.alloc, nullptr);
+    builtinKernel->setArgumentValue(1, sizeof(fillArguments.mainOffset), &fillArguments.mainOffset);
+    builtinKernel->setArgumentValue(2, sizeof(value), &value);
+
+    res = appendLaunchKernelSplit(builtinKernel, dispatchKernelArgs, nullptr, launchParams);
+    if (res) {
+        return res;
+    }
+
+    if (fillArguments.rightRemainingBytes > 0) {
+        dstAllocation.offset = fillArguments.rightOffset;
+        res = appendUnalignedFillKernel(isStateless, fillArguments.rightRemainingBytes, dstAllocation, &pattern, nullptr, launchParams);
+    }
+    return res;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(uint32_t numRanges,
                                                                             const size_t *pRangeSizes,
@@ -4165,4 +4343,295 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCommandLists(uint32_t nu
     return ZE_RESULT_ERROR_INVALID_ARGUMENT;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint64_t *pCommandId) {
+    if (!this->mutableCommandListEnabled || this->heaplessModeEnabled) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto supportedFlags = L0GfxCoreHelper::getCmdListUpdateCapabilities(device->getNEODevice()->getRootDeviceEnvironment()) & CommandList::supportedMutableCommandFlags;
+    if ((desc->flags & ~supportedFlags) != 0) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    this->pendingMutableCommandId = ++this->lastMutableCommandId;
+    this->pendingMutableCommandFlags = desc->flags;
+    *pCommandId = this->pendingMutableCommandId;
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+MutableKernelDispatch *CommandListCoreFamily<gfxCoreFamily>::getMutableKernelDispatch(uint64_t commandId) {
+    // command ids are handed out in increasing order, so dispatches stay sorted
+    auto it = std::lower_bound(mutableKernelDispatches.begin(), mutableKernelDispatches.end(), commandId,
+                               [](const MutableKernelDispatch &dispatch, uint64_t id) { return dispatch.commandId < id; });
+    if (it == mutableKernelDispatches.end() || it->commandId != commandId) {
+        return nullptr;
+    }
+    return &(*it);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::storeMutableKernelDispatch(MutableKernelDispatch &mutableDispatch, Kernel *kernel, const ze_group_count_t &threadGroupDimensions,
+                                                                    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, Event *signalEvent) {
+    auto crossThreadData = kernel->getCrossThreadData();
+    mutableDispatch.crossThreadData.assign(crossThreadData, crossThreadData + kernel->getCrossThreadDataSize());
+    mutableDispatch.groupCount = threadGroupDimensions;
+    auto groupSize = kernel->getGroupSize();
+    std::copy(groupSize, groupSize + 3, mutableDispatch.groupSize);
+    mutableDispatch.commandId = this->pendingMutableCommandId;
+    mutableDispatch.mutableFlags = this->pendingMutableCommandFlags;
+    mutableDispatch.kernel = kernel;
+    mutableDispatch.signalEvent = signalEvent;
+
+    size_t semaphoresCount = 0;
+    bool counterBasedWaitEvent = false;
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto waitEvent = Event::fromHandle(phWaitEvents[i]);
+        counterBasedWaitEvent |= waitEvent->isCounterBased();
+        mutableDispatch.waitEvents.push_back(waitEvent);
+        mutableDispatch.waitEventPackets.push_back(waitEvent->getPacketsToWait());
+        semaphoresCount += waitEvent->getPacketsToWait();
+    }
+    // every wait event has to be backed by one semaphore per packet, otherwise there is nothing to repoint
+    mutableDispatch.waitEventsMutable = !counterBasedWaitEvent && (mutableDispatch.waitEventCommands.size() == semaphoresCount);
+
+    this->mutableKernelDispatches.push_back(std::move(mutableDispatch));
+    this->pendingMutableCommandId = 0;
+    this->pendingMutableCommandFlags = 0;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) {
+    if (!this->mutableCommandListEnabled) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto getDispatch = [this](uint64_t commandId, ze_mutable_command_exp_flags_t requiredFlag) -> MutableKernelDispatch * {
+        auto mutableDispatch = getMutableKernelDispatch(commandId);
+        if (mutableDispatch == nullptr || (mutableDispatch->mutableFlags & requiredFlag) == 0) {
+            return nullptr;
+        }
+        return mutableDispatch;
+    };
+
+    auto extendedDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (extendedDesc) {
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC) {
+            auto argumentDesc = reinterpret_cast<const ze_mutable_kernel_argument_exp_desc_t *>(extendedDesc);
+            auto mutableDispatch = getDispatch(argumentDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS);
+            if (mutableDispatch == nullptr) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            result = updateMutableKernelArgument(*mutableDispatch, *argumentDesc);
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC) {
+            auto groupCountDesc = reinterpret_cast<const ze_mutable_group_count_exp_desc_t *>(extendedDesc);
+            auto mutableDispatch = getDispatch(groupCountDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT);
+            if (mutableDispatch == nullptr) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            result = updateMutableGroupCount(*mutableDispatch, *groupCountDesc);
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC) {
+            auto globalOffsetDesc = reinterpret_cast<const ze_mutable_global_offset_exp_desc_t *>(extendedDesc);
+            auto mutableDispatch = getDispatch(globalOffsetDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET);
+            if (mutableDispatch == nullptr) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            result = updateMutableGlobalOffset(*mutableDispatch, *globalOffsetDesc);
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GROUP_SIZE_EXP_DESC) {
+            result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+        extendedDesc = reinterpret_cast<const ze_base_desc_t *>(extendedDesc->pNext);
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableKernelArgument(MutableKernelDispatch &mutableDispatch, const ze_mutable_kernel_argument_exp_desc_t &desc) {
+    const auto &explicitArgs = mutableDispatch.kernel->getKernelDescriptor().payloadMappings.explicitArgs;
+    if (desc.argIndex >= explicitArgs.size()) {
+        return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+    }
+
+    const auto &arg = explicitArgs[desc.argIndex];
+    auto crossThreadData = ArrayRef<uint8_t>(mutableDispatch.crossThreadData.data(), mutableDispatch.crossThreadData.size());
+
+    if (arg.type == NEO::ArgDescriptor::argTValue) {
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            if (element.sourceOffset >= desc.argSize) {
+                break;
+            }
+            UNRECOVERABLE_IF(static_cast<size_t>(element.offset) + element.size > crossThreadData.size());
+            auto pDst = ptrOffset(crossThreadData.begin(), element.offset);
+            size_t bytesToCopy = std::min(static_cast<size_t>(element.size), desc.argSize - element.sourceOffset);
+            if (desc.pArgValue) {
+                memcpy_s(pDst, element.size, ptrOffset(desc.pArgValue, element.sourceOffset), bytesToCopy);
+            } else {
+                memset(pDst, 0, bytesToCopy);
+            }
+        }
+    } else if (arg.type == NEO::ArgDescriptor::argTPointer) {
+        const auto &argAsPtr = arg.as<NEO::ArgDescPointer>();
+        // surface states and buffer offsets are baked into heaps; only a plain stateless address can be repointed in place
+        if (arg.getTraits().getAddressQualifier() == NEO::KernelArgMetadata::AddrLocal ||
+            NEO::isUndefinedOffset(argAsPtr.stateless) || NEO::isValidOffset(argAsPtr.bindful) ||
+            NEO::isValidOffset(argAsPtr.bindless) || NEO::isValidOffset(argAsPtr.bufferOffset)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+
+        uintptr_t gpuAddress = 0u;
+        if (desc.pArgValue != nullptr) {
+            auto requestedAddress = *reinterpret_cast<void *const *>(desc.pArgValue);
+            auto driverHandle = device->getDriverHandle();
+            auto alloc = driverHandle->getDriverSystemMemoryAllocation(requestedAddress, 1u, device->getRootDeviceIndex(), &gpuAddress);
+            if (alloc == nullptr) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            commandContainer.addToResidencyContainer(alloc);
+        }
+        NEO::patchPointer(crossThreadData, argAsPtr, gpuAddress);
+    } else {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    patchMutableKernelCrossThreadData(mutableDispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableGroupCount(MutableKernelDispatch &mutableDispatch, const ze_mutable_group_count_exp_desc_t &desc) {
+    if (desc.pGroupCount == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto kernel = mutableDispatch.kernel;
+    const auto &kernelDescriptor = kernel->getKernelDescriptor();
+    if (this->partitionCount > 1 || kernelDescriptor.kernelAttributes.flags.requiresImplicitArgs ||
+        kernel->usesSyncBuffer() || kernel->usesRegionGroupBarrier()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    const auto groupCount = *desc.pGroupCount;
+    // group size encoded in the walker at append, kernel group size may have been changed since
+    const auto groupSize = mutableDispatch.groupSize;
+    uint32_t globalWorkSize[3] = {groupCount.groupCountX * groupSize[0], groupCount.groupCountY * groupSize[1], groupCount.groupCountZ * groupSize[2]};
+    uint32_t numWorkGroups[3] = {groupCount.groupCountX, groupCount.groupCountY, groupCount.groupCountZ};
+
+    auto crossThreadData = ArrayRef<uint8_t>(mutableDispatch.crossThreadData.data(), mutableDispatch.crossThreadData.size());
+    NEO::patchVecNonPointer(crossThreadData, kernelDescriptor.payloadMappings.dispatchTraits.globalWorkSize, globalWorkSize);
+    NEO::patchVecNonPointer(crossThreadData, kernelDescriptor.payloadMappings.dispatchTraits.numWorkGroups, numWorkGroups);
+
+    uint32_t workDim = 1;
+    if (globalWorkSize[2] > 1) {
+        workDim = 3;
+    } else if (globalWorkSize[1] > 1) {
+        workDim = 2;
+    }
+    if (NEO::isValidOffset(kernelDescriptor.payloadMappings.dispatchTraits.workDim)) {
+        NEO::patchNonPointer<uint32_t, uint32_t>(crossThreadData, kernelDescriptor.payloadMappings.dispatchTraits.workDim, workDim);
+    }
+
+    mutableDispatch.groupCount = groupCount;
+    patchMutableKernelGroupCount(mutableDispatch);
+    patchMutableKernelCrossThreadData(mutableDispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableGlobalOffset(MutableKernelDispatch &mutableDispatch, const ze_mutable_global_offset_exp_desc_t &desc) {
+    const auto &kernelDescriptor = mutableDispatch.kernel->getKernelDescriptor();
+    if (kernelDescriptor.kernelAttributes.flags.requiresImplicitArgs) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    uint32_t globalOffsets[3] = {desc.offsetX, desc.offsetY, desc.offsetZ};
+    auto crossThreadData = ArrayRef<uint8_t>(mutableDispatch.crossThreadData.data(), mutableDispatch.crossThreadData.size());
+    NEO::patchVecNonPointer(crossThreadData, kernelDescriptor.payloadMappings.dispatchTraits.globalWorkOffset, globalOffsets);
+
+    patchMutableKernelCrossThreadData(mutableDispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+    auto mutableDispatch = getMutableKernelDispatch(commandId);
+    if (mutableDispatch == nullptr || (mutableDispatch->mutableFlags & ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT) == 0) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (!mutableDispatch->signalEventMutable) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (hSignalEvent == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+
+    // the walker postsync is the only command signaling the event, so the new one has to need exactly the same programming
+    auto previousEvent = mutableDispatch->signalEvent;
+    auto newEvent = Event::fromHandle(hSignalEvent);
+    if (newEvent->isCounterBased() ||
+        newEvent->isUsingContextEndOffset() != previousEvent->isUsingContextEndOffset() ||
+        newEvent->isSignalScope(ZE_EVENT_SCOPE_FLAG_HOST) != previousEvent->isSignalScope(ZE_EVENT_SCOPE_FLAG_HOST) ||
+        newEvent->isInterruptModeEnabled() || getDcFlushRequired(newEvent->isSignalScope()) ||
+        (this->signalAllEventPackets && newEvent->getMaxPacketsCount() > this->partitionCount)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    newEvent->resetKernelCountAndPacketUsedCount();
+    newEvent->setPacketsInUse(this->partitionCount);
+    auto result = patchMutableKernelSignalEvent(*mutableDispatch, newEvent);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
+    commandContainer.addToResidencyContainer(newEvent->getPoolAllocation(this->device));
+    addToMappedEventList(newEvent);
+    mutableDispatch->signalEvent = newEvent;
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto mutableDispatch = getMutableKernelDispatch(commandId);
+    if (mutableDispatch == nullptr || (mutableDispatch->mutableFlags & ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS) == 0) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (!mutableDispatch->waitEventsMutable) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (numWaitEvents != mutableDispatch->waitEvents.size() || (numWaitEvents > 0 && phWaitEvents == nullptr)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto newEvent = Event::fromHandle(phWaitEvents[i]);
+        if (newEvent->isCounterBased() || newEvent->getPacketsToWait() != mutableDispatch->waitEventPackets[i] ||
+            (this->dcFlushSupport && newEvent->isWaitScope() && !mutableDispatch->waitEvents[i]->isWaitScope())) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    size_t semaphoreIndex = 0;
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto newEvent = Event::fromHandle(phWaitEvents[i]);
+        auto eventGpuAddress = newEvent->getGpuAddress(this->device);
+        for (uint32_t packet = 0; packet < mutableDispatch->waitEventPackets[i]; packet++) {
+            auto &semaphoreCmd = mutableDispatch->waitEventCommands[semaphoreIndex++];
+            auto semaphore = reinterpret_cast<typename GfxFamily::MI_SEMAPHORE_WAIT *>(semaphoreCmd.pDestination);
+            semaphore->setSemaphoreGraphicsAddress(eventGpuAddress + packet * newEvent->getSinglePacketSize() + newEvent->getCompletionFieldOffset());
+        }
+        commandContainer.addToResidencyContainer(newEvent->getPoolAllocation(this->device));
+        mutableDispatch->waitEvents[i] = newEvent;
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
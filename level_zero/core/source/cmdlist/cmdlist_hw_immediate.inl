@@ -40,6 +40,7 @@
 
 #include "encode_surface_state_args.h"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 
@@ -50,6 +51,13 @@ CommandListCoreFamilyImmediate<gfxCoreFamily>::CommandListCoreFamilyImmediate(ui
     computeFlushMethod = &CommandListCoreFamilyImmediate<gfxCoreFamily>::flushRegularTask;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    if (graphCaptureList) {
+        graphCaptureList->destroy();
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize) {
     this->commandContainer.fillReusableAllocationLists();
@@ -406,6 +414,15 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
     auto commandStream = this->commandContainer.getCommandStream();
     size_t commandStreamStart = this->cmdListCurrentStartOffset;
 
+    if (performMigration) {
+        auto deviceImp = static_cast<DeviceImp *>(this->device);
+        auto pageFaultManager = deviceImp->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+        if (pageFaultManager == nullptr) {
+            performMigration = false;
+        }
+    }
+
+    // Work above touches only command list state, keep it out of the CSR critical section
     auto csr = static_cast<CommandQueueImp *>(cmdQ)->getCsr();
     auto lockCSR = csr->obtainUniqueOwnership();
 
@@ -421,14 +438,6 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
         cmdQ->handleIndirectAllocationResidency(this->getUnifiedMemoryControls(), lockForIndirect, performMigration);
     }
 
-    if (performMigration) {
-        auto deviceImp = static_cast<DeviceImp *>(this->device);
-        auto pageFaultManager = deviceImp->getDriverHandle()->getMemoryManager()->getPageFaultManager();
-        if (pageFaultManager == nullptr) {
-            performMigration = false;
-        }
-    }
-
     cmdQ->makeResidentAndMigrate(performMigration, this->commandContainer.getResidencyContainer());
 
     static_cast<CommandQueueHw<gfxCoreFamily> *>(this->cmdQImmediate)->patchCommands(*this, 0u, false);
@@ -466,6 +475,12 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
         cmdQ->setTaskCount(completionStamp.taskCount);
 
         if (this->isSyncModeQueue) {
+            // Submission is done, do not block other command lists sharing this CSR while waiting for completion
+            if (lockForIndirect.owns_lock()) {
+                lockForIndirect.unlock();
+            }
+            lockCSR.unlock();
+
             status = hostSynchronize(std::numeric_limits<uint64_t>::max(), true);
         }
     }
@@ -505,6 +520,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &threadGroupDimensions,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendLaunchKernel(kernelHandle, threadGroupDimensions, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, launchParams, false);
+        });
+    }
 
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
@@ -559,6 +579,12 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &pDispatchArgumentsBuffer,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendLaunchKernelIndirect(kernelHandle, pDispatchArgumentsBuffer, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -571,6 +597,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendBarrier(hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false);
+        });
+    }
+
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     bool isStallingOperation = true;
@@ -604,6 +636,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false, forceDisableCopyOnlyInOrderSignaling);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, isCopyOffloadEnabled());
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -658,6 +696,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch, srcPtr, srcRegion, srcPitch, srcSlicePitch,
+                                                hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false, forceDisableCopyOnlyInOrderSignaling);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, isCopyOffloadEnabled());
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -708,6 +753,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -719,6 +770,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hSignalEvent) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, 0, nullptr, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendSignalEvent(hSignalEvent);
+        });
+    }
+
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -729,6 +786,15 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hSignalEvent) {
+    if (this->isGraphCaptureActive()) {
+        auto ret = appendToGraphCapture(nullptr, 0, nullptr, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendEventReset(hSignalEvent);
+        });
+        auto &signaledEvents = this->graphCaptureSignaledEvents;
+        signaledEvents.erase(std::remove(signaledEvents.begin(), signaledEvents.end(), Event::fromHandle(hSignalEvent)), signaledEvents.end());
+        return ret;
+    }
+
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -737,6 +803,30 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
     return flushImmediate(ret, true, true, false, false, false, hSignalEvent);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventsReset(uint32_t numEvents, ze_event_handle_t *phEvents) {
+    if (this->isGraphCaptureActive()) {
+        auto ret = appendToGraphCapture(nullptr, 0, nullptr, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendEventsReset(numEvents, phEvents);
+        });
+        auto &signaledEvents = this->graphCaptureSignaledEvents;
+        for (uint32_t i = 0; i < numEvents; i++) {
+            signaledEvents.erase(std::remove(signaledEvents.begin(), signaledEvents.end(), Event::fromHandle(phEvents[i])), signaledEvents.end());
+        }
+        return ret;
+    }
+
+    checkAvailableSpace(0, false, commonImmediateCommandSize);
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendEventsReset(numEvents, phEvents);
+    ret = flushImmediate(ret, true, true, false, false, false, nullptr);
+
+    auto csr = static_cast<CommandQueueImp *>(this->cmdQImmediate)->getCsr();
+    for (uint32_t i = 0; i < numEvents; i++) {
+        Event::fromHandle(phEvents[i])->setCsr(csr, this->isInOrderExecutionEnabled());
+    }
+    return ret;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                                NEO::GraphicsAllocation *srcAllocation,
@@ -770,6 +860,15 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phWaitEvents, CommandToPatchContainer *outWaitCmds,
                                                                               bool relaxedOrderingAllowed, bool trackDependencies, bool apiRequest, bool skipAddingWaitEventsToResidency, bool skipFlush) {
+    if (this->isGraphCaptureActive() && apiRequest) {
+        return appendToGraphCapture(nullptr, numEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            if (numGraphWaitEvents == 0) {
+                return ZE_RESULT_SUCCESS;
+            }
+            return graph.appendWaitOnEvents(numGraphWaitEvents, phGraphWaitEvents, outWaitCmds, false, trackDependencies, apiRequest, skipAddingWaitEventsToResidency, false);
+        });
+    }
+
     bool allSignaled = true;
     for (auto i = 0u; i < numEvents; i++) {
         allSignaled &= (!this->dcFlushSupport && Event::fromHandle(phWaitEvents[i])->isAlreadyCompleted());
@@ -796,6 +895,11 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendWriteGlobalTimestamp(dstptr, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents);
+        });
+    }
 
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
 
@@ -831,6 +935,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
                                                                                  ze_event_handle_t hSignalEvent,
                                                                                  uint32_t numWaitEvents,
                                                                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -856,6 +966,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -874,6 +990,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -894,6 +1016,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendImageCopyFromMemoryExt(hDstImage, srcPtr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -914,6 +1042,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendImageCopyToMemoryExt(dstPtr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -931,6 +1065,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      ze_event_handle_t hSignalEvent,
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numGraphWaitEvents, phGraphWaitEvents);
+        });
+    }
+
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
 
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
@@ -939,6 +1079,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(void *desc, void *ptr, uint64_t data, ze_event_handle_t signalEventHandle, bool useQwordData) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(signalEventHandle, 0, nullptr, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendWaitOnMemory(desc, ptr, data, signalEventHandle, useQwordData);
+        });
+    }
+
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(desc, ptr, data, signalEventHandle, useQwordData);
     return flushImmediate(ret, true, false, false, false, false, signalEventHandle);
@@ -946,6 +1092,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(vo
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(void *desc, void *ptr, uint64_t data) {
+    if (this->isGraphCaptureActive()) {
+        return appendToGraphCapture(nullptr, 0, nullptr, [&](CommandList &graph, uint32_t numGraphWaitEvents, ze_event_handle_t *phGraphWaitEvents) {
+            return graph.appendWriteToMemory(desc, ptr, data);
+        });
+    }
+
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(desc, ptr, data);
     return flushImmediate(ret, true, false, false, false, false, nullptr);
@@ -1500,16 +1652,127 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists,
                                                                               ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
 
+    if (numCommandLists == 0 || phCommandLists == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (this->isGraphCaptureActive()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
     auto ret = ZE_RESULT_SUCCESS;
+    bool dependenciesEncoded = false;
     if (numWaitEvents) {
         checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
         ret = this->appendWaitOnEvents(numWaitEvents, phWaitEvents, nullptr, false, true, true, true, true);
         if (ret != ZE_RESULT_SUCCESS) {
             return ret;
         }
+        dependenciesEncoded = true;
+    }
+
+    if (isInOrderExecutionEnabled() && !isCopyOnly()) {
+        // Regular command lists do not wait on this list's counter, so previously appended work has to be drained before they start
+        if (!dependenciesEncoded) {
+            checkAvailableSpace(0, false, commonImmediateCommandSize);
+        }
+        CommandListCoreFamily<gfxCoreFamily>::appendComputeBarrierCommand();
+        dependenciesEncoded = true;
+    }
+
+    if (dependenciesEncoded) {
+        this->dependenciesPresent = true;
+        ret = flushImmediate(ret, true, true, false, false, false, nullptr);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
+    // Submission ends with a stalling post-sync barrier, so anything flushed afterwards observes completed command lists
+    ret = this->cmdQImmediate->executeCommandLists(numCommandLists, phCommandLists, nullptr, true, nullptr);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    if (hSignalEvent) {
+        return this->appendSignalEvent(hSignalEvent);
+    }
+
+    if (isInOrderExecutionEnabled()) {
+        checkAvailableSpace(0, false, commonImmediateCommandSize);
+        CommandListCoreFamily<gfxCoreFamily>::appendSignalInOrderDependencyCounter(nullptr, false);
+        CommandListCoreFamily<gfxCoreFamily>::handleInOrderDependencyCounter(nullptr, false, false);
+        return flushImmediate(ret, true, true, false, false, false, nullptr);
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::beginGraphCapture() {
+    if (this->isGraphCaptureActive()) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+
+    if (isCopyOffloadEnabled()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    ze_command_list_flags_t flags = isInOrderExecutionEnabled() ? static_cast<ze_command_list_flags_t>(ZE_COMMAND_LIST_FLAG_IN_ORDER) : 0u;
+    auto productFamily = this->device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    this->graphCaptureList = CommandList::create(productFamily, this->device, this->engineGroupType, flags, returnValue, false);
+    this->graphCaptureSignaledEvents.clear();
+
+    return returnValue;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::endGraphCapture(ze_command_list_handle_t *phGraph) {
+    if (!this->isGraphCaptureActive()) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+
+    auto graph = this->graphCaptureList;
+    this->graphCaptureList = nullptr;
+    this->graphCaptureSignaledEvents.clear();
+
+    auto ret = graph->close();
+    if (ret != ZE_RESULT_SUCCESS) {
+        graph->destroy();
+        return ret;
+    }
+
+    *phGraph = graph->toHandle();
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+template <typename AppendFunctionT>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendToGraphCapture(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, AppendFunctionT appendFunction) {
+    auto &signaledEvents = this->graphCaptureSignaledEvents;
+
+    // In-order graph executes every captured operation after the previous one, so waiting on an event signaled earlier in the graph is redundant
+    StackVec<ze_event_handle_t, 16> graphWaitEvents;
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        bool signaledInGraph = std::find(signaledEvents.begin(), signaledEvents.end(), Event::fromHandle(phWaitEvents[i])) != signaledEvents.end();
+        if (signaledInGraph && isInOrderExecutionEnabled()) {
+            continue;
+        }
+        graphWaitEvents.push_back(phWaitEvents[i]);
+    }
+
+    auto ret = appendFunction(*this->graphCaptureList, static_cast<uint32_t>(graphWaitEvents.size()), graphWaitEvents.empty() ? nullptr : graphWaitEvents.data());
+
+    if (ret == ZE_RESULT_SUCCESS && hSignalEvent) {
+        auto signalEvent = Event::fromHandle(hSignalEvent);
+        if (std::find(signaledEvents.begin(), signaledEvents.end(), signalEvent) == signaledEvents.end()) {
+            signaledEvents.push_back(signalEvent);
+        }
     }
 
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    return ret;
 }
 
 } // namespace L0
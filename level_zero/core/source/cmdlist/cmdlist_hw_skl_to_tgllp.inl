@@ -204,6 +204,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         nullptr,                                                // cpuWalkerBuffer
         nullptr,                                                // cpuPayloadBuffer
         nullptr,                                                // outImplicitArgsPtr
+        nullptr,                                                // outCrossThreadDataPtr
         &additionalCommands,                                    // additionalCommands
         commandListPreemptionMode,                              // preemptionMode
         launchParams.requiredPartitionDim,                      // requiredPartitionDim
@@ -231,6 +232,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
     };
 
     NEO::EncodeDispatchKernel<GfxFamily>::encodeCommon(commandContainer, dispatchKernelArgs);
+    if (launchParams.outMutableDispatch) {
+        launchParams.outMutableDispatch->walker = dispatchKernelArgs.outWalkerPtr;
+        launchParams.outMutableDispatch->indirectCrossThreadData = dispatchKernelArgs.outCrossThreadDataPtr;
+    }
     if (!this->isFlushTaskSubmissionEnabled) {
         this->containsStatelessUncachedResource = dispatchKernelArgs.requiresUncachedMocs;
     }
@@ -358,4 +363,27 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::appendDispatchOffsetRegister(bool workloadPartitionEvent, bool beforeProfilingCmds) {
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::patchMutableKernelCrossThreadData(MutableKernelDispatch &mutableDispatch) {
+    if (mutableDispatch.crossThreadData.size() > 0) {
+        memcpy_s(mutableDispatch.indirectCrossThreadData, mutableDispatch.crossThreadData.size(),
+                 mutableDispatch.crossThreadData.data(), mutableDispatch.crossThreadData.size());
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::patchMutableKernelGroupCount(MutableKernelDispatch &mutableDispatch) {
+    using GPGPU_WALKER = typename GfxFamily::GPGPU_WALKER;
+
+    auto walker = reinterpret_cast<GPGPU_WALKER *>(mutableDispatch.walker);
+    walker->setThreadGroupIdXDimension(mutableDispatch.groupCount.groupCountX);
+    walker->setThreadGroupIdYDimension(mutableDispatch.groupCount.groupCountY);
+    walker->setThreadGroupIdZDimension(mutableDispatch.groupCount.groupCountZ);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::patchMutableKernelSignalEvent(MutableKernelDispatch &mutableDispatch, Event *signalEvent) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 } // namespace L0
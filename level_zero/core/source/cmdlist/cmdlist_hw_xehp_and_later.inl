@@ -349,6 +349,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         launchParams.cmdWalkerBuffer,                           // cpuWalkerBuffer
         launchParams.hostPayloadBuffer,                         // cpuPayloadBuffer
         nullptr,                                                // outImplicitArgsPtr
+        nullptr,                                                // outCrossThreadDataPtr
         &additionalCommands,                                    // additionalCommands
         kernelPreemptionMode,                                   // preemptionMode
         launchParams.requiredPartitionDim,                      // requiredPartitionDim
@@ -378,6 +379,18 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
     NEO::EncodeDispatchKernel<GfxFamily>::encodeCommon(commandContainer, dispatchKernelArgs);
     launchParams.outWalker = dispatchKernelArgs.outWalkerPtr;
 
+    if (launchParams.outMutableDispatch) {
+        auto mutableDispatch = launchParams.outMutableDispatch;
+        mutableDispatch->walker = dispatchKernelArgs.outWalkerPtr;
+        mutableDispatch->indirectCrossThreadData = dispatchKernelArgs.outCrossThreadDataPtr;
+        if (NEO::EncodeDispatchKernel<GfxFamily>::inlineDataProgrammingRequired(kernelDescriptor)) {
+            mutableDispatch->inlineCrossThreadDataSize = std::min(static_cast<uint32_t>(GfxFamily::DefaultWalkerType::getInlineDataSize()), kernel->getCrossThreadDataSize());
+        }
+        mutableDispatch->signalEventMutable = (event != nullptr) && (eventAddress != 0) && !l3FlushEnable && !interruptEvent &&
+                                              !this->isInOrderExecutionEnabled() && (kernel->getPrintfBufferAllocation() == nullptr) &&
+                                              (!this->signalAllEventPackets || event->getMaxPacketsCount() <= this->partitionCount);
+    }
+
     if (this->heaplessModeEnabled && this->scratchAddressPatchingEnabled && kernelNeedsScratchSpace) {
         CommandToPatch scratchInlineData;
         scratchInlineData.pDestination = dispatchKernelArgs.outWalkerPtr;
@@ -612,4 +625,46 @@ void CommandListCoreFamily<gfxCoreFamily>::appendDispatchOffsetRegister(bool wor
     }
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::patchMutableKernelCrossThreadData(MutableKernelDispatch &mutableDispatch) {
+    using DefaultWalkerType = typename GfxFamily::DefaultWalkerType;
+
+    auto crossThreadData = mutableDispatch.crossThreadData.data();
+    auto crossThreadDataSize = mutableDispatch.crossThreadData.size();
+    auto inlineDataSize = std::min(static_cast<size_t>(mutableDispatch.inlineCrossThreadDataSize), crossThreadDataSize);
+    if (inlineDataSize > 0) {
+        auto walker = reinterpret_cast<DefaultWalkerType *>(mutableDispatch.walker);
+        memcpy_s(walker->getInlineDataPointer(), DefaultWalkerType::getInlineDataSize(), crossThreadData, inlineDataSize);
+    }
+    if (crossThreadDataSize > inlineDataSize) {
+        memcpy_s(mutableDispatch.indirectCrossThreadData, crossThreadDataSize - inlineDataSize,
+                 ptrOffset(crossThreadData, inlineDataSize), crossThreadDataSize - inlineDataSize);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::patchMutableKernelGroupCount(MutableKernelDispatch &mutableDispatch) {
+    using DefaultWalkerType = typename GfxFamily::DefaultWalkerType;
+
+    auto walker = reinterpret_cast<DefaultWalkerType *>(mutableDispatch.walker);
+    walker->setThreadGroupIdXDimension(mutableDispatch.groupCount.groupCountX);
+    walker->setThreadGroupIdYDimension(mutableDispatch.groupCount.groupCountY);
+    walker->setThreadGroupIdZDimension(mutableDispatch.groupCount.groupCountZ);
+
+    auto neoDevice = device->getNEODevice();
+    auto threadGroupCount = mutableDispatch.groupCount.groupCountX * mutableDispatch.groupCount.groupCountY * mutableDispatch.groupCount.groupCountZ;
+    auto &idd = walker->getInterfaceDescriptor();
+    NEO::EncodeDispatchKernel<GfxFamily>::adjustInterfaceDescriptorData(idd, *neoDevice, neoDevice->getHardwareInfo(), threadGroupCount,
+                                                                        mutableDispatch.kernel->getKernelDescriptor().kernelAttributes.numGrfRequired, *walker);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::patchMutableKernelSignalEvent(MutableKernelDispatch &mutableDispatch, Event *signalEvent) {
+    using DefaultWalkerType = typename GfxFamily::DefaultWalkerType;
+
+    auto walker = reinterpret_cast<DefaultWalkerType *>(mutableDispatch.walker);
+    walker->getPostSync().setDestinationAddress(signalEvent->getPacketAddress(this->device));
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
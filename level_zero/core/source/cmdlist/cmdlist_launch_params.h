@@ -9,11 +9,15 @@
 
 #include "shared/source/helpers/definitions/command_encoder_args.h"
 
+#include <level_zero/ze_api.h>
+
 #include <cstddef>
 #include <cstdint>
 #include <vector>
 
 namespace L0 {
+struct Event;
+struct Kernel;
 
 struct CommandToPatch {
     enum CommandType {
@@ -45,12 +49,32 @@ struct CommandToPatch {
 
 using CommandToPatchContainer = std::vector<CommandToPatch>;
 
+// Kernel command recorded in a mutable command list, with everything needed to patch it in place
+struct MutableKernelDispatch {
+    std::vector<uint8_t> crossThreadData;
+    std::vector<Event *> waitEvents;
+    std::vector<uint32_t> waitEventPackets;
+    CommandToPatchContainer waitEventCommands;
+    ze_group_count_t groupCount = {};
+    uint32_t groupSize[3] = {};
+    uint64_t commandId = 0;
+    Kernel *kernel = nullptr;
+    Event *signalEvent = nullptr;
+    void *walker = nullptr;
+    void *indirectCrossThreadData = nullptr;
+    uint32_t inlineCrossThreadDataSize = 0;
+    uint32_t mutableFlags = 0;
+    bool signalEventMutable = false;
+    bool waitEventsMutable = false;
+};
+
 struct CmdListKernelLaunchParams {
     void *outWalker = nullptr;
     void *cmdWalkerBuffer = nullptr;
     void *hostPayloadBuffer = nullptr;
     CommandToPatch *outSyncCommand = nullptr;
     CommandToPatchContainer *outListCommands = nullptr;
+    MutableKernelDispatch *outMutableDispatch = nullptr;
     uint32_t externalPerThreadScratchSize[2] = {0U, 0U};
     NEO::RequiredPartitionDim requiredPartitionDim = NEO::RequiredPartitionDim::none;
     NEO::RequiredDispatchWalkOrder requiredDispatchWalkOrder = NEO::RequiredDispatchWalkOrder::none;
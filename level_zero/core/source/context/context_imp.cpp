@@ -268,8 +268,24 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
         unifiedMemoryProperties.allocationFlags.flags.resource48Bit = productHelper.is48bResourceNeededForRayTracing();
     }
 
+    NEO::UsmMemAllocPoolsManager *usmPoolsManager = nullptr;
+    auto poolsManagerIt = this->driverHandle->usmDeviceMemAllocPoolsManagers.find(rootDeviceIndex);
+    if (poolsManagerIt != this->driverHandle->usmDeviceMemAllocPoolsManagers.end()) {
+        usmPoolsManager = poolsManagerIt->second.get();
+    }
+    if (usmPoolsManager && false == lookupTable.exportMemory) {
+        if (auto usmPtrFromPool = usmPoolsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties)) {
+            *ptr = usmPtrFromPool;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     void *usmPtr =
         this->driverHandle->svmAllocsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    if (usmPtr == nullptr && usmPoolsManager) {
+        usmPoolsManager->trim();
+        usmPtr = this->driverHandle->svmAllocsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    }
     if (usmPtr == nullptr) {
         if (driverHandle->svmAllocsManager->getNumDeferFreeAllocs() > 0) {
             this->driverHandle->svmAllocsManager->freeSVMAllocDeferImpl();
@@ -436,6 +452,11 @@ ze_result_t ContextImp::freeMem(const void *ptr, bool blocking) {
     if (this->driverHandle->usmHostMemAllocPool.freeSVMAlloc(ptr, blocking)) {
         return ZE_RESULT_SUCCESS;
     }
+    if (auto poolsManager = this->driverHandle->getDeviceUsmAllocPoolsManager(allocation)) {
+        if (poolsManager->freeSVMAlloc(ptr, blocking)) {
+            return ZE_RESULT_SUCCESS;
+        }
+    }
     this->driverHandle->svmAllocsManager->freeSVMAlloc(const_cast<void *>(ptr), blocking);
 
     return ZE_RESULT_SUCCESS;
@@ -555,6 +576,18 @@ ze_result_t ContextImp::getMemAddressRange(const void *ptr,
                                            void **pBase,
                                            size_t *pSize) {
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
+    if (auto poolsManager = this->driverHandle->getDeviceUsmAllocPoolsManager(allocData)) {
+        if (auto pooledBasePtr = poolsManager->getPooledAllocationBasePtr(ptr)) {
+            if (pBase) {
+                *pBase = pooledBasePtr;
+            }
+            if (pSize) {
+                *pSize = poolsManager->getPooledAllocationSize(ptr);
+            }
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     if (allocData) {
         NEO::GraphicsAllocation *alloc;
         alloc = allocData->gpuAllocations.getDefaultGraphicsAllocation();
@@ -603,6 +636,12 @@ void ContextImp::setIPCHandleData(NEO::GraphicsAllocation *graphicsAllocation, u
     if (this->driverHandle->usmHostMemAllocPool.isInPool(addrToPtr(ptrAddress))) {
         ipcData.poolOffset = this->driverHandle->usmHostMemAllocPool.getOffsetInPool(addrToPtr(ptrAddress));
     }
+    auto allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(addrToPtr(ptrAddress));
+    if (auto poolsManager = this->driverHandle->getDeviceUsmAllocPoolsManager(allocData)) {
+        if (poolsManager->isInPool(addrToPtr(ptrAddress))) {
+            ipcData.poolOffset = poolsManager->getOffsetInPool(addrToPtr(ptrAddress));
+        }
+    }
 
     auto lock = this->driverHandle->lockIPCHandleMap();
     ipcHandleIterator = this->driverHandle->getIPCHandleMap().find(handle);
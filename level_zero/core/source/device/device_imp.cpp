@@ -228,6 +228,7 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
 
     DeviceImp::CmdListCreateFunPtrT createCommandList = &CommandList::create;
+    bool mutableCommandList = false;
 
     auto pNext = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
 
@@ -242,6 +243,10 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
             createCommandList = newCreateFunc;
         }
 
+        if (pNext->stype == ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_DESC) {
+            mutableCommandList = true;
+        }
+
         pNext = reinterpret_cast<const ze_base_desc_t *>(pNext->pNext);
     }
 
@@ -255,6 +260,9 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
 
     cmdList->setOrdinal(desc->commandQueueGroupOrdinal);
     cmdList->enableSynchronizedDispatch(syncDispatchMode);
+    if (mutableCommandList) {
+        cmdList->enableMutableCommandList();
+    }
 
     return returnValue;
 }
@@ -1066,6 +1074,11 @@ ze_result_t DeviceImp::getProperties(ze_device_properties_t *pDeviceProperties)
                 supportMatrix |= getProductHelper().supports2DBlockLoad() ? ZE_INTEL_DEVICE_EXP_FLAG_2D_BLOCK_LOAD : 0;
                 auto blockTransposeProps = reinterpret_cast<ze_intel_device_block_array_exp_properties_t *>(extendedProperties);
                 blockTransposeProps->flags = supportMatrix;
+            } else if (extendedProperties->stype == ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_PROPERTIES) {
+                auto mutableCommandListProperties = reinterpret_cast<ze_mutable_command_list_exp_properties_t *>(extendedProperties);
+                mutableCommandListProperties->mutableCommandListFlags = 0;
+                mutableCommandListProperties->mutableCommandFlags = L0GfxCoreHelper::getCmdListUpdateCapabilities(neoDevice->getRootDeviceEnvironment()) &
+                                                                    CommandList::supportedMutableCommandFlags;
             }
             getAdditionalExtProperties(extendedProperties);
             extendedProperties = static_cast<ze_base_properties_t *>(extendedProperties->pNext);
@@ -34,6 +34,7 @@
 #include "level_zero/core/source/fabric/fabric.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/image/image.h"
+#include "level_zero/core/source/module/module_build_cache.h"
 
 #include "driver_version.h"
 
@@ -184,9 +185,13 @@ ze_result_t DriverHandleImp::getExtensionProperties(uint32_t *pCount,
 DriverHandleImp::~DriverHandleImp() {
     if (memoryManager != nullptr) {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
+        this->eventPoolAllocationCache.cleanup(*memoryManager);
         if (this->svmAllocsManager) {
             this->svmAllocsManager->trimUSMDeviceAllocCache();
             this->usmHostMemAllocPool.cleanup();
+            for (auto &poolsManager : this->usmDeviceMemAllocPoolsManagers) {
+                poolsManager.second->cleanup();
+            }
         }
     }
 
@@ -269,6 +274,7 @@ ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>
     }
     this->svmAllocsManager->initUsmAllocationsCaches(*this->devices[0]->getNEODevice());
     this->initHostUsmAllocPool();
+    this->initDeviceUsmAllocPoolsManagers();
 
     this->numDevices = static_cast<uint32_t>(this->devices.size());
 
@@ -278,6 +284,10 @@ ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>
         createHostPointerManager();
     }
 
+    if (NEO::debugManager.flags.ModuleBuildInProcessCacheSize.get() > 0) {
+        this->moduleBuildCache = std::make_unique<ModuleBuildCache>(static_cast<size_t>(NEO::debugManager.flags.ModuleBuildInProcessCacheSize.get()) * MemoryConstants::megaByte);
+    }
+
     for (auto &device : this->devices) {
         if (device->getBuiltinFunctionsLib()) {
             device->getBuiltinFunctionsLib()->ensureInitCompletion();
@@ -407,6 +417,38 @@ void DriverHandleImp::initHostUsmAllocPool() {
     }
 }
 
+void DriverHandleImp::initDeviceUsmAllocPoolsManagers() {
+    if (NEO::debugManager.flags.EnableDeviceUsmAllocationPoolManager.get() <= 0) {
+        return;
+    }
+    auto maxPoolsSize = NEO::debugManager.flags.EnableDeviceUsmAllocationPoolManager.get() * MemoryConstants::megaByte;
+    for (auto &device : this->devices) {
+        auto neoDevice = device->getNEODevice();
+        auto rootDeviceIndex = neoDevice->getRootDeviceIndex();
+        auto subDeviceBitfields = this->deviceBitfields;
+        subDeviceBitfields[rootDeviceIndex] = neoDevice->getDeviceBitfield();
+        NEO::SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::deviceUnifiedMemory, MemoryConstants::pageSize2M,
+                                                                        rootDeviceIndices, subDeviceBitfields);
+        memoryProperties.device = neoDevice;
+        auto poolsManager = std::make_unique<NEO::UsmMemAllocPoolsManager>();
+        if (poolsManager->initialize(svmAllocsManager, memoryProperties, maxPoolsSize)) {
+            usmDeviceMemAllocPoolsManagers[rootDeviceIndex] = std::move(poolsManager);
+        }
+    }
+}
+
+NEO::UsmMemAllocPoolsManager *DriverHandleImp::getDeviceUsmAllocPoolsManager(const NEO::SvmAllocationData *allocData) {
+    if (nullptr == allocData || allocData->memoryType != InternalMemoryType::deviceUnifiedMemory) {
+        return nullptr;
+    }
+    auto rootDeviceIndex = allocData->gpuAllocations.getDefaultGraphicsAllocation()->getRootDeviceIndex();
+    auto poolsManagerIt = this->usmDeviceMemAllocPoolsManagers.find(rootDeviceIndex);
+    if (poolsManagerIt == this->usmDeviceMemAllocPoolsManagers.end()) {
+        return nullptr;
+    }
+    return poolsManagerIt->second.get();
+}
+
 ze_result_t DriverHandleImp::getDevice(uint32_t *pCount, ze_device_handle_t *phDevices) {
     bool exposeSubDevices = false;
 
@@ -14,6 +14,7 @@
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/event/event_pool_allocation_cache.h"
 #include "level_zero/include/ze_intel_gpu.h"
 
 #include <map>
@@ -22,6 +23,7 @@
 
 namespace L0 {
 class HostPointerManager;
+class ModuleBuildCache;
 struct FabricVertex;
 struct FabricEdge;
 struct Image;
@@ -127,8 +129,11 @@ struct DriverHandleImp : public DriverHandle {
     std::map<uint64_t, IpcHandleTracking *> &getIPCHandleMap() { return this->ipcHandles; };
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
     void initHostUsmAllocPool();
+    void initDeviceUsmAllocPoolsManagers();
+    NEO::UsmMemAllocPoolsManager *getDeviceUsmAllocPoolsManager(const NEO::SvmAllocationData *allocData);
 
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    std::unique_ptr<ModuleBuildCache> moduleBuildCache;
 
     std::mutex sharedMakeResidentAllocationsLock;
     std::map<void *, NEO::GraphicsAllocation *> sharedMakeResidentAllocations;
@@ -149,6 +154,8 @@ struct DriverHandleImp : public DriverHandle {
     NEO::MemoryManager *memoryManager = nullptr;
     NEO::SVMAllocsManager *svmAllocsManager = nullptr;
     NEO::UsmMemAllocPool usmHostMemAllocPool;
+    std::map<uint32_t, std::unique_ptr<NEO::UsmMemAllocPoolsManager>> usmDeviceMemAllocPoolsManagers;
+    EventPoolAllocationCache eventPoolAllocationCache;
 
     std::unique_ptr<NEO::OsLibrary> rtasLibraryHandle;
     bool rtasLibraryUnavailable = false;
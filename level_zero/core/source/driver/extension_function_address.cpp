@@ -27,6 +27,7 @@ void *ExtensionFunctionAddressHelper::getExtensionFunctionAddress(const std::str
     RETURN_FUNC_PTR_IF_EXIST(zexDriverImportExternalPointer);
     RETURN_FUNC_PTR_IF_EXIST(zexDriverReleaseImportedPointer);
     RETURN_FUNC_PTR_IF_EXIST(zexDriverGetHostPointerBaseAddress);
+    RETURN_FUNC_PTR_IF_EXIST(zexDriverGetUsmAllocationCacheStats);
 
     RETURN_FUNC_PTR_IF_EXIST(zexKernelGetBaseAddress);
 
@@ -36,9 +37,13 @@ void *ExtensionFunctionAddressHelper::getExtensionFunctionAddress(const std::str
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWaitOnMemory);
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWaitOnMemory64);
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWriteToMemory);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendEventsReset);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListBeginGraphCapture);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListEndGraphCapture);
 
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventCreate);
     RETURN_FUNC_PTR_IF_EXIST(zexEventGetDeviceAddress);
+    RETURN_FUNC_PTR_IF_EXIST(zexEventHostSynchronizeMultiple);
 
     RETURN_FUNC_PTR_IF_EXIST(zeMemGetPitchFor2dImage);
     RETURN_FUNC_PTR_IF_EXIST(zeImageGetDeviceOffsetExp);
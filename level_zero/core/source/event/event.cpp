@@ -34,6 +34,8 @@
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
 #include <set>
+#include <thread>
+#include <vector>
 
 namespace L0 {
 template Event *Event::create<uint64_t>(EventPool *, const ze_event_desc_t *, Device *);
@@ -96,8 +98,8 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
 
     initializeSizeParameters(numDevices, deviceHandles, *driverHandleImp, rootDeviceEnvironment);
 
-    NEO::AllocationType allocationType = isEventPoolTimestampFlagSet() ? NEO::AllocationType::timestampPacketTagBuffer
-                                                                       : NEO::AllocationType::bufferHostMemory;
+    allocationType = isEventPoolTimestampFlagSet() ? NEO::AllocationType::timestampPacketTagBuffer
+                                                   : NEO::AllocationType::bufferHostMemory;
     if (this->devices.size() > 1) {
         this->isDeviceEventPoolAllocation = false;
     }
@@ -106,12 +108,19 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         allocationType = NEO::AllocationType::gpuTimestampDeviceBuffer;
     }
 
-    eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
-
     bool allocatedMemory = false;
 
+    const bool allocationReuseEnabled = (NEO::debugManager.flags.EnableEventPoolAllocationReuse.get() == 1) && !isIpcPoolFlagSet();
+    if (allocationReuseEnabled) {
+        eventPoolAllocations = driverHandleImp->eventPoolAllocationCache.obtain(getAllocationCacheKey(), eventPoolPtr);
+    }
+
     auto neoDevice = devices[0]->getNEODevice();
-    if (this->isDeviceEventPoolAllocation) {
+    if (eventPoolAllocations) {
+        this->isHostVisibleEventPoolAllocation = this->isDeviceEventPoolAllocation ? !(isEventPoolDeviceAllocationFlagSet()) : true;
+        allocatedMemory = true;
+    } else if (this->isDeviceEventPoolAllocation) {
+        eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
         this->isHostVisibleEventPoolAllocation = !(isEventPoolDeviceAllocationFlagSet());
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, neoDevice->getDeviceBitfield()};
         allocationProperties.alignment = eventAlignment;
@@ -127,6 +136,7 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
             }
         }
     } else {
+        eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
         this->isHostVisibleEventPoolAllocation = true;
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, systemMemoryBitfield};
         allocationProperties.alignment = eventAlignment;
@@ -143,6 +153,7 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
     if (!allocatedMemory) {
         return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
     }
+    this->isAllocationReusable = allocationReuseEnabled;
     if (neoDevice->getDefaultEngine().commandStreamReceiver->isTbxMode()) {
         eventPoolAllocations->getDefaultGraphicsAllocation()->setWriteMemoryOnly(true);
     }
@@ -151,6 +162,11 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
 
 EventPool::~EventPool() {
     if (eventPoolAllocations) {
+        auto driverHandleImp = static_cast<DriverHandleImp *>(devices[0]->getDriverHandle());
+        if (this->isAllocationReusable && driverHandleImp->eventPoolAllocationCache.store(getAllocationCacheKey(), eventPoolAllocations, eventPoolPtr)) {
+            return;
+        }
+
         auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
         auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
         for (auto gpuAllocation : graphicsAllocations) {
@@ -211,6 +227,10 @@ void EventPool::initializeSizeParameters(uint32_t numDevices, ze_device_handle_t
     eventPoolSize = alignUp<size_t>(this->numEvents * eventSize, MemoryConstants::pageSize64k);
 }
 
+EventPoolAllocationCache::Key EventPool::getAllocationCacheKey() const {
+    return {devices, eventPoolSize, allocationType, isDeviceEventPoolAllocation};
+}
+
 EventPool *EventPool::create(DriverHandle *driver, Context *context, uint32_t numDevices, ze_device_handle_t *deviceHandles, const ze_event_pool_desc_t *desc, ze_result_t &result) {
     auto eventPool = std::make_unique<EventPool>(desc);
 
@@ -435,6 +455,91 @@ void *Event::getCompletionFieldHostAddress() const {
     return ptrOffset(getHostAddress(), getCompletionFieldOffset());
 }
 
+// Polls all events in one loop with a shared timeout. Each sweep reads every pending event once
+// and then backs off once - instead of a pause/monitor-wait/yield per event as in hostSynchronize.
+// When all events are awaited and the first pending one waits in KMD, that single wait is the backoff.
+ze_result_t Event::hostSynchronizeMultiple(uint32_t numEvents, Event *const *events, uint64_t timeout, bool waitAll, uint32_t *signaledEventIndex) {
+    if (NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get() != -1) {
+        timeout = NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get();
+    }
+
+    std::vector<uint32_t> pendingEvents(numEvents);
+    for (uint32_t i = 0; i < numEvents; i++) {
+        pendingEvents[i] = i;
+    }
+
+    const auto waitStartTime = std::chrono::high_resolution_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+    while (true) {
+        size_t numPendingEvents = 0;
+        for (auto eventIndex : pendingEvents) {
+            auto event = events[eventIndex];
+            bool signaled = event->csrs[0]->getType() == NEO::CommandStreamReceiverType::aub ||
+                            event->queryStatusNonBlocking() == ZE_RESULT_SUCCESS;
+            if (!signaled) {
+                pendingEvents[numPendingEvents++] = eventIndex;
+                continue;
+            }
+
+            // event is already completed - this only handles printf and assert output
+            auto ret = event->hostSynchronize(0);
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
+            if (!waitAll) {
+                if (signaledEventIndex) {
+                    *signaledEventIndex = eventIndex;
+                }
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+        pendingEvents.resize(numPendingEvents);
+        if (pendingEvents.empty()) {
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto firstPendingEvent = events[pendingEvents[0]];
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        if (std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime) >= firstPendingEvent->gpuHangCheckPeriod) {
+            lastHangCheckTime = currentTime;
+            for (auto eventIndex : pendingEvents) {
+                if (events[eventIndex]->csrs[0]->isGpuHangDetected()) {
+                    return ZE_RESULT_ERROR_DEVICE_LOST;
+                }
+            }
+        }
+
+        uint64_t remainingTimeout = std::numeric_limits<uint64_t>::max();
+        if (timeout != std::numeric_limits<uint64_t>::max()) {
+            auto timeDiff = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count());
+            if (timeDiff >= timeout) {
+                return ZE_RESULT_NOT_READY;
+            }
+            remainingTimeout = timeout - timeDiff;
+        }
+
+        if (waitAll && firstPendingEvent->isKmdWaitModeEnabled() && firstPendingEvent->isCounterBased()) {
+            auto ret = firstPendingEvent->hostSynchronize(remainingTimeout);
+            if (ret == ZE_RESULT_ERROR_DEVICE_LOST) {
+                return ret;
+            }
+            continue;
+        }
+
+        for (uint32_t i = 0; i < NEO::WaitUtils::waitCount; i++) {
+            NEO::CpuIntrinsics::pause();
+        }
+        if (NEO::WaitUtils::waitpkgUse) {
+            const void *monitorAddress = firstPendingEvent->getCompletionFieldHostAddress();
+            if (firstPendingEvent->inOrderExecInfo) {
+                monitorAddress = ptrOffset(firstPendingEvent->inOrderExecInfo->getBaseHostAddress(), firstPendingEvent->inOrderAllocationOffset);
+            }
+            NEO::WaitUtils::monitorWait(monitorAddress, 0);
+        }
+        std::this_thread::yield();
+    }
+}
+
 void Event::increaseKernelCount() {
     kernelCount++;
     UNRECOVERABLE_IF(kernelCount > maxKernelCount);
@@ -12,6 +12,8 @@
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/os_interface/os_time.h"
 
+#include "level_zero/core/source/event/event_pool_allocation_cache.h"
+
 #include <level_zero/ze_api.h>
 
 #include <atomic>
@@ -83,6 +85,7 @@ struct Event : _ze_event_handle_t {
     virtual ze_result_t hostSignal(bool allowCounterBased) = 0;
     virtual ze_result_t hostSynchronize(uint64_t timeout) = 0;
     virtual ze_result_t queryStatus() = 0;
+    virtual ze_result_t queryStatusNonBlocking() { return queryStatus(); }
     virtual ze_result_t reset() = 0;
     virtual ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) = 0;
     virtual ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) = 0;
@@ -114,6 +117,8 @@ struct Event : _ze_event_handle_t {
     template <typename TagSizeT>
     static Event *create(const EventDescriptor &eventDescriptor, const ze_event_desc_t *desc, Device *device);
 
+    static ze_result_t hostSynchronizeMultiple(uint32_t numEvents, Event *const *events, uint64_t timeout, bool waitAll, uint32_t *signaledEventIndex);
+
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
 
     inline ze_event_handle_t toHandle() { return this; }
@@ -162,6 +167,12 @@ struct Event : _ze_event_handle_t {
     size_t getTimestampSizeInDw() const {
         return timestampSizeInDw;
     }
+    size_t getEventPoolOffset() const {
+        return eventPoolOffset;
+    }
+    uint32_t getTotalEventSize() const {
+        return totalEventSize;
+    }
     void setEventTimestampFlag(bool timestampFlag) {
         isTimestampEvent = timestampFlag;
     }
@@ -433,6 +444,7 @@ struct EventPool : _ze_event_pool_handle_t {
     EventPool() = default;
     EventPool(size_t numEvents) : numEvents(numEvents) {}
     void setupDescriptorFlags(const ze_event_pool_desc_t *desc);
+    EventPoolAllocationCache::Key getAllocationCacheKey() const;
 
     std::vector<Device *> devices;
 
@@ -451,7 +463,9 @@ struct EventPool : _ze_event_pool_handle_t {
     uint32_t counterBasedFlags = 0;
 
     ze_event_pool_flags_t eventPoolFlags{};
+    NEO::AllocationType allocationType = NEO::AllocationType::unknown;
 
+    bool isAllocationReusable = false;
     bool isDeviceEventPoolAllocation = false;
     bool isHostVisibleEventPoolAllocation = false;
     bool isImportedIpcPool = false;
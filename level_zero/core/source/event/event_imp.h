@@ -35,6 +35,7 @@ struct EventImp : public Event {
     ze_result_t hostSynchronize(uint64_t timeout) override;
 
     ze_result_t queryStatus() override;
+    ze_result_t queryStatusNonBlocking() override;
 
     ze_result_t reset() override;
 
@@ -64,8 +65,9 @@ struct EventImp : public Event {
     bool tbxDownload(NEO::CommandStreamReceiver &csr, bool &downloadedAllocation, bool &downloadedInOrdedAllocation);
 
     ze_result_t calculateProfilingData();
-    ze_result_t queryStatusEventPackets();
-    ze_result_t queryCounterBasedEventStatus();
+    ze_result_t queryStatusImpl(bool blockingPoll);
+    ze_result_t queryStatusEventPackets(bool blockingPoll);
+    ze_result_t queryCounterBasedEventStatus(bool blockingPoll);
     void handleSuccessfulHostSynchronization();
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValue(TagSizeT eventValue);
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValueTimestamps(TagSizeT eventVal);
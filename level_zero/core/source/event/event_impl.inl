@@ -25,6 +25,16 @@
 #include "level_zero/tools/source/metrics/metric.h"
 
 namespace L0 {
+// Non-blocking polls only read the address - pausing, monitor-wait and yielding are left to the caller,
+// which can then share a single backoff across many events.
+template <typename T, typename PredicateT>
+inline bool pollEventAddress(T const *pollAddress, T expectedValue, PredicateT predicate, bool blockingPoll) {
+    if (blockingPoll) {
+        return NEO::WaitUtils::waitFunctionWithPredicate<const T>(pollAddress, expectedValue, predicate);
+    }
+    return predicate(*static_cast<volatile T const *>(pollAddress), expectedValue);
+}
+
 template <typename TagSizeT>
 Event *Event::create(const EventDescriptor &eventDescriptor, const ze_event_desc_t *desc, Device *device) {
     auto neoDevice = device->getNEODevice();
@@ -220,7 +230,7 @@ void EventImp<TagSizeT>::assignKernelEventCompletionData(void *address) {
 }
 
 template <typename TagSizeT>
-ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus() {
+ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus(bool blockingPoll) {
     if (!this->inOrderExecInfo.get()) {
         return ZE_RESULT_SUCCESS;
     }
@@ -231,7 +241,7 @@ ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus() {
         bool signaled = true;
         const uint64_t *hostAddress = ptrOffset(inOrderExecInfo->getBaseHostAddress(), this->inOrderAllocationOffset);
         for (uint32_t i = 0; i < inOrderExecInfo->getNumHostPartitionsToWait(); i++) {
-            if (!NEO::WaitUtils::waitFunctionWithPredicate<const uint64_t>(hostAddress, waitValue, std::greater_equal<uint64_t>())) {
+            if (!pollEventAddress<uint64_t>(hostAddress, waitValue, std::greater_equal<uint64_t>(), blockingPoll)) {
                 signaled = false;
                 break;
             }
@@ -275,7 +285,7 @@ void EventImp<TagSizeT>::handleSuccessfulHostSynchronization() {
 }
 
 template <typename TagSizeT>
-ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
+ze_result_t EventImp<TagSizeT>::queryStatusEventPackets(bool blockingPoll) {
     assignKernelEventCompletionData(this->hostAddress);
     uint32_t queryVal = Event::STATE_CLEARED;
     uint32_t packets = 0;
@@ -285,10 +295,11 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
             void const *queryAddress = isUsingContextEndOffset()
                                            ? kernelEventCompletionData[i].getContextEndAddress(packetId)
                                            : kernelEventCompletionData[i].getContextStartAddress(packetId);
-            bool ready = NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
+            bool ready = pollEventAddress<TagSizeT>(
                 static_cast<TagSizeT const *>(queryAddress),
                 queryVal,
-                std::not_equal_to<TagSizeT>());
+                std::not_equal_to<TagSizeT>(),
+                blockingPoll);
             if (!ready) {
                 return ZE_RESULT_NOT_READY;
             }
@@ -301,10 +312,11 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
             remainingPacketSyncAddress = ptrOffset(remainingPacketSyncAddress, this->getCompletionFieldOffset());
             for (uint32_t i = 0; i < remainingPackets; i++) {
                 void const *queryAddress = remainingPacketSyncAddress;
-                bool ready = NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
+                bool ready = pollEventAddress<TagSizeT>(
                     static_cast<TagSizeT const *>(queryAddress),
                     queryVal,
-                    std::not_equal_to<TagSizeT>());
+                    std::not_equal_to<TagSizeT>(),
+                    blockingPoll);
                 if (!ready) {
                     return ZE_RESULT_NOT_READY;
                 }
@@ -379,14 +391,24 @@ bool EventImp<TagSizeT>::handlePreQueryStatusOperationsAndCheckCompletion() {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryStatus() {
+    return queryStatusImpl(true);
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryStatusNonBlocking() {
+    return queryStatusImpl(false);
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryStatusImpl(bool blockingPoll) {
     if (handlePreQueryStatusOperationsAndCheckCompletion()) {
         return ZE_RESULT_SUCCESS;
     }
 
     if (isCounterBased() || this->inOrderExecInfo.get()) {
-        return queryCounterBasedEventStatus();
+        return queryCounterBasedEventStatus(blockingPoll);
     } else {
-        return queryStatusEventPackets();
+        return queryStatusEventPackets(blockingPoll);
     }
 }
 
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_pool_allocation_cache.h"
+
+#include "shared/source/memory_manager/memory_manager.h"
+
+namespace L0 {
+
+bool EventPoolAllocationCache::Key::operator==(const Key &other) const {
+    return size == other.size &&
+           allocationType == other.allocationType &&
+           deviceAllocation == other.deviceAllocation &&
+           devices == other.devices;
+}
+
+std::unique_ptr<NEO::MultiGraphicsAllocation> EventPoolAllocationCache::obtain(const Key &key, void *&hostPtr) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto it = entries.rbegin(); it != entries.rend(); it++) {
+        if (it->key == key) {
+            auto allocations = std::move(it->allocations);
+            hostPtr = it->hostPtr;
+            entries.erase(std::next(it).base());
+            return allocations;
+        }
+    }
+    return nullptr;
+}
+
+bool EventPoolAllocationCache::store(const Key &key, std::unique_ptr<NEO::MultiGraphicsAllocation> &allocations, void *hostPtr) {
+    if (key.size > maxCachedAllocationSize) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (entries.size() >= maxCachedAllocations) {
+        return false;
+    }
+    entries.push_back({key, std::move(allocations), hostPtr});
+    return true;
+}
+
+void EventPoolAllocationCache::cleanup(NEO::MemoryManager &memoryManager) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &entry : entries) {
+        for (auto graphicsAllocation : entry.allocations->getGraphicsAllocations()) {
+            memoryManager.freeGraphicsMemory(graphicsAllocation);
+        }
+    }
+    entries.clear();
+}
+
+size_t EventPoolAllocationCache::getNumCachedAllocations() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+} // namespace L0
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/allocation_type.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class MemoryManager;
+} // namespace NEO
+
+namespace L0 {
+struct Device;
+
+// Keeps allocations of destroyed event pools, so pools created again with the same devices, flags,
+// event count and packet size reuse them instead of allocating. Contents are not preserved -
+// every event resets its packets on creation.
+class EventPoolAllocationCache {
+  public:
+    static constexpr size_t maxCachedAllocations = 64u;
+    static constexpr size_t maxCachedAllocationSize = MemoryConstants::pageSize2M;
+
+    struct Key {
+        std::vector<Device *> devices;
+        size_t size = 0u;
+        NEO::AllocationType allocationType = NEO::AllocationType::unknown;
+        bool deviceAllocation = false;
+
+        bool operator==(const Key &other) const;
+    };
+
+    std::unique_ptr<NEO::MultiGraphicsAllocation> obtain(const Key &key, void *&hostPtr);
+    bool store(const Key &key, std::unique_ptr<NEO::MultiGraphicsAllocation> &allocations, void *hostPtr);
+    void cleanup(NEO::MemoryManager &memoryManager);
+
+    size_t getNumCachedAllocations();
+
+  protected:
+    struct Entry {
+        Key key;
+        std::unique_ptr<NEO::MultiGraphicsAllocation> allocations;
+        void *hostPtr = nullptr;
+    };
+
+    std::vector<Entry> entries;
+    std::mutex mtx;
+};
+
+} // namespace L0
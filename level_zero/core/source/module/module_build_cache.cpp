@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/module/module_build_cache.h"
+
+namespace L0 {
+
+std::shared_ptr<const ModuleBuildCacheEntry> ModuleBuildCache::find(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    lruList.splice(lruList.begin(), lruList, it->second);
+    return it->second->second;
+}
+
+bool ModuleBuildCache::insert(const std::string &key, std::shared_ptr<const ModuleBuildCacheEntry> entry) {
+    if (entry == nullptr) {
+        return false;
+    }
+    const auto entrySize = getEntrySize(key, *entry);
+    if (entrySize > maxSize) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (entries.find(key) != entries.end()) {
+        return true;
+    }
+
+    evictUntilFits(entrySize);
+    lruList.emplace_front(key, std::move(entry));
+    entries.emplace(key, lruList.begin());
+    usedSize += entrySize;
+    return true;
+}
+
+void ModuleBuildCache::evictUntilFits(size_t requiredSize) {
+    while (!lruList.empty() && usedSize + requiredSize > maxSize) {
+        auto &leastRecentlyUsed = lruList.back();
+        usedSize -= getEntrySize(leastRecentlyUsed.first, *leastRecentlyUsed.second);
+        entries.erase(leastRecentlyUsed.first);
+        lruList.pop_back();
+    }
+}
+
+size_t ModuleBuildCache::getUsedSize() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return usedSize;
+}
+
+size_t ModuleBuildCache::getEntriesCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+} // namespace L0
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace L0 {
+
+struct ModuleBuildCacheEntry {
+    std::unique_ptr<char[]> irBinary;
+    size_t irBinarySize = 0U;
+
+    std::unique_ptr<char[]> unpackedDeviceBinary;
+    size_t unpackedDeviceBinarySize = 0U;
+
+    std::unique_ptr<char[]> debugData;
+    size_t debugDataSize = 0U;
+
+    std::string buildLog;
+
+    size_t getSize() const {
+        return irBinarySize + unpackedDeviceBinarySize + debugDataSize + buildLog.size();
+    }
+};
+
+// In-process cache of compiler outputs shared by all modules created through one driver handle.
+// It sits in front of the on-disk compiler cache, so a repeated build of the same input with the same
+// options on the same device skips compiler invocation, cache file hashing and file I/O entirely.
+// Entries are immutable once inserted and are evicted in least recently used order.
+// Only compiler outputs are cached. Decoded program info and kernel ISA stay per module, because linking
+// patches relocations and global surface addresses into them, so every module still decodes its own copy.
+class ModuleBuildCache {
+  public:
+    ModuleBuildCache(size_t maxSize) : maxSize(maxSize) {}
+
+    std::shared_ptr<const ModuleBuildCacheEntry> find(const std::string &key);
+    bool insert(const std::string &key, std::shared_ptr<const ModuleBuildCacheEntry> entry);
+
+    size_t getMaxSize() const { return maxSize; }
+    size_t getUsedSize();
+    size_t getEntriesCount();
+
+  protected:
+    using LruList = std::list<std::pair<std::string, std::shared_ptr<const ModuleBuildCacheEntry>>>;
+
+    static size_t getEntrySize(const std::string &key, const ModuleBuildCacheEntry &entry) {
+        return key.size() + entry.getSize();
+    }
+
+    void evictUntilFits(size_t requiredSize);
+
+    std::mutex mutex;
+    LruList lruList;
+    std::unordered_map<std::string, LruList::iterator> entries;
+    const size_t maxSize;
+    size_t usedSize = 0U;
+};
+
+} // namespace L0
@@ -41,13 +41,17 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/mapped_file.h"
+#include "shared/source/utilities/parallel_for.h"
 
+#include "level_zero/api/driver_experimental/public/zex_module.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
+#include "level_zero/core/source/module/module_build_cache.h"
 #include "level_zero/core/source/module/module_build_log.h"
 
 #include "program_debug_data.h"
@@ -198,6 +202,23 @@ ze_result_t ModuleTranslationUnit::compileGenBinary(NEO::TranslationInput &input
 
     inputArgs.specializedValues = this->specConstantsValues;
 
+    auto moduleBuildCache = inputArgs.allowCaching ? driverHandle->moduleBuildCache.get() : nullptr;
+    std::string buildCacheKey;
+    if (moduleBuildCache) {
+        buildCacheKey = generateBuildCacheKey(inputArgs, staticLink);
+        auto cachedBuild = moduleBuildCache->find(buildCacheKey);
+        if (cachedBuild) {
+            this->updateBuildLog(cachedBuild->buildLog);
+            this->irBinary = makeCopy(cachedBuild->irBinary.get(), cachedBuild->irBinarySize);
+            this->irBinarySize = cachedBuild->irBinarySize;
+            this->unpackedDeviceBinary = makeCopy(cachedBuild->unpackedDeviceBinary.get(), cachedBuild->unpackedDeviceBinarySize);
+            this->unpackedDeviceBinarySize = cachedBuild->unpackedDeviceBinarySize;
+            this->debugData = makeCopy(cachedBuild->debugData.get(), cachedBuild->debugDataSize);
+            this->debugDataSize = cachedBuild->debugDataSize;
+            return processUnpackedBinary();
+        }
+    }
+
     NEO::TranslationOutput compilerOuput = {};
     NEO::TranslationOutput::ErrorCode compilerErr;
 
@@ -207,6 +228,7 @@ ze_result_t ModuleTranslationUnit::compileGenBinary(NEO::TranslationInput &input
         compilerErr = compilerInterface->build(*device->getNEODevice(), inputArgs, compilerOuput);
     }
 
+    const auto buildLogOffset = this->buildLog.size();
     this->updateBuildLog(compilerOuput.frontendCompilerLog);
     this->updateBuildLog(compilerOuput.backendCompilerLog);
 
@@ -222,9 +244,42 @@ ze_result_t ModuleTranslationUnit::compileGenBinary(NEO::TranslationInput &input
     this->debugData = std::move(compilerOuput.debugData.mem);
     this->debugDataSize = compilerOuput.debugData.size;
 
+    if (moduleBuildCache) {
+        auto cachedBuild = std::make_shared<ModuleBuildCacheEntry>();
+        cachedBuild->buildLog = this->buildLog.substr(buildLogOffset);
+        cachedBuild->irBinary = makeCopy(this->irBinary.get(), this->irBinarySize);
+        cachedBuild->irBinarySize = this->irBinarySize;
+        cachedBuild->unpackedDeviceBinary = makeCopy(this->unpackedDeviceBinary.get(), this->unpackedDeviceBinarySize);
+        cachedBuild->unpackedDeviceBinarySize = this->unpackedDeviceBinarySize;
+        cachedBuild->debugData = makeCopy(this->debugData.get(), this->debugDataSize);
+        cachedBuild->debugDataSize = this->debugDataSize;
+        moduleBuildCache->insert(buildCacheKey, std::move(cachedBuild));
+    }
+
     return processUnpackedBinary();
 }
 
+std::string ModuleTranslationUnit::generateBuildCacheKey(const NEO::TranslationInput &inputArgs, bool staticLink) const {
+    std::vector<std::pair<uint32_t, uint64_t>> specializedValues(inputArgs.specializedValues.begin(), inputArgs.specializedValues.end());
+    std::sort(specializedValues.begin(), specializedValues.end());
+
+    std::string key;
+    auto appendField = [&key](const void *data, size_t size) {
+        key.append(reinterpret_cast<const char *>(&size), sizeof(size));
+        key.append(reinterpret_cast<const char *>(data), size);
+    };
+    const uintptr_t deviceId = reinterpret_cast<uintptr_t>(this->device);
+    appendField(&deviceId, sizeof(deviceId));
+    appendField(&staticLink, sizeof(staticLink));
+    appendField(&inputArgs.srcType, sizeof(inputArgs.srcType));
+    appendField(&inputArgs.outType, sizeof(inputArgs.outType));
+    appendField(inputArgs.apiOptions.begin(), inputArgs.apiOptions.size());
+    appendField(inputArgs.internalOptions.begin(), inputArgs.internalOptions.size());
+    appendField(specializedValues.data(), specializedValues.size() * sizeof(specializedValues[0]));
+    appendField(inputArgs.src.begin(), inputArgs.src.size());
+    return key;
+}
+
 ze_result_t ModuleTranslationUnit::staticLinkSpirV(std::vector<const char *> inputSpirVs, std::vector<uint32_t> inputModuleSizes, const char *buildOptions, const char *internalBuildOptions,
                                                    std::vector<const ze_module_constants_t *> specConstants) {
     auto compilerInterface = device->getNEODevice()->getCompilerInterface();
@@ -327,20 +382,22 @@ ze_result_t ModuleTranslationUnit::createFromNativeBinary(const char *input, siz
             return ZE_RESULT_ERROR_INVALID_NATIVE_BINARY;
         }
         if ((false == singleDeviceBinary.deviceBinary.empty()) && (false == rebuild)) {
-            this->unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
-            this->unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
             // If the Native Binary was an Archive, then packedTargetDeviceBinary will be the packed Binary for the Target Device.
-            if (singleDeviceBinary.packedTargetDeviceBinary.size() > 0) {
-                this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.packedTargetDeviceBinary.begin()), singleDeviceBinary.packedTargetDeviceBinary.size());
-                this->packedDeviceBinarySize = singleDeviceBinary.packedTargetDeviceBinary.size();
+            auto packedBinary = (singleDeviceBinary.packedTargetDeviceBinary.size() > 0) ? singleDeviceBinary.packedTargetDeviceBinary : archive;
+            bool isInputMapped = (nullptr != this->mappedNativeBinary) && (this->mappedNativeBinary->getData().begin() == archive.begin());
+            if (isInputMapped) {
+                this->unpackedDeviceBinaryInMappedFile = reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin());
+                this->packedDeviceBinaryInMappedFile = reinterpret_cast<const char *>(packedBinary.begin());
             } else {
-                this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
-                this->packedDeviceBinarySize = archive.size();
+                this->unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
+                this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(packedBinary.begin()), packedBinary.size());
             }
+            this->unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
+            this->packedDeviceBinarySize = packedBinary.size();
         }
     }
 
-    if (nullptr == this->unpackedDeviceBinary) {
+    if (nullptr == this->getUnpackedDeviceBinary()) {
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", NEO::CompilerWarnings::recompiledFromIr.data());
         if (!shouldSuppressRebuildWarning) {
             updateBuildLog(NEO::CompilerWarnings::recompiledFromIr.str());
@@ -356,13 +413,31 @@ ze_result_t ModuleTranslationUnit::createFromNativeBinary(const char *input, siz
     }
 }
 
+ze_result_t ModuleTranslationUnit::createFromNativeBinaryFile(const char *filePath) {
+    this->mappedNativeBinary = NEO::MappedFile::create(filePath);
+    if (nullptr == this->mappedNativeBinary) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto nativeBinary = this->mappedNativeBinary->getData();
+    return this->createFromNativeBinary(reinterpret_cast<const char *>(nativeBinary.begin()), nativeBinary.size());
+}
+
+const char *ModuleTranslationUnit::getUnpackedDeviceBinary() const {
+    return (nullptr != this->unpackedDeviceBinary) ? this->unpackedDeviceBinary.get() : this->unpackedDeviceBinaryInMappedFile;
+}
+
+const char *ModuleTranslationUnit::getPackedDeviceBinary() const {
+    return (nullptr != this->packedDeviceBinary) ? this->packedDeviceBinary.get() : this->packedDeviceBinaryInMappedFile;
+}
+
 ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     const auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
     if (0 == unpackedDeviceBinarySize) {
         driverHandle->clearErrorDescription();
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     }
-    auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+    auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->getUnpackedDeviceBinary()), this->unpackedDeviceBinarySize);
     NEO::SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     binary.targetDevice = NEO::getTargetDevice(device->getNEODevice()->getRootDeviceEnvironment());
@@ -425,14 +500,14 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
         kernelInfo->apply(deviceInfoConstants);
     }
 
-    if (this->packedDeviceBinary != nullptr) {
+    if (this->getPackedDeviceBinary() != nullptr) {
         return ZE_RESULT_SUCCESS;
     }
 
     NEO::SingleDeviceBinary singleDeviceBinary = {};
     singleDeviceBinary.targetDevice = NEO::getTargetDevice(device->getNEODevice()->getRootDeviceEnvironment());
     singleDeviceBinary.buildOptions = this->options;
-    singleDeviceBinary.deviceBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+    singleDeviceBinary.deviceBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->getUnpackedDeviceBinary()), this->unpackedDeviceBinarySize);
     singleDeviceBinary.intermediateRepresentation = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->irBinary.get()), this->irBinarySize);
     singleDeviceBinary.debugData = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->debugData.get()), this->debugDataSize);
     std::string packWarnings;
@@ -543,7 +618,7 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
         return result;
     }
 
-    auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->unpackedDeviceBinary.get(), translationUnit->unpackedDeviceBinarySize);
+    auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->getUnpackedDeviceBinary(), translationUnit->unpackedDeviceBinarySize);
     if (NEO::isDeviceBinaryFormat<NEO::DeviceBinaryFormat::zebin>(refBin)) {
         isZebinBinary = true;
     }
@@ -592,16 +667,18 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
         auto isaBuffer = std::vector<std::byte>(isaBufferSize);
         std::memset(isaBuffer.data(), 0x0, isaBufferSize);
         auto moduleOffset = sharedIsaAllocation->getOffset();
-        for (auto &kernelImmData : this->kernelImmDatas) {
+        auto moduleAllocation = this->sharedIsaAllocation->getGraphicsAllocation();
+        moduleAllocation->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+        moduleAllocation->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+
+        NEO::parallelFor(this->kernelImmDatas.size(), [&](size_t kernelId) {
+            auto &kernelImmData = this->kernelImmDatas[kernelId];
             DEBUG_BREAK_IF(kernelImmData->isIsaCopiedToAllocation());
-            kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
-            kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
 
             auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
             auto isaOffset = kernelImmData->getIsaOffsetInParentAllocation() - moduleOffset;
             memcpy_s(isaBuffer.data() + isaOffset, isaBufferSize - isaOffset, kernelHeapPtr, kernelHeapSize);
-        }
-        auto moduleAllocation = this->sharedIsaAllocation->getGraphicsAllocation();
+        });
         auto lock = this->sharedIsaAllocation->obtainSharedAllocationLock();
         NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *moduleAllocation),
                                                               *neoDevice,
@@ -653,7 +730,15 @@ inline ze_result_t ModuleImp::initializeTranslationUnit(const ze_module_desc_t *
     std::string buildOptions;
     std::string internalBuildOptions;
 
-    if (desc->pNext) {
+    const zex_module_file_exp_desc_t *moduleFileDesc = nullptr;
+    if (desc->pNext && (reinterpret_cast<const ze_base_desc_t *>(desc->pNext)->stype == ZEX_INTEL_STRUCTURE_TYPE_MODULE_FILE_EXP_DESC)) {
+        moduleFileDesc = reinterpret_cast<const zex_module_file_exp_desc_t *>(desc->pNext);
+        if ((desc->format != ZE_MODULE_FORMAT_NATIVE) || (nullptr == moduleFileDesc->pFilePath)) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    if (desc->pNext && (nullptr == moduleFileDesc)) {
         const ze_base_desc_t *expDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
         if (expDesc->stype != ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC) {
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -731,6 +816,9 @@ inline ze_result_t ModuleImp::initializeTranslationUnit(const ze_module_desc_t *
             this->isFunctionSymbolExportEnabled = true;
             this->isGlobalSymbolExportEnabled = true;
             this->precompiled = true;
+            if (nullptr != moduleFileDesc) {
+                return this->translationUnit->createFromNativeBinaryFile(moduleFileDesc->pFilePath);
+            }
             return this->translationUnit->createFromNativeBinary(reinterpret_cast<const char *>(desc->pInputModule), desc->inputSize);
         } else if (desc->format == ZE_MODULE_FORMAT_IL_SPIRV) {
             this->builtFromSpirv = true;
@@ -806,11 +894,19 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
         kernelsChunks[i] = {chunkOffset, chunkSize};
     }
 
+    size_t minKernelsCountForIsaPacking = defaultMinKernelsCountForIsaPacking;
+    if (NEO::debugManager.flags.ModuleIsaPackingMinKernelsCount.get() != -1) {
+        minKernelsCountForIsaPacking = static_cast<size_t>(NEO::debugManager.flags.ModuleIsaPackingMinKernelsCount.get());
+    }
+    auto neoDevice = this->device->getNEODevice();
+    auto &isaAllocator = neoDevice->getIsaPoolAllocator();
+    bool isBuiltin = (this->type == ModuleType::builtin);
+    bool packIsaOfManyKernels = (minKernelsCountForIsaPacking > 0u) && (kernelsCount >= minKernelsCountForIsaPacking) &&
+                                (kernelsIsaTotalSize <= isaAllocator.getAllocationSize(isBuiltin));
+
     bool debuggerDisabled = (this->device->getL0Debugger() == nullptr);
-    if (debuggerDisabled && kernelsIsaTotalSize <= isaAllocationPageSize) {
-        auto neoDevice = this->device->getNEODevice();
-        auto &isaAllocator = neoDevice->getIsaPoolAllocator();
-        auto crossModuleAllocation = isaAllocator.requestGraphicsAllocationForIsa(this->type == ModuleType::builtin, kernelsIsaTotalSize);
+    if (debuggerDisabled && (kernelsIsaTotalSize <= isaAllocationPageSize || packIsaOfManyKernels)) {
+        auto crossModuleAllocation = isaAllocator.requestGraphicsAllocationForIsa(isBuiltin, kernelsIsaTotalSize);
         if (crossModuleAllocation == nullptr) {
             return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
         }
@@ -855,7 +951,7 @@ NEO::GraphicsAllocation *ModuleImp::allocateKernelsIsaMemory(size_t size) {
 }
 
 void ModuleImp::createDebugZebin() {
-    auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->unpackedDeviceBinary.get(), translationUnit->unpackedDeviceBinarySize);
+    auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->getUnpackedDeviceBinary(), translationUnit->unpackedDeviceBinarySize);
     auto segments = getZebinSegments();
     auto debugZebin = NEO::Zebin::Debug::createDebugZebin(refBin, segments);
 
@@ -1010,7 +1106,7 @@ ze_result_t ModuleImp::destroyPrintfKernel(ze_kernel_handle_t kernelHandle) {
 }
 
 ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBinary) {
-    auto genBinary = this->translationUnit->packedDeviceBinary.get();
+    auto genBinary = this->translationUnit->getPackedDeviceBinary();
 
     *pSize = this->translationUnit->packedDeviceBinarySize;
     if (pModuleNativeBinary != nullptr) {
@@ -1105,13 +1201,16 @@ bool ModuleImp::linkBinary() {
     Linker::KernelDescriptorsT kernelDescriptors;
 
     if (linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
-        patchedIsaTempStorage.reserve(this->kernelImmDatas.size());
+        patchedIsaTempStorage.resize(this->kernelImmDatas.size());
         kernelDescriptors.reserve(this->kernelImmDatas.size());
+        NEO::parallelFor(kernelImmDatas.size(), [&](size_t i) {
+            auto &kernHeapInfo = this->translationUnit->programInfo.kernelInfos.at(i)->heapInfo;
+            const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
+            patchedIsaTempStorage[i].assign(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize);
+        });
         for (size_t i = 0; i < kernelImmDatas.size(); i++) {
             auto kernelInfo = this->translationUnit->programInfo.kernelInfos.at(i);
             auto &kernHeapInfo = kernelInfo->heapInfo;
-            const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
-            patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize));
             uintptr_t isaAddressToPatch = 0;
             if (useFullAddress) {
                 isaAddressToPatch = static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddress() +
@@ -1121,7 +1220,7 @@ bool ModuleImp::linkBinary() {
                                                            kernelImmDatas.at(i)->getIsaOffsetInParentAllocation());
             }
 
-            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), isaAddressToPatch, kernHeapInfo.kernelHeapSize});
+            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage[i].data(), isaAddressToPatch, kernHeapInfo.kernelHeapSize});
             kernelDescriptors.push_back(&kernelInfo->kernelDescriptor);
         }
     }
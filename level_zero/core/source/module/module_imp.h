@@ -23,6 +23,7 @@
 
 namespace NEO {
 struct KernelDescriptor;
+class MappedFile;
 class SharedIsaAllocation;
 
 namespace Zebin::Debug {
@@ -54,13 +55,17 @@ struct ModuleTranslationUnit {
     MOCKABLE_VIRTUAL ze_result_t staticLinkSpirV(std::vector<const char *> inputSpirVs, std::vector<uint32_t> inputModuleSizes, const char *buildOptions, const char *internalBuildOptions,
                                                  std::vector<const ze_module_constants_t *> specConstants);
     MOCKABLE_VIRTUAL ze_result_t createFromNativeBinary(const char *input, size_t inputSize);
+    MOCKABLE_VIRTUAL ze_result_t createFromNativeBinaryFile(const char *filePath);
     MOCKABLE_VIRTUAL ze_result_t processUnpackedBinary();
     std::vector<uint8_t> generateElfFromSpirV(std::vector<const char *> inputSpirVs, std::vector<uint32_t> inputModuleSizes);
     bool processSpecConstantInfo(NEO::CompilerInterface *compilerInterface, const ze_module_constants_t *pConstants, const char *input, uint32_t inputSize);
     std::string generateCompilerOptions(const char *buildOptions, const char *internalBuildOptions);
     MOCKABLE_VIRTUAL ze_result_t compileGenBinary(NEO::TranslationInput &inputArgs, bool staticLink);
+    std::string generateBuildCacheKey(const NEO::TranslationInput &inputArgs, bool staticLink) const;
     void updateBuildLog(const std::string &newLogEntry);
     void processDebugData();
+    const char *getUnpackedDeviceBinary() const;
+    const char *getPackedDeviceBinary() const;
     L0::Device *device = nullptr;
 
     NEO::GraphicsAllocation *globalConstBuffer = nullptr;
@@ -81,6 +86,11 @@ struct ModuleTranslationUnit {
     std::unique_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
 
+    // When created from a file, device binaries point into the mapping instead of being copied
+    std::unique_ptr<NEO::MappedFile> mappedNativeBinary;
+    const char *unpackedDeviceBinaryInMappedFile = nullptr;
+    const char *packedDeviceBinaryInMappedFile = nullptr;
+
     std::unique_ptr<char[]> debugData;
     size_t debugDataSize = 0U;
     std::vector<char *> alignedvIsas;
@@ -91,6 +101,8 @@ struct ModuleTranslationUnit {
 };
 
 struct ModuleImp : public Module {
+    static constexpr size_t defaultMinKernelsCountForIsaPacking = 64u;
+
     ModuleImp() = delete;
 
     ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType type);
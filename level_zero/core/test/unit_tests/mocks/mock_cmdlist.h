@@ -101,9 +101,11 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::isTbxMode;
     using BaseClass::isTimestampEventForMultiTile;
     using BaseClass::latestOperationRequiredNonWalkerInOrderCmdsChaining;
+    using BaseClass::mutableKernelDispatches;
     using BaseClass::obtainKernelPreemptionMode;
     using BaseClass::partitionCount;
     using BaseClass::patternAllocations;
+    using BaseClass::pendingMutableCommandId;
     using BaseClass::pipeControlMultiKernelEventSync;
     using BaseClass::pipelineSelectStateTracking;
     using BaseClass::requiredStreamState;
@@ -206,6 +208,8 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::getDcFlushRequired;
     using BaseClass::getHostPtrAlloc;
     using BaseClass::getInOrderIncrementValue;
+    using BaseClass::graphCaptureList;
+    using BaseClass::graphCaptureSignaledEvents;
     using BaseClass::hostSynchronize;
     using BaseClass::immediateCmdListHeapSharing;
     using BaseClass::inOrderAtomicSignalingEnabled;
@@ -360,6 +364,10 @@ struct MockCommandList : public CommandList {
     ADDMETHOD_NOBASE(appendEventReset, ze_result_t, ZE_RESULT_SUCCESS,
                      (ze_event_handle_t hEvent));
 
+    ADDMETHOD_NOBASE(appendEventsReset, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint32_t numEvents,
+                      ze_event_handle_t *phEvents));
+
     ADDMETHOD_NOBASE(appendBarrier, ze_result_t, ZE_RESULT_SUCCESS,
                      (ze_event_handle_t hSignalEvent,
                       uint32_t numWaitEvents,
@@ -2069,7 +2069,7 @@ TEST_F(CommandListCreate, givenImmediateCommandListWhenThereIsNoEnoughSpaceForIm
     whiteBoxCmdList->getCsr(false)->getInternalAllocationStorage()->getTemporaryAllocations().freeAllGraphicsAllocations(device->getNEODevice());
 }
 
-TEST_F(CommandListCreate, whenCreatingImmediateCommandListAndAppendCommandListsThenReturnsUnsupported) {
+TEST_F(CommandListCreate, whenCreatingImmediateCommandListAndAppendCommandListsWithoutCommandListsThenReturnsInvalidArgument) {
     const ze_command_queue_desc_t desc = {};
     ze_result_t returnValue;
     std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
@@ -2077,7 +2077,7 @@ TEST_F(CommandListCreate, whenCreatingImmediateCommandListAndAppendCommandListsT
 
     EXPECT_TRUE(commandList->isImmediateType());
     auto result = commandList->appendCommandLists(0u, nullptr, nullptr, 0u, nullptr);
-    EXPECT_EQ(result, ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    EXPECT_EQ(result, ZE_RESULT_ERROR_INVALID_ARGUMENT);
 }
 
 TEST_F(CommandListCreate, givenCreatingRegularCommandlistAndppendCommandListsThenReturnInvalidArgument) {
@@ -1568,6 +1568,60 @@ HWTEST2_F(ImmediateCommandListHostSynchronize, givenGpuStatusIsHangThenDeviceLos
     EXPECT_EQ(waitForFlushTagUpdateCalled, 1u);
 }
 
+HWTEST2_F(ImmediateCommandListHostSynchronize, givenSyncModeWhenFlushingThenCsrOwnershipIsReleasedBeforeWaitingForCompletion, IsAtLeastSkl) {
+    auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getInternalEngine().commandStreamReceiver);
+
+    auto cmdList = createCmdList<gfxCoreFamily>(csr);
+    cmdList->isSyncModeQueue = true;
+    cmdList->callBaseExecute = true;
+
+    csr->callBaseWaitForCompletionWithTimeout = false;
+    csr->checkOwnershipOnWaitForCompletion = true;
+    csr->ownershipHeldOnWaitForCompletion = true;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr, false));
+
+    EXPECT_EQ(1u, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, csr->waitForCompletionWithTimeoutTaskCountCalled);
+    EXPECT_FALSE(csr->ownershipHeldOnWaitForCompletion);
+}
+
+HWTEST2_F(ImmediateCommandListHostSynchronize, givenMultipleThreadsWithOwnImmediateCommandListsOnSameCsrWhenAppendingConcurrentlyThenAllSubmissionsAreFlushed, IsAtLeastSkl) {
+    auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getInternalEngine().commandStreamReceiver);
+
+    constexpr uint32_t numThreads = 8u;
+    constexpr uint32_t numSubmissionsPerThread = 16u;
+
+    std::vector<std::unique_ptr<MockCommandListImmediateHw<gfxCoreFamily>>> cmdLists;
+    for (uint32_t i = 0; i < numThreads; i++) {
+        cmdLists.push_back(createCmdList<gfxCoreFamily>(csr));
+        cmdLists.back()->callBaseExecute = true;
+    }
+
+    auto initialTaskCount = csr->peekTaskCount();
+
+    std::atomic<uint32_t> failedSubmissions{0u};
+    std::vector<std::thread> threads;
+    for (auto &cmdList : cmdLists) {
+        threads.emplace_back([&cmdList, &failedSubmissions]() {
+            for (uint32_t i = 0; i < numSubmissionsPerThread; i++) {
+                if (cmdList->appendBarrier(nullptr, 0, nullptr, false) != ZE_RESULT_SUCCESS) {
+                    failedSubmissions++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, failedSubmissions);
+    EXPECT_EQ(initialTaskCount + numThreads * numSubmissionsPerThread, csr->peekTaskCount());
+    for (auto &cmdList : cmdLists) {
+        EXPECT_EQ(numSubmissionsPerThread, cmdList->executeCommandListImmediateWithFlushTaskCalledCount);
+    }
+}
+
 HWTEST2_F(ImmediateCommandListHostSynchronize, givenTimeoutOtherThanMaxIsProvidedWaitParamsIsSetCorrectly, IsAtLeastSkl) {
     auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getInternalEngine().commandStreamReceiver);
 
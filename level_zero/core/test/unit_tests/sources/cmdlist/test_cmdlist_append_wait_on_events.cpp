@@ -208,10 +208,18 @@ HWTEST2_F(CommandListAppendWaitOnEvent, givenImmediateCmdListAndAppendingRegular
     std::unique_ptr<L0::CommandList> immCommandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
     ASSERT_NE(nullptr, immCommandList);
 
+    Mock<CommandQueue> mockCommandQueue(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    auto oldCommandQueue = immCommandList->cmdQImmediate;
+    immCommandList->cmdQImmediate = &mockCommandQueue;
+
+    commandList->close();
+    ze_command_list_handle_t hCommandList = commandList->toHandle();
     ze_event_handle_t hEventHandle = event->toHandle();
-    auto result = immCommandList->appendCommandLists(0u, nullptr, nullptr, 1u, &hEventHandle);
+    auto result = immCommandList->appendCommandLists(1u, &hCommandList, nullptr, 1u, &hEventHandle);
+    immCommandList->cmdQImmediate = oldCommandQueue;
 
-    ASSERT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, result);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, mockCommandQueue.executeCommandListsCalled);
 
     auto usedSpaceAfter = immCommandList->getCmdContainer().getCommandStream()->getUsed();
 
@@ -19,6 +19,7 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_built_ins.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 
+#include <algorithm>
 #include <limits>
 
 namespace L0 {
@@ -390,5 +391,72 @@ HWTEST2_F(AppendFillTest,
                                            false);
 }
 
+HWTEST2_F(AppendFillTest,
+          givenEventsFromOnePoolWhenAppendingEventsResetThenSingleFillKernelIsDispatchedPerContiguousRange, IsAtLeastSkl) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 4;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    std::unique_ptr<L0::Event> events[3];
+    ze_event_handle_t eventHandles[3] = {};
+    uint32_t eventIndices[3] = {3, 0, 1};
+    for (uint32_t i = 0; i < 3; i++) {
+        ze_event_desc_t eventDesc = {};
+        eventDesc.index = eventIndices[i];
+        events[i].reset(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+        eventHandles[i] = events[i]->toHandle();
+    }
+
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    result = commandList->appendEventsReset(3, eventHandles);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_EQ(2u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+    EXPECT_EQ(1u, commandList->threadGroupDimensions[0].groupCountX);
+    EXPECT_EQ(2u * eventPool->getEventSize() / (4 * sizeof(uint32_t)), commandList->xGroupSizes[0]);
+    EXPECT_EQ(1u, commandList->threadGroupDimensions[1].groupCountX);
+    EXPECT_EQ(eventPool->getEventSize() / (4 * sizeof(uint32_t)), commandList->xGroupSizes[1]);
+
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+    auto poolAllocation = eventPool->getAllocation().getGraphicsAllocation(device->getNEODevice()->getRootDeviceIndex());
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), poolAllocation));
+}
+
+HWTEST2_F(AppendFillTest,
+          givenEventsWith64BitPacketsWhenAppendingEventsResetThenPostSyncOperationsAreUsedInsteadOfFillKernel, IsAtLeastSkl) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 2;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    std::unique_ptr<L0::Event> events[2];
+    ze_event_handle_t eventHandles[2] = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        ze_event_desc_t eventDesc = {};
+        eventDesc.index = i;
+        events[i].reset(L0::Event::create<uint64_t>(eventPool.get(), &eventDesc, device));
+        eventHandles[i] = events[i]->toHandle();
+    }
+
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    auto usedSpaceBefore = commandList->commandContainer.getCommandStream()->getUsed();
+    result = commandList->appendEventsReset(2, eventHandles);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_EQ(0u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+    EXPECT_GT(commandList->commandContainer.getCommandStream()->getUsed(), usedSpaceBefore);
+}
+
 } // namespace ult
 } // namespace L0
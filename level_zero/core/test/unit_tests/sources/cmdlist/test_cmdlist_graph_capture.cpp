@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/test/unit_tests/fixtures/in_order_cmd_list_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdqueue.h"
+#include "level_zero/core/test/unit_tests/sources/helper/ze_object_utils.h"
+
+namespace L0 {
+namespace ult {
+
+struct GraphCaptureFixture : public InOrderCmdListFixture {
+    template <typename GfxFamily>
+    std::unique_ptr<L0::EventPool> createRegularEvents(uint32_t numEvents, std::vector<DestroyableZeUniquePtr<L0::Event>> &regularEvents) {
+        ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+        eventPoolDesc.count = numEvents;
+
+        auto eventPool = std::unique_ptr<L0::EventPool>(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+
+        ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+        for (uint32_t i = 0; i < numEvents; i++) {
+            eventDesc.index = i;
+            regularEvents.emplace_back(DestroyableZeUniquePtr<L0::Event>(Event::create<typename GfxFamily::TimestampPacketType>(eventPool.get(), &eventDesc, device)));
+        }
+
+        return eventPool;
+    }
+
+    template <typename GfxFamily>
+    uint32_t countSemaphoresOnAddress(LinearStream &cmdStream, uint64_t address) {
+        using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
+
+        GenCmdList cmdList;
+        EXPECT_TRUE(GfxFamily::Parse::parseCommandBuffer(cmdList, cmdStream.getCpuBase(), cmdStream.getUsed()));
+
+        uint32_t semaphores = 0;
+        for (auto &semaphore : findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end())) {
+            if (genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphore)->getSemaphoreGraphicsAddress() == address) {
+                semaphores++;
+            }
+        }
+        return semaphores;
+    }
+};
+
+using GraphCaptureTests = GraphCaptureFixture;
+
+HWTEST2_F(GraphCaptureTests, givenGraphCaptureActiveWhenAppendingKernelThenItIsRecordedIntoGraphInsteadOfFlushed, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(immCmdList->getCsr(false));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+    ASSERT_NE(nullptr, immCmdList->graphCaptureList);
+    EXPECT_TRUE(static_cast<CommandListImp *>(immCmdList->graphCaptureList)->isInOrderExecutionEnabled());
+    EXPECT_FALSE(immCmdList->graphCaptureList->isImmediateType());
+
+    auto immCmdStream = immCmdList->getCmdContainer().getCommandStream();
+    auto usedBefore = immCmdStream->getUsed();
+    auto taskCountBefore = ultCsr->taskCount.load();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    EXPECT_EQ(usedBefore, immCmdStream->getUsed());
+    EXPECT_EQ(taskCountBefore, ultCsr->taskCount.load());
+    EXPECT_NE(0u, immCmdList->graphCaptureList->getCmdContainer().getCommandStream()->getUsed());
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->endGraphCapture(&hGraph));
+    ASSERT_NE(nullptr, hGraph);
+    EXPECT_EQ(nullptr, immCmdList->graphCaptureList);
+
+    CommandList::fromHandle(hGraph)->destroy();
+}
+
+HWTEST2_F(GraphCaptureTests, givenGraphCaptureStateWhenBeginningOrEndingCaptureAgainThenNotAvailableIsReturned, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, immCmdList->endGraphCapture(&hGraph));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, immCmdList->beginGraphCapture());
+}
+
+HWTEST2_F(GraphCaptureTests, givenRegularCmdListWhenBeginningGraphCaptureThenUnsupportedIsReturned, IsAtLeastSkl) {
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(false);
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, regularCmdList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, regularCmdList->endGraphCapture(&hGraph));
+}
+
+HWTEST2_F(GraphCaptureTests, givenInOrderGraphCaptureWhenWaitingOnEventSignaledEarlierInGraphThenWaitIsResolvedByInOrderExecution, IsAtLeastXeHpCore) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    std::vector<DestroyableZeUniquePtr<L0::Event>> regularEvents;
+    auto eventPool = createRegularEvents<FamilyType>(2, regularEvents);
+    auto hInternalEvent = regularEvents[0]->toHandle();
+    auto hExternalEvent = regularEvents[1]->toHandle();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, hInternalEvent, 0, nullptr, launchParams, false));
+    ASSERT_EQ(1u, immCmdList->graphCaptureSignaledEvents.size());
+    EXPECT_EQ(regularEvents[0].get(), immCmdList->graphCaptureSignaledEvents[0]);
+
+    ze_event_handle_t waitEvents[] = {hInternalEvent, hExternalEvent};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 2, waitEvents, launchParams, false));
+
+    auto graphCmdStream = immCmdList->graphCaptureList->getCmdContainer().getCommandStream();
+    EXPECT_EQ(0u, countSemaphoresOnAddress<FamilyType>(*graphCmdStream, regularEvents[0]->getCompletionFieldGpuAddress(device)));
+    EXPECT_NE(0u, countSemaphoresOnAddress<FamilyType>(*graphCmdStream, regularEvents[1]->getCompletionFieldGpuAddress(device)));
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->endGraphCapture(&hGraph));
+    EXPECT_TRUE(immCmdList->graphCaptureSignaledEvents.empty());
+
+    CommandList::fromHandle(hGraph)->destroy();
+}
+
+HWTEST2_F(GraphCaptureTests, givenEventSignaledInGraphWhenItIsResetInGraphThenItIsNoLongerTreatedAsSignaled, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    std::vector<DestroyableZeUniquePtr<L0::Event>> regularEvents;
+    auto eventPool = createRegularEvents<FamilyType>(1, regularEvents);
+    auto hEvent = regularEvents[0]->toHandle();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendSignalEvent(hEvent));
+    EXPECT_EQ(1u, immCmdList->graphCaptureSignaledEvents.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendEventReset(hEvent));
+    EXPECT_TRUE(immCmdList->graphCaptureSignaledEvents.empty());
+}
+
+HWTEST2_F(GraphCaptureTests, givenCapturedGraphWhenAppendedToInOrderImmediateCmdListThenItIsExecutedOnImmediateQueueAndCounterIsSignaled, IsAtLeastXeHpCore) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto mockCmdQ = static_cast<Mock<CommandQueue> *>(immCmdList->cmdQImmediate);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->endGraphCapture(&hGraph));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, immCmdList->appendCommandLists(0, nullptr, nullptr, 0, nullptr));
+
+    auto immCmdStream = immCmdList->getCmdContainer().getCommandStream();
+    auto offset = immCmdStream->getUsed();
+    auto counterBefore = immCmdList->inOrderExecInfo->getCounterValue();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendCommandLists(1, &hGraph, nullptr, 0, nullptr));
+    EXPECT_EQ(1u, mockCmdQ->executeCommandListsCalled);
+    EXPECT_EQ(counterBefore + 1, immCmdList->inOrderExecInfo->getCounterValue());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, ptrOffset(immCmdStream->getCpuBase(), offset), immCmdStream->getUsed() - offset));
+    EXPECT_NE(cmdList.end(), find<PIPE_CONTROL *>(cmdList.begin(), cmdList.end()));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendCommandLists(1, &hGraph, nullptr, 0, nullptr));
+    EXPECT_EQ(2u, mockCmdQ->executeCommandListsCalled);
+    EXPECT_EQ(counterBefore + 2, immCmdList->inOrderExecInfo->getCounterValue());
+
+    CommandList::fromHandle(hGraph)->destroy();
+}
+
+HWTEST2_F(GraphCaptureTests, givenGraphCaptureActiveWhenAppendingCommandListsThenUnsupportedIsReturned, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(false);
+    regularCmdList->close();
+    auto hRegularCmdList = regularCmdList->toHandle();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, immCmdList->appendCommandLists(1, &hRegularCmdList, nullptr, 0, nullptr));
+}
+
+HWTEST2_F(GraphCaptureTests, givenGraphCaptureApiWhenCalledWithInvalidArgumentsThenErrorIsReturned, IsAtLeastSkl) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListBeginGraphCapture(nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListEndGraphCapture(immCmdList->toHandle(), nullptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListBeginGraphCapture(immCmdList->toHandle()));
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListEndGraphCapture(immCmdList->toHandle(), &hGraph));
+    ASSERT_NE(nullptr, hGraph);
+
+    CommandList::fromHandle(hGraph)->destroy();
+}
+
+} // namespace ult
+} // namespace L0
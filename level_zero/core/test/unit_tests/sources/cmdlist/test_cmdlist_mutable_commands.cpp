@@ -0,0 +1,430 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
+#include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+
+#include <limits>
+
+namespace L0 {
+namespace ult {
+
+struct MutableCommandListFixture : public ModuleFixture {
+    void setUp() {
+        UnitTestSetter::disableHeapless(restorer);
+        ModuleFixture::setUp();
+
+        kernel.crossThreadData = std::make_unique<uint8_t[]>(crossThreadDataSize);
+        kernel.crossThreadDataSize = crossThreadDataSize;
+        kernel.groupSize[0] = 4;
+        kernel.groupSize[1] = 1;
+        kernel.groupSize[2] = 1;
+
+        NEO::ArgDescriptor valueArg(NEO::ArgDescriptor::argTValue);
+        NEO::ArgDescValue::Element element;
+        element.offset = valueArgOffset;
+        element.size = sizeof(uint32_t);
+        valueArg.as<NEO::ArgDescValue>().elements.push_back(element);
+        kernel.descriptor.payloadMappings.explicitArgs.push_back(valueArg);
+
+        NEO::ArgDescriptor pointerArg(NEO::ArgDescriptor::argTPointer);
+        pointerArg.as<NEO::ArgDescPointer>().stateless = pointerArgOffset;
+        pointerArg.as<NEO::ArgDescPointer>().pointerSize = sizeof(uint64_t);
+        kernel.descriptor.payloadMappings.explicitArgs.push_back(pointerArg);
+
+        auto &dispatchTraits = kernel.descriptor.payloadMappings.dispatchTraits;
+        for (uint32_t i = 0; i < 3; i++) {
+            dispatchTraits.globalWorkOffset[i] = static_cast<NEO::CrossThreadDataOffset>(i * sizeof(uint32_t));
+            dispatchTraits.numWorkGroups[i] = static_cast<NEO::CrossThreadDataOffset>(12 + i * sizeof(uint32_t));
+            dispatchTraits.globalWorkSize[i] = static_cast<NEO::CrossThreadDataOffset>(24 + i * sizeof(uint32_t));
+        }
+        dispatchTraits.workDim = 36;
+    }
+
+    void tearDown() {
+        ModuleFixture::tearDown();
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>> createMutableCommandList() {
+        auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+        commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+        commandList->enableMutableCommandList();
+        return commandList;
+    }
+
+    template <typename FamilyType>
+    std::unique_ptr<L0::Event> createEvent(L0::EventPool *eventPool, uint32_t index) {
+        ze_event_desc_t eventDesc = {};
+        eventDesc.index = index;
+        return std::unique_ptr<L0::Event>(Event::create<typename FamilyType::TimestampPacketType>(eventPool, &eventDesc, device));
+    }
+
+    std::unique_ptr<L0::EventPool> createEventPool(uint32_t count) {
+        ze_event_pool_desc_t eventPoolDesc = {};
+        eventPoolDesc.count = count;
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        auto eventPool = std::unique_ptr<L0::EventPool>(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+        return eventPool;
+    }
+
+    static constexpr uint32_t crossThreadDataSize = 128;
+    static constexpr NEO::CrossThreadDataOffset valueArgOffset = 64;
+    static constexpr NEO::CrossThreadDataOffset pointerArgOffset = 72;
+
+    DebugManagerStateRestore restorer;
+    Mock<::L0::KernelImp> kernel;
+};
+
+using MutableCommandListTest = Test<MutableCommandListFixture>;
+
+HWTEST2_F(MutableCommandListTest, givenCommandListCreatedWithoutMutableDescWhenGettingNextCommandIdThenUnsupportedFeatureIsReturned, IsAtLeastSkl) {
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableCommands(&mutableCommandsDesc));
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableCommandListWhenRequestingGroupSizeMutationThenUnsupportedFeatureIsReturned, IsAtLeastSkl) {
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE;
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextCommandId(&commandIdDesc, &commandId));
+    EXPECT_EQ(0u, commandList->pendingMutableCommandId);
+}
+
+HWTEST2_F(MutableCommandListTest, givenDevicePropertiesWithMutableCommandListPropertiesWhenQueriedThenSupportedFlagsAreLimitedToPlatformCapabilities, IsAtLeastSkl) {
+    ze_mutable_command_list_exp_properties_t mutableCommandListProperties = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_PROPERTIES};
+    mutableCommandListProperties.mutableCommandFlags = std::numeric_limits<uint32_t>::max();
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    deviceProperties.pNext = &mutableCommandListProperties;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, device->getProperties(&deviceProperties));
+
+    auto expectedFlags = L0GfxCoreHelper::getCmdListUpdateCapabilities(device->getNEODevice()->getRootDeviceEnvironment()) & CommandList::supportedMutableCommandFlags;
+    EXPECT_EQ(expectedFlags, mutableCommandListProperties.mutableCommandFlags);
+    EXPECT_EQ(0u, mutableCommandListProperties.mutableCommandFlags & ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE);
+    EXPECT_EQ(0u, mutableCommandListProperties.mutableCommandListFlags);
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelCommandWhenUpdatingValueAndPointerArgumentsThenIndirectCrossThreadDataIsPatched, IsAtLeastXeHpCore) {
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+    EXPECT_NE(0u, commandId);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+    EXPECT_EQ(0u, commandList->pendingMutableCommandId);
+
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+    ASSERT_NE(nullptr, mutableDispatch.indirectCrossThreadData);
+    EXPECT_EQ(0u, mutableDispatch.inlineCrossThreadDataSize);
+
+    void *buffer = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 4096u, &buffer));
+
+    uint32_t newValue = 0x1234;
+    ze_mutable_kernel_argument_exp_desc_t valueArgDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    valueArgDesc.commandId = commandId;
+    valueArgDesc.argIndex = 0;
+    valueArgDesc.argSize = sizeof(newValue);
+    valueArgDesc.pArgValue = &newValue;
+
+    ze_mutable_kernel_argument_exp_desc_t pointerArgDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    pointerArgDesc.commandId = commandId;
+    pointerArgDesc.argIndex = 1;
+    pointerArgDesc.argSize = sizeof(buffer);
+    pointerArgDesc.pArgValue = &buffer;
+    valueArgDesc.pNext = &pointerArgDesc;
+
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &valueArgDesc;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    auto indirectData = reinterpret_cast<uint8_t *>(mutableDispatch.indirectCrossThreadData);
+    EXPECT_EQ(newValue, *reinterpret_cast<uint32_t *>(ptrOffset(indirectData, valueArgOffset)));
+    EXPECT_EQ(reinterpret_cast<uint64_t>(buffer), *reinterpret_cast<uint64_t *>(ptrOffset(indirectData, pointerArgOffset)));
+
+    auto bufferAllocation = driverHandle->getSvmAllocsManager()->getSVMAlloc(buffer)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    auto &residencyContainer = commandList->getCmdContainer().getResidencyContainer();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), bufferAllocation));
+
+    valueArgDesc.argIndex = 2;
+    valueArgDesc.pNext = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    context->freeMem(buffer);
+}
+
+HWTEST2_F(MutableCommandListTest, givenKernelPassingInlineDataWhenUpdatingValueArgumentThenWalkerInlineDataAndIndirectDataArePatched, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    kernel.descriptor.kernelAttributes.flags.passInlineData = true;
+    auto inlineDataSize = static_cast<uint32_t>(DefaultWalkerType::getInlineDataSize());
+    auto &valueArg = kernel.descriptor.payloadMappings.explicitArgs[0].as<NEO::ArgDescValue>().elements[0];
+    valueArg.offset = 0;
+    valueArg.size = static_cast<uint16_t>(inlineDataSize + sizeof(uint32_t));
+
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+    EXPECT_EQ(inlineDataSize, mutableDispatch.inlineCrossThreadDataSize);
+
+    std::vector<uint8_t> newValue(valueArg.size);
+    for (size_t i = 0; i < newValue.size(); i++) {
+        newValue[i] = static_cast<uint8_t>(i + 1);
+    }
+    ze_mutable_kernel_argument_exp_desc_t valueArgDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    valueArgDesc.commandId = commandId;
+    valueArgDesc.argIndex = 0;
+    valueArgDesc.argSize = newValue.size();
+    valueArgDesc.pArgValue = newValue.data();
+
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &valueArgDesc;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    auto walker = reinterpret_cast<DefaultWalkerType *>(mutableDispatch.walker);
+    EXPECT_EQ(0, memcmp(walker->getInlineDataPointer(), newValue.data(), inlineDataSize));
+    EXPECT_EQ(0, memcmp(mutableDispatch.indirectCrossThreadData, newValue.data() + inlineDataSize, sizeof(uint32_t)));
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelCommandWhenUpdatingGroupCountAndGlobalOffsetThenWalkerAndCrossThreadDataArePatched, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT | ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+
+    ze_group_count_t newGroupCount{8, 2, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+
+    ze_mutable_global_offset_exp_desc_t globalOffsetDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC};
+    globalOffsetDesc.commandId = commandId;
+    globalOffsetDesc.offsetX = 5;
+    globalOffsetDesc.offsetY = 6;
+    globalOffsetDesc.offsetZ = 7;
+    groupCountDesc.pNext = &globalOffsetDesc;
+
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &groupCountDesc;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    auto walker = reinterpret_cast<DefaultWalkerType *>(mutableDispatch.walker);
+    EXPECT_EQ(8u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(1u, walker->getThreadGroupIdZDimension());
+
+    auto indirectData = reinterpret_cast<uint32_t *>(mutableDispatch.indirectCrossThreadData);
+    uint32_t expectedCrossThreadData[] = {5, 6, 7, 8, 2, 1, 32, 2, 1, 2};
+    for (uint32_t i = 0; i < sizeof(expectedCrossThreadData) / sizeof(uint32_t); i++) {
+        EXPECT_EQ(expectedCrossThreadData[i], indirectData[i]);
+    }
+}
+
+HWTEST2_F(MutableCommandListTest, givenKernelGroupSizeChangedAfterAppendWhenUpdatingGroupCountThenGroupSizeRecordedAtAppendIsUsed, IsAtLeastXeHpCore) {
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+    EXPECT_EQ(4u, mutableDispatch.groupSize[0]);
+    EXPECT_EQ(1u, mutableDispatch.groupSize[1]);
+    EXPECT_EQ(1u, mutableDispatch.groupSize[2]);
+
+    kernel.groupSize[0] = 16;
+    kernel.groupSize[1] = 2;
+
+    ze_group_count_t newGroupCount{8, 1, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &groupCountDesc;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    auto indirectData = reinterpret_cast<uint32_t *>(mutableDispatch.indirectCrossThreadData);
+    uint32_t expectedGlobalWorkSizeAndWorkDim[] = {32, 1, 1, 1};
+    for (uint32_t i = 0; i < sizeof(expectedGlobalWorkSizeAndWorkDim) / sizeof(uint32_t); i++) {
+        EXPECT_EQ(expectedGlobalWorkSizeAndWorkDim[i], indirectData[6 + i]);
+    }
+}
+
+HWTEST2_F(MutableCommandListTest, givenCommandRecordedWithoutGroupCountFlagWhenUpdatingGroupCountThenInvalidArgumentIsReturned, IsAtLeastXeHpCore) {
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    ze_group_count_t newGroupCount{8, 1, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &groupCountDesc;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    groupCountDesc.commandId = commandId + 1;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelCommandWhenUpdatingSignalEventThenWalkerPostSyncPointsToNewEvent, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+    commandList->signalAllEventPackets = false;
+
+    auto eventPool = createEventPool(2);
+    auto event = createEvent<FamilyType>(eventPool.get(), 0);
+    auto newEvent = createEvent<FamilyType>(eventPool.get(), 1);
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, event->toHandle(), 0, nullptr, launchParams, false));
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+    ASSERT_TRUE(mutableDispatch.signalEventMutable);
+    auto walker = reinterpret_cast<DefaultWalkerType *>(mutableDispatch.walker);
+    EXPECT_EQ(event->getGpuAddress(device), walker->getPostSync().getDestinationAddress());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommandSignalEvent(commandId, newEvent->toHandle()));
+    EXPECT_EQ(newEvent->getGpuAddress(device), walker->getPostSync().getDestinationAddress());
+    EXPECT_EQ(newEvent.get(), mutableDispatch.signalEvent);
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelCommandWhenUpdatingWaitEventsThenSemaphoresPointToNewEvents, IsAtLeastXeHpCore) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+
+    auto eventPool = createEventPool(3);
+    auto waitEvent = createEvent<FamilyType>(eventPool.get(), 0);
+    auto newWaitEvent = createEvent<FamilyType>(eventPool.get(), 1);
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_event_handle_t waitEvents[] = {waitEvent->toHandle()};
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 1, waitEvents, launchParams, false));
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+    ASSERT_TRUE(mutableDispatch.waitEventsMutable);
+    ASSERT_EQ(waitEvent->getPacketsToWait(), mutableDispatch.waitEventCommands.size());
+
+    ze_event_handle_t newWaitEvents[] = {newWaitEvent->toHandle()};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommandWaitEvents(commandId, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommandWaitEvents(commandId, 1, newWaitEvents));
+
+    for (uint32_t i = 0; i < mutableDispatch.waitEventCommands.size(); i++) {
+        auto semaphore = reinterpret_cast<MI_SEMAPHORE_WAIT *>(mutableDispatch.waitEventCommands[i].pDestination);
+        EXPECT_EQ(newWaitEvent->getCompletionFieldGpuAddress(device) + i * newWaitEvent->getSinglePacketSize(), semaphore->getSemaphoreGraphicsAddress());
+    }
+    EXPECT_EQ(newWaitEvent.get(), mutableDispatch.waitEvents[0]);
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableCommandListWithRecordedCommandsWhenResetThenRecordedCommandsAreDropped, IsAtLeastXeHpCore) {
+    auto commandList = createMutableCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, commandList->mutableKernelDispatches.size());
+
+    uint64_t nextCommandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &nextCommandId));
+    EXPECT_GT(nextCommandId, commandId);
+
+    commandList->reset();
+    EXPECT_EQ(0u, commandList->mutableKernelDispatches.size());
+    EXPECT_EQ(0u, commandList->pendingMutableCommandId);
+
+    uint32_t newValue = 1;
+    ze_mutable_kernel_argument_exp_desc_t valueArgDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    valueArgDesc.commandId = commandId;
+    valueArgDesc.argSize = sizeof(newValue);
+    valueArgDesc.pArgValue = &newValue;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &valueArgDesc;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+}
+
+} // namespace ult
+} // namespace L0
@@ -1322,6 +1322,7 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexDriverImportExternalPointer) expectedImport = L0::zexDriverImportExternalPointer;
     decltype(&zexDriverReleaseImportedPointer) expectedRelease = L0::zexDriverReleaseImportedPointer;
     decltype(&zexDriverGetHostPointerBaseAddress) expectedGet = L0::zexDriverGetHostPointerBaseAddress;
+    decltype(&zexDriverGetUsmAllocationCacheStats) expectedGetUsmAllocationCacheStats = L0::zexDriverGetUsmAllocationCacheStats;
     decltype(&zexKernelGetBaseAddress) expectedKernelGetBaseAddress = L0::zexKernelGetBaseAddress;
     decltype(&zeIntelGetDriverVersionString) expectedIntelGetDriverVersionString = zeIntelGetDriverVersionString;
     decltype(&zeIntelMediaCommunicationCreate) expectedIntelMediaCommunicationCreate = L0::zeIntelMediaCommunicationCreate;
@@ -1340,6 +1341,9 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexDriverGetHostPointerBaseAddress", &funPtr));
     EXPECT_EQ(expectedGet, reinterpret_cast<decltype(&zexDriverGetHostPointerBaseAddress)>(funPtr));
 
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexDriverGetUsmAllocationCacheStats", &funPtr));
+    EXPECT_EQ(expectedGetUsmAllocationCacheStats, reinterpret_cast<decltype(&zexDriverGetUsmAllocationCacheStats)>(funPtr));
+
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelGetBaseAddress", &funPtr));
     EXPECT_EQ(expectedKernelGetBaseAddress, reinterpret_cast<decltype(&zexKernelGetBaseAddress)>(funPtr));
 
@@ -1378,6 +1382,25 @@ TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenEx
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(DriverExperimentalApiTest, givenUsmAllocationCachesDisabledWhenGettingCacheStatsThenZeroedStatsAreReturned) {
+    zex_usm_allocation_cache_stats_t deviceCacheStats;
+    zex_usm_allocation_cache_stats_t hostCacheStats;
+    memset(&deviceCacheStats, 0xFF, sizeof(deviceCacheStats));
+    memset(&hostCacheStats, 0xFF, sizeof(hostCacheStats));
+
+    auto result = zexDriverGetUsmAllocationCacheStats(driverHandle, &deviceCacheStats, &hostCacheStats);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0u, deviceCacheStats.hits);
+    EXPECT_EQ(0u, deviceCacheStats.misses);
+    EXPECT_EQ(0u, deviceCacheStats.bytesHeld);
+    EXPECT_EQ(0u, hostCacheStats.hits);
+    EXPECT_EQ(0u, hostCacheStats.misses);
+    EXPECT_EQ(0u, hostCacheStats.bytesHeld);
+
+    result = zexDriverGetUsmAllocationCacheStats(driverHandle, nullptr, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+}
+
 TEST_F(DriverExperimentalApiTest, givenGetVersionStringAPIExistsThenGetCurrentVersionString) {
     size_t sizeOfDriverString = 0;
     auto result = zeIntelGetDriverVersionString(driverHandle, nullptr, &sizeOfDriverString);
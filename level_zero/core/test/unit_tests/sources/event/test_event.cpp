@@ -176,6 +176,60 @@ TEST_F(EventPoolCreate, GivenEventPoolThenAllocationContainsAtLeast16Bytes) {
               minAllocationSize);
 }
 
+TEST_F(EventPoolCreate, givenEventPoolAllocationReuseEnabledWhenPoolIsDestroyedAndCreatedAgainThenAllocationIsReused) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableEventPoolAllocationReuse.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 4};
+    auto rootDeviceIndex = device->getNEODevice()->getRootDeviceIndex();
+    auto &allocationCache = driverHandle->eventPoolAllocationCache;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex);
+
+    eventPool.reset();
+    EXPECT_EQ(1u, allocationCache.getNumCachedAllocations());
+
+    eventPool.reset(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(allocation, eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(0u, allocationCache.getNumCachedAllocations());
+
+    ze_event_handle_t eventHandle = nullptr;
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, 0, 0, 0};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &eventHandle));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::fromHandle(eventHandle)->queryStatus());
+    Event::fromHandle(eventHandle)->destroy();
+
+    eventPool.reset();
+    eventPoolDesc.flags |= ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+    eventPool.reset(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(allocation, eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(1u, allocationCache.getNumCachedAllocations());
+}
+
+TEST_F(EventPoolCreate, givenEventPoolAllocationReuseDisabledOrIpcPoolWhenPoolIsDestroyedThenAllocationIsNotCached) {
+    DebugManagerStateRestore restorer;
+    auto &allocationCache = driverHandle->eventPoolAllocationCache;
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 4};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    eventPool.reset();
+    EXPECT_EQ(0u, allocationCache.getNumCachedAllocations());
+
+    NEO::debugManager.flags.EnableEventPoolAllocationReuse.set(1);
+    eventPoolDesc.flags |= ZE_EVENT_POOL_FLAG_IPC;
+    eventPool.reset(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    eventPool.reset();
+    EXPECT_EQ(0u, allocationCache.getNumCachedAllocations());
+}
+
 TEST_F(EventPoolCreate, givenInvalidPNextWhenCreatingPoolThenIgnore) {
     ze_base_desc_t baseDesc = {ZE_STRUCTURE_TYPE_FORCE_UINT32};
 
@@ -1698,6 +1752,95 @@ TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutZeroWhenO
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+struct EventHostSynchronizeMultipleTest : public EventSynchronizeTest {
+    void SetUp() override {
+        EventSynchronizeTest::SetUp();
+
+        ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+        poolDesc.count = numEvents;
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        multiEventPool.reset(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &poolDesc, result));
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+        for (uint32_t i = 0; i < numEvents; i++) {
+            ze_event_desc_t desc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+            desc.index = i;
+            events[i].reset(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(multiEventPool.get(), &desc, device)));
+            ASSERT_NE(nullptr, events[i]);
+            events[i]->setUsingContextEndOffset(false);
+            eventHandles[i] = events[i]->toHandle();
+        }
+    }
+
+    void TearDown() override {
+        for (auto &multiEvent : events) {
+            multiEvent.reset();
+        }
+        multiEventPool.reset();
+        EventSynchronizeTest::TearDown();
+    }
+
+    void signal(uint32_t index) {
+        *static_cast<uint32_t *>(events[index]->getHostAddress()) = Event::STATE_SIGNALED;
+    }
+
+    static constexpr uint32_t numEvents = 256;
+    std::unique_ptr<L0::EventPool> multiEventPool;
+    std::unique_ptr<EventImp<uint32_t>> events[numEvents];
+    ze_event_handle_t eventHandles[numEvents] = {};
+};
+
+TEST_F(EventHostSynchronizeMultipleTest, givenInvalidArgumentsWhenHostSynchronizingMultipleEventsThenInvalidArgumentIsReturned) {
+    uint32_t signaledEventIndex = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(0, eventHandles, 0, false, &signaledEventIndex));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(numEvents, nullptr, 0, false, &signaledEventIndex));
+
+    ze_event_handle_t handles[2] = {eventHandles[0], nullptr};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(2, handles, 0, false, &signaledEventIndex));
+}
+
+TEST_F(EventHostSynchronizeMultipleTest, givenUnsignaledEventsWhenHostSynchronizingMultipleEventsWithTimeoutThenNotReadyIsReturned) {
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(numEvents, eventHandles, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(numEvents, eventHandles, 10, false, nullptr));
+
+    for (uint32_t i = 0; i < numEvents - 1; i++) {
+        signal(i);
+    }
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(numEvents, eventHandles, 10, true, nullptr));
+}
+
+TEST_F(EventHostSynchronizeMultipleTest, givenAllEventsSignaledWhenHostSynchronizingAllEventsThenSuccessIsReturned) {
+    for (uint32_t i = 0; i < numEvents; i++) {
+        signal(i);
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(numEvents, eventHandles, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(numEvents, eventHandles, std::numeric_limits<uint64_t>::max(), true, nullptr));
+}
+
+TEST_F(EventHostSynchronizeMultipleTest, givenOneEventSignaledWhenHostSynchronizingAnyEventThenIndexOfSignaledEventIsReturned) {
+    constexpr uint32_t signaledIndex = numEvents - 3;
+    signal(signaledIndex);
+
+    uint32_t signaledEventIndex = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(numEvents, eventHandles, std::numeric_limits<uint64_t>::max(), false, &signaledEventIndex));
+    EXPECT_EQ(signaledIndex, signaledEventIndex);
+}
+
+TEST_F(EventHostSynchronizeMultipleTest, givenGpuHangWhenHostSynchronizingMultipleEventsThenDeviceLostIsReturned) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = true;
+
+    events[numEvents - 1]->csrs[0] = csr.get();
+    for (uint32_t i = 0; i < numEvents; i++) {
+        events[i]->gpuHangCheckPeriod = 0ms;
+    }
+    for (uint32_t i = 0; i < numEvents - 1; i++) {
+        signal(i);
+    }
+
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, zexEventHostSynchronizeMultiple(numEvents, eventHandles, std::numeric_limits<uint64_t>::max(), true, nullptr));
+}
+
 TEST_F(EventUsedPacketSignalSynchronizeTest, givenInfiniteTimeoutWhenWaitingForNonTimestampEventCompletionThenReturnOnlyAfterAllEventPacketsAreCompleted) {
     constexpr uint32_t packetsInUse = 2;
     event->setPacketsInUse(packetsInUse);
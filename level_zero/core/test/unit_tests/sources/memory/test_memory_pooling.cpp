@@ -173,5 +173,89 @@ TEST_F(AllocUsmHostEnabledMemoryTest, givenDrmDriverModelWhenOpeningIpcHandleFro
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+struct AllocUsmDevicePoolsManagerMemoryTest : public AllocUsmPoolMemoryTest<0, 0> {
+    void SetUp() override {
+        NEO::debugManager.flags.EnableDeviceUsmAllocationPoolManager.set(32);
+        AllocUsmPoolMemoryTest<0, 0>::SetUp();
+    }
+};
+
+TEST_F(AllocUsmDevicePoolsManagerMemoryTest, givenPoolsManagerEnabledWhenCallingAllocDeviceMemThenUsePoolsManagerIfAllowed) {
+    ASSERT_EQ(numRootDevices, driverHandle->usmDeviceMemAllocPoolsManagers.size());
+    auto hDevice = driverHandle->devices[0]->toHandle();
+    auto poolsManager = driverHandle->usmDeviceMemAllocPoolsManagers[0].get();
+    EXPECT_TRUE(poolsManager->isInitialized());
+    EXPECT_EQ(0u, poolsManager->getPoolsCount());
+
+    const size_t allocationSize = 256u;
+    void *pooledAllocation = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_result_t result = context->allocDeviceMem(hDevice, &deviceDesc, allocationSize, 0u, &pooledAllocation);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, pooledAllocation);
+    EXPECT_TRUE(poolsManager->isInPool(pooledAllocation));
+    EXPECT_FALSE(driverHandle->usmDeviceMemAllocPoolsManagers[1]->isInPool(pooledAllocation));
+
+    void *base = nullptr;
+    size_t size = 0u;
+    result = context->getMemAddressRange(ptrOffset(pooledAllocation, allocationSize - 1), &base, &size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(pooledAllocation, base);
+    EXPECT_EQ(allocationSize, size);
+
+    void *notPooledAllocation = nullptr;
+    result = context->allocDeviceMem(hDevice, &deviceDesc, UsmMemAllocPool::allocationThreshold + 1u, 0u, &notPooledAllocation);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, notPooledAllocation);
+    EXPECT_FALSE(poolsManager->isInPool(notPooledAllocation));
+
+    void *uncachedAllocation = nullptr;
+    deviceDesc.flags = ZE_DEVICE_MEM_ALLOC_FLAG_BIAS_UNCACHED;
+    result = context->allocDeviceMem(hDevice, &deviceDesc, allocationSize, 0u, &uncachedAllocation);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, uncachedAllocation);
+    EXPECT_FALSE(poolsManager->isInPool(uncachedAllocation));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(pooledAllocation));
+    EXPECT_EQ(0u, poolsManager->getPooledAllocationSize(pooledAllocation));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(notPooledAllocation));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(uncachedAllocation));
+}
+
+TEST_F(AllocUsmDevicePoolsManagerMemoryTest, givenPooledAllocationOnSecondDeviceWhenQueryingAndFreeingThenPoolsManagerOfOwningDeviceIsUsed) {
+    ASSERT_EQ(numRootDevices, driverHandle->usmDeviceMemAllocPoolsManagers.size());
+    auto hDevice = driverHandle->devices[1]->toHandle();
+    auto poolsManager = driverHandle->usmDeviceMemAllocPoolsManagers[1].get();
+
+    const size_t allocationSize = 256u;
+    void *pooledAllocation = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_result_t result = context->allocDeviceMem(hDevice, &deviceDesc, allocationSize, 0u, &pooledAllocation);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, pooledAllocation);
+    EXPECT_TRUE(poolsManager->isInPool(pooledAllocation));
+
+    auto allocData = driverHandle->svmAllocsManager->getSVMAlloc(pooledAllocation);
+    EXPECT_EQ(poolsManager, driverHandle->getDeviceUsmAllocPoolsManager(allocData));
+    EXPECT_EQ(nullptr, driverHandle->getDeviceUsmAllocPoolsManager(nullptr));
+
+    void *base = nullptr;
+    size_t size = 0u;
+    result = context->getMemAddressRange(ptrOffset(pooledAllocation, allocationSize - 1), &base, &size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(pooledAllocation, base);
+    EXPECT_EQ(allocationSize, size);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(pooledAllocation));
+    EXPECT_EQ(0u, poolsManager->getPooledAllocationSize(pooledAllocation));
+    EXPECT_EQ(1u, poolsManager->getPoolsCount());
+}
+
+using AllocUsmDevicePoolsManagerDisabledMemoryTest = AllocUsmPoolMemoryTest<0, 0>;
+
+TEST_F(AllocUsmDevicePoolsManagerDisabledMemoryTest, givenDefaultSettingsWhenInitializingDriverHandleThenPoolsManagersAreNotCreated) {
+    EXPECT_TRUE(driverHandle->usmDeviceMemAllocPoolsManagers.empty());
+}
+
 } // namespace ult
-} // namespace L0
\ No newline at end of file
+} // namespace L0
@@ -21,6 +21,7 @@
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/os_interface/os_inc_base.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/source/utilities/mapped_file.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -3240,6 +3241,67 @@ HWTEST_F(ModuleTranslationUnitTest, WhenCreatingFromNativeBinaryThenSetsUpPacked
     EXPECT_NE(moduleTuValid.packedDeviceBinarySize, arData.size());
 }
 
+struct MockMappedFile : public NEO::MappedFile {
+    MockMappedFile(ArrayRef<const uint8_t> mockData) {
+        data = mockData;
+    }
+};
+
+HWTEST_F(ModuleTranslationUnitTest, givenMappedNativeBinaryWhenCreatingFromNativeBinaryThenDeviceBinariesPointIntoMappingWithoutCopies) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.elfHeader->machine = device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+
+    L0::ModuleTranslationUnit moduleTu(this->device);
+    moduleTu.mappedNativeBinary = std::make_unique<MockMappedFile>(ArrayRef<const uint8_t>(zebin.storage.data(), zebin.storage.size()));
+    auto result = moduleTu.createFromNativeBinary(reinterpret_cast<const char *>(zebin.storage.data()), zebin.storage.size());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_EQ(nullptr, moduleTu.unpackedDeviceBinary);
+    EXPECT_EQ(nullptr, moduleTu.packedDeviceBinary);
+    EXPECT_EQ(reinterpret_cast<const char *>(zebin.storage.data()), moduleTu.getUnpackedDeviceBinary());
+    EXPECT_EQ(zebin.storage.size(), moduleTu.unpackedDeviceBinarySize);
+    EXPECT_EQ(reinterpret_cast<const char *>(zebin.storage.data()), moduleTu.getPackedDeviceBinary());
+    EXPECT_EQ(zebin.storage.size(), moduleTu.packedDeviceBinarySize);
+}
+
+HWTEST_F(ModuleTranslationUnitTest, givenInputOutsideOfMappedNativeBinaryWhenCreatingFromNativeBinaryThenDeviceBinariesAreCopied) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.elfHeader->machine = device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+    auto mappedZebin = zebin.storage;
+
+    L0::ModuleTranslationUnit moduleTu(this->device);
+    moduleTu.mappedNativeBinary = std::make_unique<MockMappedFile>(ArrayRef<const uint8_t>(mappedZebin.data(), mappedZebin.size()));
+    auto result = moduleTu.createFromNativeBinary(reinterpret_cast<const char *>(zebin.storage.data()), zebin.storage.size());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_NE(nullptr, moduleTu.unpackedDeviceBinary);
+    EXPECT_NE(nullptr, moduleTu.packedDeviceBinary);
+    EXPECT_EQ(moduleTu.unpackedDeviceBinary.get(), moduleTu.getUnpackedDeviceBinary());
+    EXPECT_EQ(moduleTu.packedDeviceBinary.get(), moduleTu.getPackedDeviceBinary());
+}
+
+HWTEST_F(ModuleTranslationUnitTest, givenFileWhichCannotBeMappedWhenCreatingFromNativeBinaryFileThenInvalidArgumentIsReturned) {
+    L0::ModuleTranslationUnit moduleTu(this->device);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, moduleTu.createFromNativeBinaryFile(nullptr));
+    EXPECT_EQ(nullptr, moduleTu.mappedNativeBinary);
+}
+
+HWTEST_F(ModuleTranslationUnitTest, givenModuleFileDescWithNonNativeFormatOrWithoutPathWhenInitializingModuleThenInvalidArgumentIsReturned) {
+    zex_module_file_exp_desc_t moduleFileDesc = {};
+    moduleFileDesc.pFilePath = "module.bin";
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pNext = &moduleFileDesc;
+
+    auto module = new Module(device, nullptr, ModuleType::user);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, module->initialize(&moduleDesc, device->getNEODevice()));
+
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleFileDesc.pFilePath = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, module->initialize(&moduleDesc, device->getNEODevice()));
+    module->destroy();
+}
+
 HWTEST_F(ModuleTranslationUnitTest, WhenCreatingFromZebinThenDontAppendAllowZebinFlagToBuildOptions) {
     ZebinTestData::ValidEmptyProgram zebin;
 
@@ -4044,6 +4106,60 @@ struct ModuleIsaAllocationsFixture : public DeviceFixture {
         }
     }
 
+    void givenManyKernelIsasWhichExceedSinglePageWhenKernelImmutableDatasAreInitializedThenKernelIsasArePackedIntoSingleParentAllocation() {
+        DebugManagerStateRestore restorer;
+        debugManager.flags.ModuleIsaPackingMinKernelsCount.set(4);
+
+        auto maxAllocationSizeInPage = alignDown(isaAllocationPageSize - this->isaPadding, this->kernelStartPointerAlignment);
+        for (auto i = 0u; i < 4u; i++) {
+            this->prepareKernelInfoAndAddToTranslationUnit(maxAllocationSizeInPage);
+        }
+
+        this->mockModule->initializeKernelImmutableDatas();
+        auto &kernelImmDatas = this->mockModule->getKernelImmutableDataVector();
+        auto parentAllocation = kernelImmDatas[0]->getIsaParentAllocation();
+        ASSERT_NE(nullptr, parentAllocation);
+        size_t expectedIsaOffset = kernelImmDatas[0]->getIsaOffsetInParentAllocation();
+        for (auto &kernelImmData : kernelImmDatas) {
+            EXPECT_EQ(parentAllocation, kernelImmData->getIsaParentAllocation());
+            EXPECT_EQ(parentAllocation, kernelImmData->getIsaGraphicsAllocation());
+            EXPECT_EQ(expectedIsaOffset, kernelImmData->getIsaOffsetInParentAllocation());
+            expectedIsaOffset += kernelImmData->getIsaSubAllocationSize();
+        }
+    }
+
+    void givenManyKernelIsasWhichExceedIsaPoolSizeWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations() {
+        DebugManagerStateRestore restorer;
+        debugManager.flags.ModuleIsaPackingMinKernelsCount.set(2);
+
+        auto isaPoolSize = this->neoDevice->getIsaPoolAllocator().getAllocationSize(false);
+        for (auto i = 0u; i < 2u; i++) {
+            this->prepareKernelInfoAndAddToTranslationUnit(isaPoolSize / 2);
+        }
+
+        this->mockModule->initializeKernelImmutableDatas();
+        for (auto &kernelImmData : this->mockModule->getKernelImmutableDataVector()) {
+            EXPECT_EQ(nullptr, kernelImmData->getIsaParentAllocation());
+            EXPECT_NE(nullptr, kernelImmData->getIsaGraphicsAllocation());
+        }
+    }
+
+    void givenManyKernelIsasAndIsaPackingDisabledWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations() {
+        DebugManagerStateRestore restorer;
+        debugManager.flags.ModuleIsaPackingMinKernelsCount.set(0);
+
+        auto maxAllocationSizeInPage = alignDown(isaAllocationPageSize - this->isaPadding, this->kernelStartPointerAlignment);
+        for (auto i = 0u; i < ModuleImp::defaultMinKernelsCountForIsaPacking; i++) {
+            this->prepareKernelInfoAndAddToTranslationUnit(maxAllocationSizeInPage);
+        }
+
+        this->mockModule->initializeKernelImmutableDatas();
+        for (auto &kernelImmData : this->mockModule->getKernelImmutableDataVector()) {
+            EXPECT_EQ(nullptr, kernelImmData->getIsaParentAllocation());
+            EXPECT_NE(nullptr, kernelImmData->getIsaGraphicsAllocation());
+        }
+    }
+
     struct ProxyKernelImmutableData : public KernelImmutableData {
         using BaseClass = KernelImmutableData;
         using BaseClass::BaseClass;
@@ -4125,6 +4241,18 @@ TEST_F(ModuleIsaAllocationsInLocalMemoryTest, givenMultipleKernelIsasWhichExceed
     this->givenMultipleKernelIsasWhichExceedSinglePageWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations();
 }
 
+TEST_F(ModuleIsaAllocationsInLocalMemoryTest, givenManyKernelIsasWhichExceedSinglePage64KWhenKernelImmutableDatasAreInitializedThenKernelIsasArePackedIntoSingleParentAllocation) {
+    this->givenManyKernelIsasWhichExceedSinglePageWhenKernelImmutableDatasAreInitializedThenKernelIsasArePackedIntoSingleParentAllocation();
+}
+
+TEST_F(ModuleIsaAllocationsInLocalMemoryTest, givenManyKernelIsasWhichExceedIsaPoolSizeWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations) {
+    this->givenManyKernelIsasWhichExceedIsaPoolSizeWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations();
+}
+
+TEST_F(ModuleIsaAllocationsInLocalMemoryTest, givenManyKernelIsasAndIsaPackingDisabledWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations) {
+    this->givenManyKernelIsasAndIsaPackingDisabledWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations();
+}
+
 TEST_F(ModuleIsaAllocationsInLocalMemoryTest, givenMultipleKernelIsasWhenKernelInitializationFailsThenItIsProperlyCleanedAndPreviouslyInitializedKernelsLeftUntouched) {
     this->givenMultipleKernelIsasWhenKernelInitializationFailsThenItIsProperlyCleanedAndPreviouslyInitializedKernelsLeftUntouched();
 }
@@ -4180,6 +4308,18 @@ TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenMultipleKernelIsasWhichExcee
     this->givenMultipleKernelIsasWhichExceedSinglePageWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations();
 }
 
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenManyKernelIsasWhichExceedSinglePageWhenKernelImmutableDatasAreInitializedThenKernelIsasArePackedIntoSingleParentAllocation) {
+    this->givenManyKernelIsasWhichExceedSinglePageWhenKernelImmutableDatasAreInitializedThenKernelIsasArePackedIntoSingleParentAllocation();
+}
+
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenManyKernelIsasWhichExceedIsaPoolSizeWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations) {
+    this->givenManyKernelIsasWhichExceedIsaPoolSizeWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations();
+}
+
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenManyKernelIsasAndIsaPackingDisabledWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations) {
+    this->givenManyKernelIsasAndIsaPackingDisabledWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations();
+}
+
 TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenMultipleKernelIsasWhenKernelInitializationFailsThenItIsProperlyCleanedAndPreviouslyInitializedKernelsLeftUntouched) {
     this->givenMultipleKernelIsasWhenKernelInitializationFailsThenItIsProperlyCleanedAndPreviouslyInitializedKernelsLeftUntouched();
 }
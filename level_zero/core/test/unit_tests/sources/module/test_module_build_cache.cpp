@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/string.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/core/source/module/module_build_cache.h"
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_driver_handle.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+
+namespace L0 {
+namespace ult {
+
+std::shared_ptr<const ModuleBuildCacheEntry> createModuleBuildCacheEntry(size_t binarySize) {
+    auto entry = std::make_shared<ModuleBuildCacheEntry>();
+    entry->unpackedDeviceBinary = std::make_unique<char[]>(binarySize);
+    entry->unpackedDeviceBinarySize = binarySize;
+    return entry;
+}
+
+TEST(ModuleBuildCacheTest, givenEmptyCacheWhenFindingEntryThenNullptrIsReturned) {
+    ModuleBuildCache cache(1024u);
+    EXPECT_EQ(nullptr, cache.find("key"));
+    EXPECT_EQ(0u, cache.getEntriesCount());
+    EXPECT_EQ(0u, cache.getUsedSize());
+}
+
+TEST(ModuleBuildCacheTest, givenInsertedEntryWhenFindingSameKeyThenSameEntryIsReturned) {
+    ModuleBuildCache cache(1024u);
+    auto entry = createModuleBuildCacheEntry(16u);
+    EXPECT_TRUE(cache.insert("key", entry));
+
+    EXPECT_EQ(entry, cache.find("key"));
+    EXPECT_EQ(nullptr, cache.find("otherKey"));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_EQ(std::string("key").size() + 16u, cache.getUsedSize());
+}
+
+TEST(ModuleBuildCacheTest, givenKeyAlreadyPresentWhenInsertingThenExistingEntryIsKept) {
+    ModuleBuildCache cache(1024u);
+    auto entry = createModuleBuildCacheEntry(16u);
+    EXPECT_TRUE(cache.insert("key", entry));
+    EXPECT_TRUE(cache.insert("key", createModuleBuildCacheEntry(32u)));
+
+    EXPECT_EQ(entry, cache.find("key"));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+}
+
+TEST(ModuleBuildCacheTest, givenEntryBiggerThanCacheOrNullEntryWhenInsertingThenInsertFails) {
+    ModuleBuildCache cache(64u);
+    EXPECT_FALSE(cache.insert("key", createModuleBuildCacheEntry(64u)));
+    EXPECT_FALSE(cache.insert("key", nullptr));
+    EXPECT_EQ(0u, cache.getEntriesCount());
+}
+
+TEST(ModuleBuildCacheTest, givenFullCacheWhenInsertingThenLeastRecentlyUsedEntriesAreEvicted) {
+    ModuleBuildCache cache(3 * (1u + 30u));
+    auto entryA = createModuleBuildCacheEntry(30u);
+    auto entryB = createModuleBuildCacheEntry(30u);
+    auto entryC = createModuleBuildCacheEntry(30u);
+    EXPECT_TRUE(cache.insert("a", entryA));
+    EXPECT_TRUE(cache.insert("b", entryB));
+    EXPECT_TRUE(cache.insert("c", entryC));
+    EXPECT_EQ(cache.getMaxSize(), cache.getUsedSize());
+
+    EXPECT_EQ(entryA, cache.find("a"));
+
+    EXPECT_TRUE(cache.insert("d", createModuleBuildCacheEntry(30u)));
+    EXPECT_EQ(3u, cache.getEntriesCount());
+    EXPECT_EQ(entryA, cache.find("a"));
+    EXPECT_EQ(nullptr, cache.find("b"));
+    EXPECT_EQ(entryC, cache.find("c"));
+    EXPECT_NE(nullptr, cache.find("d"));
+
+    EXPECT_TRUE(cache.insert("e", createModuleBuildCacheEntry(2 * 30u)));
+    EXPECT_EQ(2u, cache.getEntriesCount());
+    EXPECT_EQ(nullptr, cache.find("a"));
+    EXPECT_EQ(nullptr, cache.find("c"));
+    EXPECT_NE(nullptr, cache.find("d"));
+    EXPECT_NE(nullptr, cache.find("e"));
+}
+
+TEST(ModuleBuildCacheTest, givenEvictedEntryStillReferencedWhenAccessingItThenDataRemainsValid) {
+    ModuleBuildCache cache(1u + 16u);
+    auto entry = std::make_shared<ModuleBuildCacheEntry>();
+    entry->unpackedDeviceBinary = makeCopy("0123456789abcde", 16u);
+    entry->unpackedDeviceBinarySize = 16u;
+    EXPECT_TRUE(cache.insert("a", std::move(entry)));
+
+    auto foundEntry = cache.find("a");
+    EXPECT_TRUE(cache.insert("b", createModuleBuildCacheEntry(16u)));
+    EXPECT_EQ(nullptr, cache.find("a"));
+
+    ASSERT_NE(nullptr, foundEntry);
+    EXPECT_STREQ("0123456789abcde", foundEntry->unpackedDeviceBinary.get());
+}
+
+struct MockCompilerInterfaceWithDeviceBinary : public MockCompilerInterface {
+    NEO::TranslationOutput::ErrorCode build(const NEO::Device &device,
+                                            const NEO::TranslationInput &input,
+                                            NEO::TranslationOutput &output) override {
+        buildCalled++;
+        output.deviceBinary.mem = makeCopy(deviceBinary, sizeof(deviceBinary));
+        output.deviceBinary.size = sizeof(deviceBinary);
+        output.backendCompilerLog = "backend log";
+        return MockCompilerInterface::build(device, input, output);
+    }
+
+    static constexpr char deviceBinary[] = "device binary";
+    uint32_t buildCalled = 0u;
+};
+
+using ModuleBuildCacheDisabledTest = Test<DeviceFixture>;
+
+TEST_F(ModuleBuildCacheDisabledTest, givenDefaultSettingsWhenDriverHandleIsInitializedThenModuleBuildCacheIsNotCreated) {
+    EXPECT_EQ(nullptr, driverHandle->moduleBuildCache.get());
+}
+
+struct ModuleBuildCacheEnabledFixture : public DeviceFixture {
+    void setUp() {
+        debugManager.flags.ModuleBuildInProcessCacheSize.set(1);
+        DeviceFixture::setUp();
+        mockCompiler = new MockCompilerInterfaceWithDeviceBinary();
+        neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0]->compilerInterface.reset(mockCompiler);
+    }
+
+    void tearDown() {
+        DeviceFixture::tearDown();
+    }
+
+    DebugManagerStateRestore restorer;
+    MockCompilerInterfaceWithDeviceBinary *mockCompiler = nullptr;
+};
+
+using ModuleBuildCacheIntegrationTest = Test<ModuleBuildCacheEnabledFixture>;
+
+TEST_F(ModuleBuildCacheIntegrationTest, givenModuleBuildInProcessCacheSizeSetWhenDriverHandleIsInitializedThenModuleBuildCacheIsCreated) {
+    ASSERT_NE(nullptr, driverHandle->moduleBuildCache.get());
+    EXPECT_EQ(MemoryConstants::megaByte, driverHandle->moduleBuildCache->getMaxSize());
+}
+
+TEST_F(ModuleBuildCacheIntegrationTest, givenModuleBuildCacheWhenBuildingSameSpirvTwiceThenCompilerIsInvokedOnceAndOutputIsReused) {
+    uint8_t spirvData[] = {0x7, 0x23, 0x2, 0x3};
+    MockModuleTranslationUnit firstTranslationUnit(device);
+    firstTranslationUnit.processUnpackedBinaryCallBase = false;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, firstTranslationUnit.buildFromSpirV(reinterpret_cast<const char *>(spirvData), sizeof(spirvData), "", "", nullptr));
+    EXPECT_EQ(1u, mockCompiler->buildCalled);
+    EXPECT_EQ(1u, driverHandle->moduleBuildCache->getEntriesCount());
+
+    MockModuleTranslationUnit secondTranslationUnit(device);
+    secondTranslationUnit.processUnpackedBinaryCallBase = false;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondTranslationUnit.buildFromSpirV(reinterpret_cast<const char *>(spirvData), sizeof(spirvData), "", "", nullptr));
+    EXPECT_EQ(1u, mockCompiler->buildCalled);
+    EXPECT_EQ(1u, secondTranslationUnit.processUnpackedBinaryCalled);
+
+    ASSERT_EQ(sizeof(MockCompilerInterfaceWithDeviceBinary::deviceBinary), secondTranslationUnit.unpackedDeviceBinarySize);
+    EXPECT_STREQ(MockCompilerInterfaceWithDeviceBinary::deviceBinary, secondTranslationUnit.unpackedDeviceBinary.get());
+    EXPECT_NE(firstTranslationUnit.unpackedDeviceBinary.get(), secondTranslationUnit.unpackedDeviceBinary.get());
+    EXPECT_EQ(firstTranslationUnit.buildLog, secondTranslationUnit.buildLog);
+}
+
+TEST_F(ModuleBuildCacheIntegrationTest, givenModuleBuildCacheWhenBuildingWithDifferentOptionsOrInputThenCompilerIsInvokedForEachBuild) {
+    uint8_t spirvData[] = {0x7, 0x23, 0x2, 0x3};
+    uint8_t otherSpirvData[] = {0x7, 0x23, 0x2, 0x4};
+    MockModuleTranslationUnit firstTranslationUnit(device);
+    firstTranslationUnit.processUnpackedBinaryCallBase = false;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, firstTranslationUnit.buildFromSpirV(reinterpret_cast<const char *>(spirvData), sizeof(spirvData), "", "", nullptr));
+
+    MockModuleTranslationUnit secondTranslationUnit(device);
+    secondTranslationUnit.processUnpackedBinaryCallBase = false;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondTranslationUnit.buildFromSpirV(reinterpret_cast<const char *>(spirvData), sizeof(spirvData), "-ze-opt-disable", "", nullptr));
+
+    MockModuleTranslationUnit thirdTranslationUnit(device);
+    thirdTranslationUnit.processUnpackedBinaryCallBase = false;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, thirdTranslationUnit.buildFromSpirV(reinterpret_cast<const char *>(otherSpirvData), sizeof(otherSpirvData), "", "", nullptr));
+
+    EXPECT_EQ(3u, mockCompiler->buildCalled);
+    EXPECT_EQ(3u, driverHandle->moduleBuildCache->getEntriesCount());
+}
+
+TEST_F(ModuleBuildCacheIntegrationTest, givenModuleBuildCacheWhenCachingIsNotAllowedThenCacheIsBypassed) {
+    uint8_t spirvData[] = {0x7, 0x23, 0x2, 0x3};
+    NEO::TranslationInput inputArgs = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    inputArgs.src = ArrayRef<const char>(reinterpret_cast<const char *>(spirvData), sizeof(spirvData));
+    inputArgs.allowCaching = false;
+
+    MockModuleTranslationUnit translationUnit(device);
+    translationUnit.processUnpackedBinaryCallBase = false;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, translationUnit.compileGenBinary(inputArgs, false));
+    translationUnit.unpackedDeviceBinary.reset();
+    translationUnit.unpackedDeviceBinarySize = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, translationUnit.compileGenBinary(inputArgs, false));
+
+    EXPECT_EQ(2u, mockCompiler->buildCalled);
+    EXPECT_EQ(0u, driverHandle->moduleBuildCache->getEntriesCount());
+}
+
+TEST_F(ModuleBuildCacheIntegrationTest, givenTranslationInputsDifferingInSingleFieldWhenGeneratingBuildCacheKeyThenKeysDiffer) {
+    uint8_t spirvData[] = {0x7, 0x23, 0x2, 0x3};
+    const char options[] = "-ze-opt-disable";
+    NEO::TranslationInput inputArgs = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    inputArgs.src = ArrayRef<const char>(reinterpret_cast<const char *>(spirvData), sizeof(spirvData));
+
+    ModuleTranslationUnit translationUnit(device);
+    const auto baseKey = translationUnit.generateBuildCacheKey(inputArgs, false);
+    EXPECT_EQ(baseKey, translationUnit.generateBuildCacheKey(inputArgs, false));
+    EXPECT_NE(baseKey, translationUnit.generateBuildCacheKey(inputArgs, true));
+
+    auto apiOptionsArgs = inputArgs;
+    apiOptionsArgs.apiOptions = ArrayRef<const char>(options, sizeof(options) - 1);
+    EXPECT_NE(baseKey, translationUnit.generateBuildCacheKey(apiOptionsArgs, false));
+
+    auto internalOptionsArgs = inputArgs;
+    internalOptionsArgs.internalOptions = ArrayRef<const char>(options, sizeof(options) - 1);
+    EXPECT_NE(baseKey, translationUnit.generateBuildCacheKey(internalOptionsArgs, false));
+    EXPECT_NE(translationUnit.generateBuildCacheKey(apiOptionsArgs, false), translationUnit.generateBuildCacheKey(internalOptionsArgs, false));
+
+    auto specConstantsArgs = inputArgs;
+    specConstantsArgs.specializedValues[1] = 2u;
+    EXPECT_NE(baseKey, translationUnit.generateBuildCacheKey(specConstantsArgs, false));
+
+    ModuleTranslationUnit otherDeviceTranslationUnit(reinterpret_cast<L0::Device *>(0x1234));
+    EXPECT_NE(baseKey, otherDeviceTranslationUnit.generateBuildCacheKey(inputArgs, false));
+}
+
+} // namespace ult
+} // namespace L0
@@ -4005,7 +4005,18 @@ CL_API_ENTRY void *CL_API_CALL clDeviceMemAllocINTEL(
         return allocationFromPool;
     }
 
+    auto &poolsManager = neoContext->getDeviceMemAllocPoolsManager();
+    allocationFromPool = poolsManager.createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    if (allocationFromPool) {
+        TRACING_EXIT(ClDeviceMemAllocINTEL, &allocationFromPool);
+        return allocationFromPool;
+    }
+
     auto ptr = neoContext->getSVMAllocsManager()->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    if (ptr == nullptr && poolsManager.isInitialized()) {
+        poolsManager.trim();
+        ptr = neoContext->getSVMAllocsManager()->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    }
     TRACING_EXIT(ClDeviceMemAllocINTEL, &ptr);
     return ptr;
 }
@@ -4090,6 +4101,10 @@ CL_API_ENTRY cl_int CL_API_CALL clMemFreeCommon(cl_context context,
         return CL_SUCCESS;
     }
 
+    if (ptr && neoContext->getDeviceMemAllocPoolsManager().freeSVMAlloc(const_cast<void *>(ptr), blocking)) {
+        return CL_SUCCESS;
+    }
+
     if (ptr && neoContext->getHostMemAllocPool().freeSVMAlloc(const_cast<void *>(ptr), blocking)) {
         return CL_SUCCESS;
     }
@@ -4186,6 +4201,11 @@ CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
             TRACING_EXIT(ClGetMemAllocInfoINTEL, &retVal);
             return retVal;
         }
+        if (auto basePtrFromDevicePoolsManager = pContext->getDeviceMemAllocPoolsManager().getPooledAllocationBasePtr(ptr)) {
+            retVal = changeGetInfoStatusToCLResultType(info.set<uint64_t>(castToUint64(basePtrFromDevicePoolsManager)));
+            TRACING_EXIT(ClGetMemAllocInfoINTEL, &retVal);
+            return retVal;
+        }
         if (auto basePtrFromHostPool = pContext->getHostMemAllocPool().getPooledAllocationBasePtr(ptr)) {
             retVal = changeGetInfoStatusToCLResultType(info.set<uint64_t>(castToUint64(basePtrFromHostPool)));
             TRACING_EXIT(ClGetMemAllocInfoINTEL, &retVal);
@@ -4206,6 +4226,11 @@ CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
             TRACING_EXIT(ClGetMemAllocInfoINTEL, &retVal);
             return retVal;
         }
+        if (auto sizeFromDevicePoolsManager = pContext->getDeviceMemAllocPoolsManager().getPooledAllocationSize(ptr)) {
+            retVal = changeGetInfoStatusToCLResultType(info.set<size_t>(sizeFromDevicePoolsManager));
+            TRACING_EXIT(ClGetMemAllocInfoINTEL, &retVal);
+            return retVal;
+        }
         if (auto sizeFromHostPool = pContext->getHostMemAllocPool().getPooledAllocationSize(ptr)) {
             retVal = changeGetInfoStatusToCLResultType(info.set<size_t>(sizeFromHostPool));
             TRACING_EXIT(ClGetMemAllocInfoINTEL, &retVal);
@@ -4920,6 +4945,8 @@ cl_int CL_API_CALL clEnqueueSVMMemcpy(cl_command_queue commandQueue,
     if (size != 0) {
         if (pCommandQueue->isValidForStagingBufferCopy(device, dstPtr, srcPtr, size, numEventsInWaitList > 0)) {
             retVal = pCommandQueue->enqueueStagingBufferMemcpy(blockingCopy, dstPtr, srcPtr, size, event);
+        } else if (blockingCopy && pCommandQueue->isValidForStagingBufferRead(dstPtr, srcPtr, numEventsInWaitList > 0)) {
+            retVal = pCommandQueue->enqueueStagingBufferRead(dstPtr, srcPtr, size, event);
         } else {
             retVal = pCommandQueue->enqueueSVMMemcpy(
                 blockingCopy,
@@ -1612,6 +1612,51 @@ cl_int CommandQueue::enqueueStagingBufferMemcpy(cl_bool blockingCopy, void *dstP
     return ret;
 }
 
+/*
+ * Blocking copy from device USM to non-USM memory through staging buffers.
+ * GPU transfer of each chunk is overlapped with CPU copy of previous chunk from staging buffer.
+ */
+cl_int CommandQueue::enqueueStagingBufferRead(void *dstPtr, const void *srcPtr, size_t size, cl_event *event) {
+    CsrSelectionArgs csrSelectionArgs{CL_COMMAND_SVM_MEMCPY, &size};
+    csrSelectionArgs.direction = TransferDirection::localToHost;
+    auto csr = &selectCsrForBuiltinOperation(csrSelectionArgs);
+
+    ChunkCopyFunction chunkRead = [&](void *chunkDst, void *stagingBuffer, const void *chunkSrc, size_t chunkSize) -> int32_t {
+        auto isLastTransfer = ptrOffset(chunkSrc, chunkSize) == ptrOffset(srcPtr, size);
+        cl_event *outEvent = nullptr;
+        if (isLastTransfer && !this->isOOQEnabled()) {
+            outEvent = event;
+        }
+        return this->enqueueSVMMemcpy(false, stagingBuffer, chunkSrc, chunkSize, 0, nullptr, outEvent);
+    };
+
+    auto stagingBufferManager = this->context->getStagingBufferManager();
+    auto ret = stagingBufferManager->performReadCopy(dstPtr, srcPtr, size, chunkRead, csr);
+    if (ret.waitStatus == WaitStatus::gpuHang) {
+        return CL_OUT_OF_RESOURCES;
+    }
+    if (ret.chunkCopyStatus != CL_SUCCESS) {
+        return ret.chunkCopyStatus;
+    }
+
+    if (event != nullptr && this->isOOQEnabled()) {
+        auto barrierRet = this->enqueueBarrierWithWaitList(0, nullptr, event);
+        if (barrierRet != CL_SUCCESS) {
+            return barrierRet;
+        }
+    }
+    return this->finish();
+}
+
+bool CommandQueue::isValidForStagingBufferRead(void *dstPtr, const void *srcPtr, bool hasDependencies) {
+    if (isProfilingEnabled()) {
+        return false;
+    }
+    auto stagingBufferManager = context->getStagingBufferManager();
+    UNRECOVERABLE_IF(stagingBufferManager == nullptr);
+    return stagingBufferManager->isValidForStagingRead(dstPtr, srcPtr, hasDependencies);
+}
+
 bool CommandQueue::isValidForStagingBufferCopy(Device &device, void *dstPtr, const void *srcPtr, size_t size, bool hasDependencies) {
     GraphicsAllocation *allocation = nullptr;
     context->tryGetExistingMapAllocation(srcPtr, size, allocation);
@@ -390,6 +390,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     cl_int enqueueStagingBufferMemcpy(cl_bool blockingCopy, void *dstPtr, const void *srcPtr, size_t size, cl_event *event);
     bool isValidForStagingBufferCopy(Device &device, void *dstPtr, const void *srcPtr, size_t size, bool hasDependencies);
+    cl_int enqueueStagingBufferRead(void *dstPtr, const void *srcPtr, size_t size, cl_event *event);
+    bool isValidForStagingBufferRead(void *dstPtr, const void *srcPtr, bool hasDependencies);
 
   protected:
     void *enqueueReadMemObjForMap(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet);
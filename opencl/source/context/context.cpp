@@ -518,7 +518,15 @@ void Context::initializeUsmAllocationPools() {
         enabled = debugManager.flags.EnableDeviceUsmAllocationPool.get() > 0;
         poolSize = debugManager.flags.EnableDeviceUsmAllocationPool.get() * MemoryConstants::megaByte;
     }
-    if (enabled) {
+    if (debugManager.flags.EnableDeviceUsmAllocationPoolManager.get() > 0) {
+        auto subDeviceBitfields = getDeviceBitfields();
+        auto &neoDevice = devices[0]->getDevice();
+        subDeviceBitfields[neoDevice.getRootDeviceIndex()] = neoDevice.getDeviceBitfield();
+        SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::deviceUnifiedMemory, MemoryConstants::pageSize2M,
+                                                                   getRootDeviceIndices(), subDeviceBitfields);
+        memoryProperties.device = &neoDevice;
+        usmDeviceMemAllocPoolsManager.initialize(svmMemoryManager, memoryProperties, debugManager.flags.EnableDeviceUsmAllocationPoolManager.get() * MemoryConstants::megaByte);
+    } else if (enabled) {
         auto subDeviceBitfields = getDeviceBitfields();
         auto &neoDevice = devices[0]->getDevice();
         subDeviceBitfields[neoDevice.getRootDeviceIndex()] = neoDevice.getDeviceBitfield();
@@ -547,6 +555,7 @@ void Context::initializeUsmAllocationPools() {
 
 void Context::cleanupUsmAllocationPools() {
     usmDeviceMemAllocPool.cleanup();
+    usmDeviceMemAllocPoolsManager.cleanup();
     usmHostMemAllocPool.cleanup();
 }
 
@@ -246,6 +246,9 @@ class Context : public BaseObject<_cl_context> {
     UsmMemAllocPool &getHostMemAllocPool() {
         return usmHostMemAllocPool;
     }
+    UsmMemAllocPoolsManager &getDeviceMemAllocPoolsManager() {
+        return usmDeviceMemAllocPoolsManager;
+    }
 
     TagAllocatorBase *getMultiRootDeviceTimestampPacketAllocator();
     std::unique_lock<std::mutex> obtainOwnershipForMultiRootDeviceAllocator();
@@ -295,6 +298,7 @@ class Context : public BaseObject<_cl_context> {
     BufferPoolAllocator smallBufferPoolAllocator;
     UsmDeviceMemAllocPool usmDeviceMemAllocPool;
     UsmHostMemAllocPool usmHostMemAllocPool;
+    UsmMemAllocPoolsManager usmDeviceMemAllocPoolsManager;
 
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     cl_bool preferD3dSharedResources = 0u;
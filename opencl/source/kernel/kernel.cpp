@@ -2385,7 +2385,11 @@ void Kernel::initializeLocalIdsCache() {
     auto simdSize = getDescriptor().kernelAttributes.simdSize;
     auto grfCount = getDescriptor().kernelAttributes.numGrfRequired;
     auto grfSize = static_cast<uint8_t>(getDevice().getHardwareInfo().capabilityTable.grfSize);
-    localIdsCache = std::make_unique<LocalIdsCache>(4, wgDimOrder, grfCount, simdSize, grfSize, usingImagesOnly);
+    size_t localIdsCacheSize = LocalIdsCache::defaultCacheSize;
+    if (debugManager.flags.LocalIdsCacheSize.get() > 0) {
+        localIdsCacheSize = static_cast<size_t>(debugManager.flags.LocalIdsCacheSize.get());
+    }
+    localIdsCache = std::make_unique<LocalIdsCache>(localIdsCacheSize, wgDimOrder, grfCount, simdSize, grfSize, usingImagesOnly);
 }
 
 void Kernel::setLocalIdsForGroup(const Vec3<uint16_t> &groupSize, void *destination) const {
@@ -2603,3 +2603,52 @@ HWTEST_F(StagingBufferTest, givenIsValidForStagingBufferCopyWhenSrcIsMappedThenR
     auto [buffer, mappedPtr] = createBufferAndMapItOnGpu();
     EXPECT_FALSE(myCmdQ.isValidForStagingBufferCopy(pClDevice->getDevice(), dstPtr, mappedPtr, buffer->getSize(), false));
 }
+
+HWTEST_F(StagingBufferTest, givenCmdQueueWhenEnqueueStagingBufferReadThenChunksAreTransferredAndFinishCalled) {
+    MockCommandQueueHw<FamilyType> myCmdQ(context, pClDevice, 0);
+    auto initialUsmAllocs = svmManager->getNumAllocs();
+    retVal = myCmdQ.enqueueStagingBufferRead(
+        srcPtr,   // void *dst_ptr
+        dstPtr,   // const void *src_ptr
+        copySize, // size_t size
+        nullptr   // cl_event *event
+    );
+    auto numOfStagingBuffers = svmManager->getNumAllocs() - initialUsmAllocs;
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(2u, numOfStagingBuffers);
+    EXPECT_EQ(expectedNumOfCopies, myCmdQ.enqueueSVMMemcpyCalledCount);
+    EXPECT_EQ(1u, myCmdQ.finishCalledCount);
+}
+
+HWTEST_F(StagingBufferTest, givenOutOfOrderCmdQueueWhenEnqueueStagingBufferReadWithEventThenBarrierEnqueued) {
+    constexpr cl_command_type expectedLastCmd = CL_COMMAND_BARRIER;
+
+    cl_event event;
+    MockCommandQueueHw<FamilyType> myCmdQ(context, pClDevice, 0);
+    myCmdQ.setOoqEnabled();
+    retVal = myCmdQ.enqueueStagingBufferRead(
+        srcPtr,   // void *dst_ptr
+        dstPtr,   // const void *src_ptr
+        copySize, // size_t size
+        &event    // cl_event *event
+    );
+    auto pEvent = (Event *)event;
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(expectedNumOfCopies, myCmdQ.enqueueSVMMemcpyCalledCount);
+    EXPECT_EQ(expectedLastCmd, pEvent->getCommandType());
+
+    clReleaseEvent(event);
+}
+
+HWTEST_F(StagingBufferTest, givenIsValidForStagingBufferReadWhenCalledThenReturnTrueOnlyIfEnabledAndProfilingDisabled) {
+    DebugManagerStateRestore restore{};
+    MockCommandQueueHw<FamilyType> myCmdQ(context, pClDevice, 0);
+    debugManager.flags.EnableReadWithStagingBuffers.set(0);
+    EXPECT_FALSE(myCmdQ.isValidForStagingBufferRead(srcPtr, dstPtr, false));
+
+    debugManager.flags.EnableReadWithStagingBuffers.set(1);
+    EXPECT_TRUE(myCmdQ.isValidForStagingBufferRead(srcPtr, dstPtr, false));
+
+    myCmdQ.setProfilingEnabled();
+    EXPECT_FALSE(myCmdQ.isValidForStagingBufferRead(srcPtr, dstPtr, false));
+}
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/api_specific_config.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_usm_memory_pool.h"
@@ -114,4 +115,42 @@ TEST_F(ContextUsmPoolEnabledFlagsTestDefault, givenDefaultDebugSettingsThenPoolI
 
     EXPECT_EQ(enabledDevice, mockDeviceUsmMemAllocPool->isInitialized());
     EXPECT_EQ(enabledHost, mockHostUsmMemAllocPool->isInitialized());
-}
\ No newline at end of file
+}
+struct ContextUsmPoolsManagerTest : public ContextUsmPoolFlagValuesTest<1, 0> {
+    void SetUp() override {
+        debugManager.flags.EnableDeviceUsmAllocationPoolManager.set(32);
+        ContextUsmPoolFlagValuesTest<1, 0>::SetUp();
+        mockDeviceUsmMemAllocPoolsManager = static_cast<MockUsmMemAllocPoolsManager *>(&mockContext->getDeviceMemAllocPoolsManager());
+    }
+
+    MockUsmMemAllocPoolsManager *mockDeviceUsmMemAllocPoolsManager;
+};
+
+TEST_F(ContextUsmPoolsManagerTest, givenPoolsManagerEnabledWhenAllocatingDeviceMemoryThenPoolsManagerIsUsedInsteadOfSinglePool) {
+    cl_int retVal = CL_SUCCESS;
+    const size_t allocationSize = 256u;
+    void *pooledDeviceAlloc = clDeviceMemAllocINTEL(mockContext.get(), static_cast<cl_device_id>(mockContext->getDevice(0)), nullptr, allocationSize, 0, &retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, pooledDeviceAlloc);
+
+    EXPECT_FALSE(mockDeviceUsmMemAllocPool->isInitialized());
+    EXPECT_TRUE(mockDeviceUsmMemAllocPoolsManager->isInitialized());
+    EXPECT_EQ(32 * MemoryConstants::megaByte, mockDeviceUsmMemAllocPoolsManager->maxPoolsSize);
+    EXPECT_TRUE(mockDeviceUsmMemAllocPoolsManager->isInPool(pooledDeviceAlloc));
+
+    size_t paramValue = 0u;
+    retVal = clGetMemAllocInfoINTEL(mockContext.get(), pooledDeviceAlloc, CL_MEM_ALLOC_SIZE_INTEL, sizeof(size_t), &paramValue, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(allocationSize, paramValue);
+
+    uint64_t basePtr = 0u;
+    retVal = clGetMemAllocInfoINTEL(mockContext.get(), ptrOffset(pooledDeviceAlloc, allocationSize - 1), CL_MEM_ALLOC_BASE_PTR_INTEL, sizeof(uint64_t), &basePtr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(castToUint64(pooledDeviceAlloc), basePtr);
+
+    EXPECT_EQ(CL_SUCCESS, clMemFreeINTEL(mockContext.get(), pooledDeviceAlloc));
+    EXPECT_EQ(0u, mockDeviceUsmMemAllocPoolsManager->getPooledAllocationSize(pooledDeviceAlloc));
+
+    mockContext->cleanupUsmAllocationPools();
+    EXPECT_FALSE(mockDeviceUsmMemAllocPoolsManager->isInitialized());
+}
@@ -15,6 +15,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/kernel/implicit_args_helper.h"
+#include "shared/source/kernel/local_ids_cache.h"
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
@@ -4000,3 +4001,18 @@ TEST(KernelTest, whenCallingGetEnqueuedLocalWorkSizeValuesThenReturnProperValues
     EXPECT_EQ(expectedELWS[1], *(enqueuedLocalWorkSize[1]));
     EXPECT_EQ(expectedELWS[2], *(enqueuedLocalWorkSize[2]));
 }
+
+TEST(KernelTest, givenLocalIdsCacheSizeDebugFlagWhenKernelIsCreatedThenLocalIdsCacheWithRequestedSizeIsUsed) {
+    DebugManagerStateRestore restorer;
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(NEO::defaultHwInfo.get()));
+    {
+        MockKernelWithInternals kernel(*device);
+        ASSERT_NE(nullptr, kernel.mockKernel->localIdsCache.get());
+        EXPECT_EQ(LocalIdsCache::defaultCacheSize, kernel.mockKernel->localIdsCache->getCacheSize());
+    }
+
+    debugManager.flags.LocalIdsCacheSize.set(64);
+    MockKernelWithInternals kernel(*device);
+    ASSERT_NE(nullptr, kernel.mockKernel->localIdsCache.get());
+    EXPECT_EQ(64u, kernel.mockKernel->localIdsCache->getCacheSize());
+}
@@ -286,6 +286,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             memcpy_s(ptr, sizeCrossThreadData,
                      crossThreadData, sizeCrossThreadData);
         }
+        args.outCrossThreadDataPtr = ptr;
 
         auto perThreadDataPtr = args.dispatchInterface->getPerThreadData();
         if (perThreadDataPtr != nullptr) {
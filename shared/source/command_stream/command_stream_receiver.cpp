@@ -71,6 +71,9 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
     if (debugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)debugManager.flags.CsrDispatchMode.get();
     }
+    if (debugManager.flags.EnableAdaptiveWaitPolicy.get() != -1) {
+        this->adaptiveWaitPolicyEnabled = !!debugManager.flags.EnableAdaptiveWaitPolicy.get();
+    }
     flushStamp.reset(new FlushStampTracker(true));
     for (int i = 0; i < IndirectHeap::Type::numTypes; ++i) {
         indirectHeap[i] = nullptr;
@@ -497,12 +500,24 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
 
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
+    currentTime = waitStartTime;
+    bool waited = false;
     for (uint32_t i = 0; i < activePartitions; i++) {
         while (*partitionAddress < taskCountToWait && timeDiff <= params.waitTimeout) {
             this->downloadTagAllocation(taskCountToWait);
-
-            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait)) {
-                break;
+            waited = true;
+
+            if (!params.indefinitelyPoll) {
+                bool completed = false;
+                if (this->adaptiveWaitPolicyEnabled) {
+                    auto waitTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+                    completed = WaitUtils::waitFunctionWithPolicy(partitionAddress, taskCountToWait, this->waitPolicy, waitTimeNs);
+                } else {
+                    completed = WaitUtils::waitFunction(partitionAddress, taskCountToWait);
+                }
+                if (completed) {
+                    break;
+                }
             }
 
             currentTime = std::chrono::high_resolution_clock::now();
@@ -526,6 +541,11 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         partitionAddress = ptrOffset(partitionAddress, this->immWritePostSyncWriteOffset);
     }
 
+    if (this->adaptiveWaitPolicyEnabled && waited) {
+        auto waitTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - waitStartTime).count();
+        this->waitPolicy.recordCompletion(waitTimeNs);
+    }
+
     return WaitStatus::ready;
 }
 
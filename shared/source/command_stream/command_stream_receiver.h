@@ -18,6 +18,7 @@
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/utilities/spinlock.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include "aubstream/allocation_params.h"
 
@@ -32,6 +33,7 @@ enum class AllocationType;
 enum class DebugPauseState : uint32_t;
 struct BatchBuffer;
 struct HardwareInfo;
+struct SubmissionGapHistogram;
 struct WaitParams;
 class SubmissionAggregator;
 class FlushStampTracker;
@@ -376,6 +378,8 @@ class CommandStreamReceiver {
 
     virtual QueueThrottle getLastDirectSubmissionThrottle() = 0;
 
+    virtual void moveDirectSubmissionGapSamples(SubmissionGapHistogram &histogram) {}
+
     bool isStaticWorkPartitioningEnabled() const {
         return staticWorkPartitioningEnabled;
     }
@@ -630,6 +634,7 @@ class CommandStreamReceiver {
     bool csrSurfaceProgrammingDone = false;
 
     std::chrono::microseconds gpuHangCheckPeriod{500'000};
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
     uint32_t lastSentL3Config = 0;
     uint32_t latestSentStatelessMocsConfig = CacheSettings::unknownMocs;
     uint64_t lastSentSliceCount = QueueSliceCount::defaultSliceCount;
@@ -684,6 +689,7 @@ class CommandStreamReceiver {
     bool dshSupported = false;
     bool heaplessModeEnabled = false;
     bool requiresBlockingResidencyHandling = true;
+    bool adaptiveWaitPolicyEnabled = false;
 };
 
 typedef CommandStreamReceiver *(*CommandStreamReceiverCreateFunc)(bool withAubDump,
@@ -161,6 +161,8 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
 
     QueueThrottle getLastDirectSubmissionThrottle() override;
 
+    void moveDirectSubmissionGapSamples(SubmissionGapHistogram &histogram) override;
+
     virtual bool isKmdWaitModeActive() { return true; }
 
     bool initDirectSubmission() override;
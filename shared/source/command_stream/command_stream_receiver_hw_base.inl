@@ -1377,6 +1377,17 @@ inline QueueThrottle CommandStreamReceiverHw<GfxFamily>::getLastDirectSubmission
     return QueueThrottle::MEDIUM;
 }
 
+template <typename GfxFamily>
+inline void CommandStreamReceiverHw<GfxFamily>::moveDirectSubmissionGapSamples(SubmissionGapHistogram &histogram) {
+    if (this->isAnyDirectSubmissionEnabled()) {
+        if (EngineHelpers::isBcs(this->osContext->getEngineType())) {
+            this->blitterDirectSubmission->getSubmissionGapRecorder().moveSamplesTo(histogram);
+        } else {
+            this->directSubmission->getSubmissionGapRecorder().moveSamplesTo(histogram);
+        }
+    }
+}
+
 template <typename GfxFamily>
 inline bool CommandStreamReceiverHw<GfxFamily>::initDirectSubmission() {
     bool ret = true;
@@ -1420,6 +1431,10 @@ TagAllocatorBase *CommandStreamReceiverHw<GfxFamily>::getTimestampPacketAllocato
         const RootDeviceIndicesContainer rootDeviceIndices = {rootDeviceIndex};
 
         timestampPacketAllocator = gfxCoreHelper.createTimestampPacketAllocator(rootDeviceIndices, getMemoryManager(), getPreferredTagPoolSize(), getType(), osContext->getDeviceBitfield());
+
+        if (debugManager.flags.PreallocateTimestampPacketTags.get() > 0) {
+            timestampPacketAllocator->preallocateTags(static_cast<size_t>(debugManager.flags.PreallocateTimestampPacketTags.get()));
+        }
     }
     return timestampPacketAllocator.get();
 }
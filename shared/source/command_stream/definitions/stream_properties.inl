@@ -42,6 +42,7 @@ struct StateComputeModeProperties {
     void copyPropertiesGrfNumberThreadArbitration(const StateComputeModeProperties &properties);
 
     bool isDirty() const;
+    uint32_t getDirtyMask() const;
     void clearIsDirty();
 
   protected:
@@ -90,6 +91,7 @@ struct FrontEndProperties {
     void copyPropertiesComputeDispatchAllWalkerEnableDisableEuFusion(const FrontEndProperties &properties);
 
     bool isDirty() const;
+    uint32_t getDirtyMask() const;
     void clearIsDirty();
 
   protected:
@@ -118,6 +120,7 @@ struct PipelineSelectProperties {
     void copyPropertiesSystolicMode(const PipelineSelectProperties &properties);
 
     bool isDirty() const;
+    uint32_t getDirtyMask() const;
     void clearIsDirty();
 
   protected:
@@ -163,6 +166,7 @@ struct StateBaseAddressProperties {
     void copyPropertiesDynamicState(const StateBaseAddressProperties &properties);
 
     bool isDirty() const;
+    uint32_t getDirtyMask() const;
     void clearIsDirty();
 
   protected:
@@ -14,8 +14,47 @@
 #include "shared/source/kernel/grf_config.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include <iterator>
+
 using namespace NEO;
 
+namespace {
+// Field tables follow member declaration order - it defines bit positions of getDirtyMask().
+constexpr StreamProperty StateComputeModeProperties::*stateComputeModeFields[] = {
+    &StateComputeModeProperties::isCoherencyRequired,
+    &StateComputeModeProperties::largeGrfMode,
+    &StateComputeModeProperties::zPassAsyncComputeThreadLimit,
+    &StateComputeModeProperties::pixelAsyncComputeThreadLimit,
+    &StateComputeModeProperties::threadArbitrationPolicy,
+    &StateComputeModeProperties::devicePreemptionMode,
+    &StateComputeModeProperties::memoryAllocationForScratchAndMidthreadPreemptionBuffers};
+
+constexpr StreamProperty FrontEndProperties::*frontEndFields[] = {
+    &FrontEndProperties::computeDispatchAllWalkerEnable,
+    &FrontEndProperties::disableEUFusion,
+    &FrontEndProperties::disableOverdispatch,
+    &FrontEndProperties::singleSliceDispatchCcsMode};
+
+constexpr StreamProperty PipelineSelectProperties::*pipelineSelectFields[] = {
+    &PipelineSelectProperties::modeSelected,
+    &PipelineSelectProperties::mediaSamplerDopClockGate,
+    &PipelineSelectProperties::systolicMode};
+
+constexpr StreamProperty64 StateBaseAddressProperties::*stateBaseAddressFields[] = {
+    &StateBaseAddressProperties::bindingTablePoolBaseAddress,
+    &StateBaseAddressProperties::surfaceStateBaseAddress,
+    &StateBaseAddressProperties::dynamicStateBaseAddress,
+    &StateBaseAddressProperties::indirectObjectBaseAddress};
+
+constexpr StreamPropertySizeT StateBaseAddressProperties::*stateBaseAddressSizeFields[] = {
+    &StateBaseAddressProperties::bindingTablePoolSize,
+    &StateBaseAddressProperties::surfaceStateSize,
+    &StateBaseAddressProperties::dynamicStateSize,
+    &StateBaseAddressProperties::indirectObjectSize};
+
+constexpr uint32_t stateBaseAddressStatelessMocsDirtyBit = static_cast<uint32_t>(std::size(stateBaseAddressFields));
+} // namespace
+
 void StateComputeModeProperties::setPropertiesAll(bool requiresCoherency, uint32_t numGrfRequired, int32_t threadArbitrationPolicy, PreemptionMode devicePreemptionMode) {
     DEBUG_BREAK_IF(!this->propertiesSupportLoaded);
     clearIsDirty();
@@ -56,13 +95,7 @@ void StateComputeModeProperties::setPropertiesAll(bool requiresCoherency, uint32
 void StateComputeModeProperties::copyPropertiesAll(const StateComputeModeProperties &properties) {
     clearIsDirty();
 
-    isCoherencyRequired.set(properties.isCoherencyRequired.value);
-    largeGrfMode.set(properties.largeGrfMode.value);
-    zPassAsyncComputeThreadLimit.set(properties.zPassAsyncComputeThreadLimit.value);
-    pixelAsyncComputeThreadLimit.set(properties.pixelAsyncComputeThreadLimit.value);
-    threadArbitrationPolicy.set(properties.threadArbitrationPolicy.value);
-    devicePreemptionMode.set(properties.devicePreemptionMode.value);
-    memoryAllocationForScratchAndMidthreadPreemptionBuffers.set(properties.memoryAllocationForScratchAndMidthreadPreemptionBuffers.value);
+    StreamPropertyFields::copyValues(*this, properties, stateComputeModeFields);
 
     copyPropertiesExtra(properties);
 }
@@ -80,18 +113,15 @@ void StateComputeModeProperties::copyPropertiesGrfNumberThreadArbitration(const
 }
 
 bool StateComputeModeProperties::isDirty() const {
-    return isCoherencyRequired.isDirty || largeGrfMode.isDirty || zPassAsyncComputeThreadLimit.isDirty ||
-           pixelAsyncComputeThreadLimit.isDirty || threadArbitrationPolicy.isDirty || devicePreemptionMode.isDirty || memoryAllocationForScratchAndMidthreadPreemptionBuffers.isDirty || isDirtyExtra();
+    return getDirtyMask() != 0u || isDirtyExtra();
+}
+
+uint32_t StateComputeModeProperties::getDirtyMask() const {
+    return StreamPropertyFields::getDirtyMask(*this, stateComputeModeFields);
 }
 
 void StateComputeModeProperties::clearIsDirty() {
-    isCoherencyRequired.isDirty = false;
-    largeGrfMode.isDirty = false;
-    zPassAsyncComputeThreadLimit.isDirty = false;
-    pixelAsyncComputeThreadLimit.isDirty = false;
-    threadArbitrationPolicy.isDirty = false;
-    devicePreemptionMode.isDirty = false;
-    memoryAllocationForScratchAndMidthreadPreemptionBuffers.isDirty = false;
+    StreamPropertyFields::clearIsDirty(*this, stateComputeModeFields);
 
     clearIsDirtyExtraPerContext();
     clearIsDirtyExtraPerKernel();
@@ -146,13 +176,7 @@ void StateComputeModeProperties::initSupport(const RootDeviceEnvironment &rootDe
 void StateComputeModeProperties::resetState() {
     clearIsDirty();
 
-    this->isCoherencyRequired.value = StreamProperty::initValue;
-    this->largeGrfMode.value = StreamProperty::initValue;
-    this->zPassAsyncComputeThreadLimit.value = StreamProperty::initValue;
-    this->pixelAsyncComputeThreadLimit.value = StreamProperty::initValue;
-    this->threadArbitrationPolicy.value = StreamProperty::initValue;
-    this->devicePreemptionMode.value = StreamProperty::initValue;
-    this->memoryAllocationForScratchAndMidthreadPreemptionBuffers.value = StreamProperty::initValue;
+    StreamPropertyFields::resetValues(*this, stateComputeModeFields);
     resetStateExtra();
 }
 
@@ -196,10 +220,7 @@ void FrontEndProperties::initSupport(const RootDeviceEnvironment &rootDeviceEnvi
 void FrontEndProperties::resetState() {
     clearIsDirty();
 
-    this->computeDispatchAllWalkerEnable.value = StreamProperty::initValue;
-    this->disableEUFusion.value = StreamProperty::initValue;
-    this->disableOverdispatch.value = StreamProperty::initValue;
-    this->singleSliceDispatchCcsMode.value = StreamProperty::initValue;
+    StreamPropertyFields::resetValues(*this, frontEndFields);
 }
 
 void FrontEndProperties::setPropertiesAll(bool isCooperativeKernel, bool disableEuFusion, bool disableOverdispatch, int32_t engineInstancedDevice) {
@@ -271,10 +292,7 @@ void FrontEndProperties::setPropertiesComputeDispatchAllWalkerEnableDisableEuFus
 void FrontEndProperties::copyPropertiesAll(const FrontEndProperties &properties) {
     clearIsDirty();
 
-    disableOverdispatch.set(properties.disableOverdispatch.value);
-    disableEUFusion.set(properties.disableEUFusion.value);
-    singleSliceDispatchCcsMode.set(properties.singleSliceDispatchCcsMode.value);
-    computeDispatchAllWalkerEnable.set(properties.computeDispatchAllWalkerEnable.value);
+    StreamPropertyFields::copyValues(*this, properties, frontEndFields);
 }
 
 void FrontEndProperties::copyPropertiesComputeDispatchAllWalkerEnableDisableEuFusion(const FrontEndProperties &properties) {
@@ -286,15 +304,15 @@ void FrontEndProperties::copyPropertiesComputeDispatchAllWalkerEnableDisableEuFu
 }
 
 bool FrontEndProperties::isDirty() const {
-    return disableOverdispatch.isDirty || disableEUFusion.isDirty || singleSliceDispatchCcsMode.isDirty ||
-           computeDispatchAllWalkerEnable.isDirty;
+    return getDirtyMask() != 0u;
+}
+
+uint32_t FrontEndProperties::getDirtyMask() const {
+    return StreamPropertyFields::getDirtyMask(*this, frontEndFields);
 }
 
 void FrontEndProperties::clearIsDirty() {
-    disableEUFusion.isDirty = false;
-    disableOverdispatch.isDirty = false;
-    singleSliceDispatchCcsMode.isDirty = false;
-    computeDispatchAllWalkerEnable.isDirty = false;
+    StreamPropertyFields::clearIsDirty(*this, frontEndFields);
 }
 
 void PipelineSelectProperties::initSupport(const RootDeviceEnvironment &rootDeviceEnvironment) {
@@ -306,9 +324,7 @@ void PipelineSelectProperties::initSupport(const RootDeviceEnvironment &rootDevi
 void PipelineSelectProperties::resetState() {
     clearIsDirty();
 
-    this->modeSelected.value = StreamProperty::initValue;
-    this->mediaSamplerDopClockGate.value = StreamProperty::initValue;
-    this->systolicMode.value = StreamProperty::initValue;
+    StreamPropertyFields::resetValues(*this, pipelineSelectFields);
 }
 
 void PipelineSelectProperties::setPropertiesAll(bool modeSelected, bool mediaSamplerDopClockGate, bool systolicMode) {
@@ -359,9 +375,7 @@ void PipelineSelectProperties::setPropertySystolicMode(bool systolicMode) {
 void PipelineSelectProperties::copyPropertiesAll(const PipelineSelectProperties &properties) {
     clearIsDirty();
 
-    modeSelected.set(properties.modeSelected.value);
-    mediaSamplerDopClockGate.set(properties.mediaSamplerDopClockGate.value);
-    systolicMode.set(properties.systolicMode.value);
+    StreamPropertyFields::copyValues(*this, properties, pipelineSelectFields);
 }
 
 void PipelineSelectProperties::copyPropertiesSystolicMode(const PipelineSelectProperties &properties) {
@@ -370,13 +384,15 @@ void PipelineSelectProperties::copyPropertiesSystolicMode(const PipelineSelectPr
 }
 
 bool PipelineSelectProperties::isDirty() const {
-    return modeSelected.isDirty || mediaSamplerDopClockGate.isDirty || systolicMode.isDirty;
+    return getDirtyMask() != 0u;
+}
+
+uint32_t PipelineSelectProperties::getDirtyMask() const {
+    return StreamPropertyFields::getDirtyMask(*this, pipelineSelectFields);
 }
 
 void PipelineSelectProperties::clearIsDirty() {
-    modeSelected.isDirty = false;
-    mediaSamplerDopClockGate.isDirty = false;
-    systolicMode.isDirty = false;
+    StreamPropertyFields::clearIsDirty(*this, pipelineSelectFields);
 }
 
 void StateBaseAddressProperties::initSupport(const RootDeviceEnvironment &rootDeviceEnvironment) {
@@ -389,18 +405,8 @@ void StateBaseAddressProperties::resetState() {
     clearIsDirty();
 
     this->statelessMocs.value = StreamProperty::initValue;
-
-    this->bindingTablePoolBaseAddress.value = StreamProperty64::initValue;
-    this->bindingTablePoolSize.value = StreamPropertySizeT::initValue;
-
-    this->surfaceStateBaseAddress.value = StreamProperty64::initValue;
-    this->surfaceStateSize.value = StreamPropertySizeT::initValue;
-
-    this->indirectObjectBaseAddress.value = StreamProperty64::initValue;
-    this->indirectObjectSize.value = StreamPropertySizeT::initValue;
-
-    this->dynamicStateBaseAddress.value = StreamProperty64::initValue;
-    this->dynamicStateSize.value = StreamPropertySizeT::initValue;
+    StreamPropertyFields::resetValues(*this, stateBaseAddressFields);
+    StreamPropertyFields::resetValues(*this, stateBaseAddressSizeFields);
 }
 
 void StateBaseAddressProperties::setPropertiesBindingTableSurfaceState(int64_t bindingTablePoolBaseAddress, size_t bindingTablePoolSize,
@@ -469,16 +475,8 @@ void StateBaseAddressProperties::copyPropertiesAll(const StateBaseAddressPropert
     clearIsDirty();
 
     this->statelessMocs.set(properties.statelessMocs.value);
-
-    this->bindingTablePoolBaseAddress.set(properties.bindingTablePoolBaseAddress.value);
-    this->bindingTablePoolSize.set(properties.bindingTablePoolSize.value);
-
-    this->surfaceStateBaseAddress.set(properties.surfaceStateBaseAddress.value);
-    this->surfaceStateSize.set(properties.surfaceStateSize.value);
-    this->dynamicStateBaseAddress.set(properties.dynamicStateBaseAddress.value);
-    this->dynamicStateSize.set(properties.dynamicStateSize.value);
-    this->indirectObjectBaseAddress.set(properties.indirectObjectBaseAddress.value);
-    this->indirectObjectSize.set(properties.indirectObjectSize.value);
+    StreamPropertyFields::copyValues(*this, properties, stateBaseAddressFields);
+    StreamPropertyFields::copyValues(*this, properties, stateBaseAddressSizeFields);
 }
 
 void StateBaseAddressProperties::copyPropertiesStatelessMocs(const StateBaseAddressProperties &properties) {
@@ -521,17 +519,15 @@ void StateBaseAddressProperties::copyPropertiesDynamicState(const StateBaseAddre
 }
 
 bool StateBaseAddressProperties::isDirty() const {
-    return statelessMocs.isDirty ||
-           bindingTablePoolBaseAddress.isDirty ||
-           surfaceStateBaseAddress.isDirty ||
-           dynamicStateBaseAddress.isDirty ||
-           indirectObjectBaseAddress.isDirty;
+    return getDirtyMask() != 0u;
+}
+
+uint32_t StateBaseAddressProperties::getDirtyMask() const {
+    return StreamPropertyFields::getDirtyMask(*this, stateBaseAddressFields) |
+           (static_cast<uint32_t>(statelessMocs.isDirty) << stateBaseAddressStatelessMocsDirtyBit);
 }
 
 void StateBaseAddressProperties::clearIsDirty() {
     statelessMocs.isDirty = false;
-    bindingTablePoolBaseAddress.isDirty = false;
-    surfaceStateBaseAddress.isDirty = false;
-    dynamicStateBaseAddress.isDirty = false;
-    indirectObjectBaseAddress.isDirty = false;
+    StreamPropertyFields::clearIsDirty(*this, stateBaseAddressFields);
 }
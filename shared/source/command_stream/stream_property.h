@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,4 +38,39 @@ using StreamPropertySizeT = StreamPropertyType<size_t, false>;
 
 using StreamProperty = StreamProperty32;
 
+// Helpers walking a constexpr table of pointers to StreamProperty members.
+// Bit i of a dirty mask corresponds to fields[i].
+namespace StreamPropertyFields {
+template <typename PropertiesT, typename PropertyT, size_t numFields>
+constexpr uint32_t getDirtyMask(const PropertiesT &properties, PropertyT PropertiesT::*const (&fields)[numFields]) {
+    static_assert(numFields <= 32u);
+    uint32_t dirtyMask = 0u;
+    for (size_t i = 0; i < numFields; i++) {
+        dirtyMask |= static_cast<uint32_t>((properties.*fields[i]).isDirty) << i;
+    }
+    return dirtyMask;
+}
+
+template <typename PropertiesT, typename PropertyT, size_t numFields>
+constexpr void clearIsDirty(PropertiesT &properties, PropertyT PropertiesT::*const (&fields)[numFields]) {
+    for (auto field : fields) {
+        (properties.*field).isDirty = false;
+    }
+}
+
+template <typename PropertiesT, typename PropertyT, size_t numFields>
+constexpr void resetValues(PropertiesT &properties, PropertyT PropertiesT::*const (&fields)[numFields]) {
+    for (auto field : fields) {
+        (properties.*field).value = PropertyT::initValue;
+    }
+}
+
+template <typename PropertiesT, typename PropertyT, size_t numFields>
+constexpr void copyValues(PropertiesT &properties, const PropertiesT &source, PropertyT PropertiesT::*const (&fields)[numFields]) {
+    for (auto field : fields) {
+        (properties.*field).set((source.*field).value);
+    }
+}
+} // namespace StreamPropertyFields
+
 } // namespace NEO
@@ -7,6 +7,7 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 
+#include "shared/source/compiler_interface/compiler_cache_packed_storage.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
@@ -136,6 +137,12 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig){};
+    : config(cacheConfig) {
+    if (debugManager.flags.BinaryCachePackedFormat.get() == 1) {
+        packedStorage = CompilerCachePackedStorage::create(config);
+    }
+};
+
+CompilerCache::~CompilerCache() = default;
 
 } // namespace NEO
@@ -18,6 +18,7 @@
 
 namespace NEO {
 struct HardwareInfo;
+class CompilerCachePackedStorage;
 
 struct CompilerCacheConfig {
     bool enabled = false;
@@ -29,7 +30,7 @@ struct CompilerCacheConfig {
 class CompilerCache {
   public:
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -55,5 +56,6 @@ class CompilerCache {
 
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
+    std::unique_ptr<CompilerCachePackedStorage> packedStorage;
 };
 } // namespace NEO
@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_packed_storage.h"
+
+#include "shared/source/helpers/hash.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace NEO {
+
+uint64_t CompilerCachePackedStorage::getKey(const std::string &kernelFileHash) {
+    char *parseEnd = nullptr;
+    uint64_t key = std::strtoull(kernelFileHash.c_str(), &parseEnd, 16);
+    if (kernelFileHash.empty() || *parseEnd != '\0' || key == emptyKey || key == tombstoneKey) {
+        key = Hash::hash(kernelFileHash.c_str(), kernelFileHash.size());
+    }
+    if (key == emptyKey || key == tombstoneKey) {
+        key = 1u;
+    }
+    return key;
+}
+
+bool CompilerCachePackedStorage::initialize() {
+    index = mapIndex();
+    if (index == nullptr) {
+        return false;
+    }
+
+    if (!lockIndex()) {
+        index = nullptr;
+        return false;
+    }
+
+    auto &header = index->header;
+    const bool headerValid = header.magic.load(std::memory_order_acquire) == indexMagic &&
+                             header.version == indexVersion &&
+                             header.entriesCount == numIndexEntries &&
+                             header.segmentsCount == numSegments &&
+                             header.segmentSize == segmentSize;
+    if (!headerValid) {
+        resetIndex();
+    }
+
+    unlockIndex();
+    return true;
+}
+
+void CompilerCachePackedStorage::resetIndex() {
+    auto &header = index->header;
+    header.magic.store(0u, std::memory_order_relaxed);
+
+    for (auto &entry : index->entries) {
+        entry.sequence.store(0u, std::memory_order_relaxed);
+        entry.lastAccessStamp.store(0u, std::memory_order_relaxed);
+        entry.key.store(emptyKey, std::memory_order_relaxed);
+        entry.generation.store(0u, std::memory_order_relaxed);
+        entry.offset.store(0u, std::memory_order_relaxed);
+        entry.size.store(0u, std::memory_order_relaxed);
+    }
+
+    header.version = indexVersion;
+    header.entriesCount = numIndexEntries;
+    header.segmentsCount = numSegments;
+    header.segmentSize = segmentSize;
+    header.accessClock.store(0u, std::memory_order_relaxed);
+    header.oldestGeneration.store(0u, std::memory_order_relaxed);
+    header.currentGeneration = 0u;
+    header.currentSegmentUsedSize = 0u;
+    for (auto &stamp : header.generationStartStamp) {
+        stamp = 0u;
+    }
+
+    header.magic.store(indexMagic, std::memory_order_release);
+}
+
+bool CompilerCachePackedStorage::isGenerationValid(uint64_t generation) const {
+    return generation >= index->header.oldestGeneration.load(std::memory_order_acquire);
+}
+
+bool CompilerCachePackedStorage::takeSnapshot(const IndexEntry &entry, EntrySnapshot &snapshot) const {
+    for (uint32_t retry = 0; retry < maxReadRetries; retry++) {
+        const auto sequenceBefore = entry.sequence.load(std::memory_order_acquire);
+        if (sequenceBefore & 1) {
+            continue;
+        }
+
+        snapshot.key = entry.key.load(std::memory_order_relaxed);
+        snapshot.generation = entry.generation.load(std::memory_order_relaxed);
+        snapshot.offset = entry.offset.load(std::memory_order_relaxed);
+        snapshot.size = entry.size.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry.sequence.load(std::memory_order_relaxed) == sequenceBefore) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CompilerCachePackedStorage::publishEntry(IndexEntry &entry, const EntrySnapshot &snapshot) {
+    const auto writeSequence = entry.sequence.load(std::memory_order_relaxed) | 1u;
+    entry.sequence.store(writeSequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    entry.key.store(snapshot.key, std::memory_order_relaxed);
+    entry.generation.store(snapshot.generation, std::memory_order_relaxed);
+    entry.offset.store(snapshot.offset, std::memory_order_relaxed);
+    entry.size.store(snapshot.size, std::memory_order_relaxed);
+    entry.lastAccessStamp.store(index->header.accessClock.fetch_add(1u, std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+
+    entry.sequence.store(writeSequence + 1u, std::memory_order_release);
+}
+
+CompilerCachePackedStorage::IndexEntry *CompilerCachePackedStorage::findEntry(uint64_t key, EntrySnapshot &snapshot) const {
+    for (uint32_t probe = 0; probe < maxProbeLength; probe++) {
+        auto &entry = index->entries[(key + probe) % numIndexEntries];
+
+        EntrySnapshot entrySnapshot;
+        if (!takeSnapshot(entry, entrySnapshot)) {
+            continue;
+        }
+        if (entrySnapshot.key == emptyKey) {
+            return nullptr;
+        }
+        if (entrySnapshot.key == key) {
+            snapshot = entrySnapshot;
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CompilerCachePackedStorage::IndexEntry *CompilerCachePackedStorage::selectEntryForInsert(uint64_t key) const {
+    IndexEntry *leastRecentlyUsed = nullptr;
+    for (uint32_t probe = 0; probe < maxProbeLength; probe++) {
+        auto &entry = index->entries[(key + probe) % numIndexEntries];
+
+        const auto entryKey = entry.key.load(std::memory_order_relaxed);
+        const bool interruptedWrite = (entry.sequence.load(std::memory_order_relaxed) & 1) != 0;
+        if (entryKey == emptyKey || entryKey == tombstoneKey || interruptedWrite ||
+            !isGenerationValid(entry.generation.load(std::memory_order_relaxed))) {
+            return &entry;
+        }
+
+        if (leastRecentlyUsed == nullptr ||
+            entry.lastAccessStamp.load(std::memory_order_relaxed) < leastRecentlyUsed->lastAccessStamp.load(std::memory_order_relaxed)) {
+            leastRecentlyUsed = &entry;
+        }
+    }
+    return leastRecentlyUsed;
+}
+
+bool CompilerCachePackedStorage::appendRecord(uint64_t key, const char *pBinary, size_t binarySize, EntrySnapshot &snapshot) {
+    auto &header = index->header;
+    const auto generation = header.currentGeneration;
+    const auto segment = getSegment(generation);
+    const auto offset = header.currentSegmentUsedSize;
+
+    RecordHeader recordHeader = {key, generation, binarySize};
+    if (!writeSegment(segment, offset, &recordHeader, sizeof(recordHeader)) ||
+        !writeSegment(segment, offset + sizeof(recordHeader), pBinary, binarySize)) {
+        return false;
+    }
+    header.currentSegmentUsedSize += sizeof(recordHeader) + binarySize;
+
+    snapshot.key = key;
+    snapshot.generation = generation;
+    snapshot.offset = offset;
+    snapshot.size = binarySize;
+    return true;
+}
+
+void CompilerCachePackedStorage::rotateSegment(uint64_t reservedSize) {
+    auto &header = index->header;
+    const auto newGeneration = header.currentGeneration + 1;
+    const auto newSegment = getSegment(newGeneration);
+
+    struct CarriedOverRecord {
+        IndexEntry *entry;
+        uint64_t key;
+        uint64_t size;
+        std::unique_ptr<char[]> data;
+    };
+    std::vector<CarriedOverRecord> carriedOverRecords;
+
+    const auto oldestGeneration = header.oldestGeneration.load(std::memory_order_relaxed);
+    if (newGeneration - oldestGeneration >= numSegments) {
+        const auto recentAccessStamp = header.generationStartStamp[getSegment(oldestGeneration + 1)];
+        const auto carryOverLimit = std::min(segmentSize / 2, segmentSize - reservedSize);
+        uint64_t carriedOverSize = 0u;
+
+        for (auto &entry : index->entries) {
+            EntrySnapshot snapshot;
+            if (!takeSnapshot(entry, snapshot) || snapshot.key == emptyKey || snapshot.key == tombstoneKey ||
+                snapshot.generation != oldestGeneration ||
+                entry.lastAccessStamp.load(std::memory_order_relaxed) <= recentAccessStamp) {
+                continue;
+            }
+
+            const auto recordSize = sizeof(RecordHeader) + snapshot.size;
+            if (carriedOverSize + recordSize > carryOverLimit) {
+                continue;
+            }
+
+            auto data = std::make_unique<char[]>(static_cast<size_t>(snapshot.size));
+            if (!readSegment(getSegment(oldestGeneration), snapshot.offset + sizeof(RecordHeader), data.get(), static_cast<size_t>(snapshot.size))) {
+                continue;
+            }
+            carriedOverSize += recordSize;
+            carriedOverRecords.push_back({&entry, snapshot.key, snapshot.size, std::move(data)});
+        }
+
+        header.oldestGeneration.store(oldestGeneration + 1, std::memory_order_release);
+    }
+
+    header.generationStartStamp[newSegment] = header.accessClock.load(std::memory_order_relaxed);
+    header.currentGeneration = newGeneration;
+    header.currentSegmentUsedSize = 0u;
+
+    for (auto &record : carriedOverRecords) {
+        EntrySnapshot snapshot;
+        if (appendRecord(record.key, record.data.get(), static_cast<size_t>(record.size), snapshot)) {
+            publishEntry(*record.entry, snapshot);
+        }
+    }
+}
+
+bool CompilerCachePackedStorage::storeUnderLock(uint64_t key, const char *pBinary, size_t binarySize) {
+    EntrySnapshot existing;
+    auto entry = findEntry(key, existing);
+    if (entry && isGenerationValid(existing.generation)) {
+        return true;
+    }
+
+    const auto recordSize = sizeof(RecordHeader) + binarySize;
+    if (index->header.currentSegmentUsedSize + recordSize > segmentSize) {
+        rotateSegment(recordSize);
+        if (index->header.currentSegmentUsedSize + recordSize > segmentSize) {
+            return false;
+        }
+    }
+
+    if (entry == nullptr) {
+        entry = selectEntryForInsert(key);
+    }
+
+    EntrySnapshot snapshot;
+    if (!appendRecord(key, pBinary, binarySize, snapshot)) {
+        return false;
+    }
+    publishEntry(*entry, snapshot);
+    return true;
+}
+
+bool CompilerCachePackedStorage::store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (index == nullptr || pBinary == nullptr || binarySize == 0 || sizeof(RecordHeader) + binarySize > segmentSize) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(storeMtx);
+    if (!lockIndex()) {
+        return false;
+    }
+    auto ret = storeUnderLock(getKey(kernelFileHash), pBinary, binarySize);
+    unlockIndex();
+    return ret;
+}
+
+std::unique_ptr<char[]> CompilerCachePackedStorage::load(const std::string &kernelFileHash, size_t &binarySize) {
+    binarySize = 0u;
+    if (index == nullptr) {
+        return nullptr;
+    }
+
+    const auto key = getKey(kernelFileHash);
+    EntrySnapshot snapshot;
+    auto entry = findEntry(key, snapshot);
+    if (entry == nullptr || !isGenerationValid(snapshot.generation)) {
+        return nullptr;
+    }
+    entry->lastAccessStamp.store(index->header.accessClock.fetch_add(1u, std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+
+    const auto segment = getSegment(snapshot.generation);
+    RecordHeader recordHeader = {};
+    if (!readSegment(segment, snapshot.offset, &recordHeader, sizeof(recordHeader)) ||
+        recordHeader.key != key || recordHeader.generation != snapshot.generation || recordHeader.size != snapshot.size) {
+        return nullptr;
+    }
+
+    auto data = std::make_unique<char[]>(static_cast<size_t>(snapshot.size));
+    if (!readSegment(segment, snapshot.offset + sizeof(recordHeader), data.get(), static_cast<size_t>(snapshot.size))) {
+        return nullptr;
+    }
+
+    // segment could have been recycled by a writer while it was being read
+    if (!isGenerationValid(snapshot.generation)) {
+        return nullptr;
+    }
+
+    binarySize = static_cast<size_t>(snapshot.size);
+    return data;
+}
+
+} // namespace NEO
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace NEO {
+struct CompilerCacheConfig;
+
+// Binary cache kept as one fixed-size index shared (memory-mapped) by all processes plus a ring of
+// append-only data segments. Readers probe the index without taking any lock, writers serialize on
+// the index lock, append the record to the current segment and publish the index entry last.
+// When the ring wraps, only the oldest segment is recycled; records used since the next segment was
+// started are carried over, so eviction cost is bounded by a single segment. Carried over records never
+// take the space needed by the record which triggered the rotation.
+class CompilerCachePackedStorage {
+  public:
+    static constexpr uint32_t indexMagic = 0x4b50434e;
+    static constexpr uint32_t indexVersion = 1u;
+    static constexpr uint32_t numIndexEntries = 16384u;
+    static constexpr uint32_t maxProbeLength = 16u;
+    static constexpr uint32_t maxReadRetries = 64u;
+    static constexpr uint32_t numSegments = 8u;
+    static constexpr uint64_t emptyKey = 0u;
+    static constexpr uint64_t tombstoneKey = std::numeric_limits<uint64_t>::max();
+
+    struct IndexEntry {
+        std::atomic<uint64_t> sequence;
+        std::atomic<uint64_t> lastAccessStamp;
+        std::atomic<uint64_t> key;
+        std::atomic<uint64_t> generation;
+        std::atomic<uint64_t> offset;
+        std::atomic<uint64_t> size;
+    };
+
+    struct IndexHeader {
+        std::atomic<uint32_t> magic;
+        uint32_t version;
+        uint32_t entriesCount;
+        uint32_t segmentsCount;
+        uint64_t segmentSize;
+        std::atomic<uint64_t> accessClock;
+        std::atomic<uint64_t> oldestGeneration;
+        uint64_t currentGeneration;
+        uint64_t currentSegmentUsedSize;
+        uint64_t generationStartStamp[numSegments];
+    };
+
+    struct IndexFile {
+        IndexHeader header;
+        IndexEntry entries[numIndexEntries];
+    };
+
+    struct RecordHeader {
+        uint64_t key;
+        uint64_t generation;
+        uint64_t size;
+    };
+
+    struct EntrySnapshot {
+        uint64_t key = emptyKey;
+        uint64_t generation = 0u;
+        uint64_t offset = 0u;
+        uint64_t size = 0u;
+    };
+
+    static std::unique_ptr<CompilerCachePackedStorage> create(const CompilerCacheConfig &config);
+
+    virtual ~CompilerCachePackedStorage() = default;
+
+    bool store(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> load(const std::string &kernelFileHash, size_t &binarySize);
+
+    static uint64_t getKey(const std::string &kernelFileHash);
+
+  protected:
+    CompilerCachePackedStorage(uint64_t segmentSize) : segmentSize(segmentSize) {}
+
+    bool initialize();
+
+    virtual IndexFile *mapIndex() = 0;
+    virtual bool lockIndex() = 0;
+    virtual void unlockIndex() = 0;
+    virtual bool readSegment(uint32_t segment, uint64_t offset, void *data, size_t size) = 0;
+    virtual bool writeSegment(uint32_t segment, uint64_t offset, const void *data, size_t size) = 0;
+
+    bool storeUnderLock(uint64_t key, const char *pBinary, size_t binarySize);
+    IndexEntry *findEntry(uint64_t key, EntrySnapshot &snapshot) const;
+    IndexEntry *selectEntryForInsert(uint64_t key) const;
+    bool takeSnapshot(const IndexEntry &entry, EntrySnapshot &snapshot) const;
+    void publishEntry(IndexEntry &entry, const EntrySnapshot &snapshot);
+    bool appendRecord(uint64_t key, const char *pBinary, size_t binarySize, EntrySnapshot &snapshot);
+    void rotateSegment(uint64_t reservedSize);
+    bool isGenerationValid(uint64_t generation) const;
+    void resetIndex();
+
+    static uint32_t getSegment(uint64_t generation) {
+        return static_cast<uint32_t>(generation % numSegments);
+    }
+
+    IndexFile *index = nullptr;
+    const uint64_t segmentSize;
+
+    // index lock is shared by all threads using this storage, writers within the process serialize here
+    std::mutex storeMtx;
+};
+} // namespace NEO
@@ -22,6 +22,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/release_helper/release_helper.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "RelocationInfo.h"
 
@@ -431,13 +432,18 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
 
     auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
+
+    // segments are patched independently, results are gathered per segment and merged in segment order
+    std::vector<UnresolvedExternals> unresolvedExternalsPerSegment(relocationsPerSegment.size());
+    std::vector<StackVec<uint32_t *, 2>> implicitArgsRelocationAddressesPerSegment(relocationsPerSegment.size());
+    parallelFor(relocationsPerSegment.size(), [&](size_t segId) {
         auto &segment = instructionsSegments[segId];
+        auto &segmentUnresolvedExternals = unresolvedExternalsPerSegment[segId];
         for (const auto &relocation : relocationsPerSegment[segId]) {
             UNRECOVERABLE_IF(nullptr == segment.hostPointer);
             bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
             if (invalidRelocation) {
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
+                segmentUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
                 DEBUG_BREAK_IF(true);
                 continue;
             }
@@ -447,7 +453,7 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
                 uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
                 *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
             } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(reinterpret_cast<uint32_t *>(relocAddress));
+                implicitArgsRelocationAddressesPerSegment[segId].push_back(reinterpret_cast<uint32_t *>(relocAddress));
             } else if (relocation.symbolName.empty()) {
                 uint64_t patchValue = 0;
                 patchAddress(relocAddress, patchValue, relocation);
@@ -457,10 +463,20 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
                     uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
                     patchAddress(relocAddress, patchValue, relocation);
                 } else {
-                    outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
+                    segmentUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
                 }
             }
         }
+    });
+
+    for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), unresolvedExternalsPerSegment[segId].begin(), unresolvedExternalsPerSegment[segId].end());
+        if (false == implicitArgsRelocationAddressesPerSegment[segId].empty()) {
+            auto &implicitArgsRelocationAddresses = pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)];
+            for (auto implicitArgsRelocationAddress : implicitArgsRelocationAddressesPerSegment[segId]) {
+                implicitArgsRelocationAddresses.push_back(implicitArgsRelocationAddress);
+            }
+        }
     }
 }
 
@@ -644,10 +660,10 @@ bool Linker::resolveExternalFunctions(const KernelDescriptorsT &kernelDescriptor
 }
 
 void Linker::resolveImplicitArgs(const KernelDescriptorsT &kernelDescriptors, Device *pDevice) {
-    for (auto i = 0u; i < kernelDescriptors.size(); i++) {
+    parallelFor(kernelDescriptors.size(), [&](size_t i) {
         UNRECOVERABLE_IF(!kernelDescriptors[i]);
         KernelDescriptor &kernelDescriptor = *kernelDescriptors[i];
-        auto pImplicitArgsRelocs = pImplicitArgsRelocationAddresses.find(i);
+        auto pImplicitArgsRelocs = pImplicitArgsRelocationAddresses.find(static_cast<uint32_t>(i));
         if (pImplicitArgsRelocs != pImplicitArgsRelocationAddresses.end()) {
             for (const auto &pImplicitArgsReloc : pImplicitArgsRelocs->second) {
                 UNRECOVERABLE_IF(!pDevice);
@@ -657,7 +673,7 @@ void Linker::resolveImplicitArgs(const KernelDescriptorsT &kernelDescriptors, De
                 }
             }
         }
-    }
+    });
 }
 
 void Linker::resolveBuiltins(Device *pDevice, UnresolvedExternals &outUnresolvedExternals, const std::vector<PatchableSegment> &instructionsSegments, const KernelDescriptorsT &kernelDescriptors) {
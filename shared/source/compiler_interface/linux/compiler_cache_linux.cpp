@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_packed_storage.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/file_io.h"
@@ -221,7 +222,12 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
         return false;
     }
 
+    if (packedStorage) {
+        return packedStorage->store(kernelFileHash, pBinary, binarySize);
+    }
+
     std::unique_lock<std::mutex> lock(cacheAccessMtx);
+
     constexpr std::string_view configFileName = "config.file";
 
     std::string configFilePath = joinPath(config.cacheDir, configFileName.data());
@@ -278,6 +284,10 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    if (packedStorage) {
+        return packedStorage->load(kernelFileHash, cachedBinarySize);
+    }
+
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
 
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_packed_storage.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <array>
+#include <fcntl.h>
+#include <sys/file.h>
+
+namespace NEO {
+
+class CompilerCachePackedStorageLinux : public CompilerCachePackedStorage {
+  public:
+    CompilerCachePackedStorageLinux(const CompilerCacheConfig &config, uint64_t segmentSize) : CompilerCachePackedStorage(segmentSize) {
+        std::string extension = config.cacheFileExtension;
+        if (!extension.empty() && extension[0] == '.') {
+            extension.erase(0, 1);
+        }
+        filePrefix = joinPath(config.cacheDir, "packed_" + extension);
+        segmentFds.fill(-1);
+    }
+
+    ~CompilerCachePackedStorageLinux() override {
+        if (mappedIndex != nullptr) {
+            NEO::SysCalls::munmap(mappedIndex, sizeof(IndexFile));
+        }
+        for (auto fd : segmentFds) {
+            if (fd >= 0) {
+                NEO::SysCalls::close(fd);
+            }
+        }
+        if (indexFd >= 0) {
+            NEO::SysCalls::close(indexFd);
+        }
+    }
+
+    using CompilerCachePackedStorage::initialize;
+
+  protected:
+    IndexFile *mapIndex() override {
+        const auto indexPath = filePrefix + ".index";
+        indexFd = NEO::SysCalls::openWithMode(indexPath.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+        if (indexFd < 0) {
+            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Open packed cache index failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+            return nullptr;
+        }
+
+        struct stat statBuffer = {};
+        if (NEO::SysCalls::fstat(indexFd, &statBuffer) != 0) {
+            return nullptr;
+        }
+        if (static_cast<size_t>(statBuffer.st_size) < sizeof(IndexFile)) {
+            const char zero = 0;
+            if (NEO::SysCalls::pwrite(indexFd, &zero, sizeof(zero), sizeof(IndexFile) - sizeof(zero)) != sizeof(zero)) {
+                NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Resizing packed cache index failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+                return nullptr;
+            }
+        }
+
+        for (uint32_t segment = 0; segment < numSegments; segment++) {
+            const auto segmentPath = filePrefix + "_" + std::to_string(segment) + ".data";
+            segmentFds[segment] = NEO::SysCalls::openWithMode(segmentPath.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+            if (segmentFds[segment] < 0) {
+                NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Open packed cache segment failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+                return nullptr;
+            }
+        }
+
+        auto ptr = NEO::SysCalls::mmap(nullptr, sizeof(IndexFile), PROT_READ | PROT_WRITE, MAP_SHARED, indexFd, 0);
+        if (ptr == MAP_FAILED || ptr == nullptr) {
+            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Mapping packed cache index failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+            return nullptr;
+        }
+        mappedIndex = ptr;
+        return static_cast<IndexFile *>(ptr);
+    }
+
+    bool lockIndex() override {
+        if (NEO::SysCalls::flock(indexFd, LOCK_EX) < 0) {
+            NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Lock packed cache index failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+            return false;
+        }
+        return true;
+    }
+
+    void unlockIndex() override {
+        NEO::SysCalls::flock(indexFd, LOCK_UN);
+    }
+
+    bool readSegment(uint32_t segment, uint64_t offset, void *data, size_t size) override {
+        return NEO::SysCalls::pread(segmentFds[segment], data, size, static_cast<off_t>(offset)) == static_cast<ssize_t>(size);
+    }
+
+    bool writeSegment(uint32_t segment, uint64_t offset, const void *data, size_t size) override {
+        return NEO::SysCalls::pwrite(segmentFds[segment], data, size, static_cast<off_t>(offset)) == static_cast<ssize_t>(size);
+    }
+
+    std::string filePrefix;
+    std::array<int, numSegments> segmentFds;
+    int indexFd = -1;
+    void *mappedIndex = nullptr;
+};
+
+std::unique_ptr<CompilerCachePackedStorage> CompilerCachePackedStorage::create(const CompilerCacheConfig &config) {
+    const uint64_t segmentSize = config.cacheSize / numSegments;
+    if (!config.enabled || segmentSize <= sizeof(RecordHeader)) {
+        return nullptr;
+    }
+
+    auto storage = std::make_unique<CompilerCachePackedStorageLinux>(config, segmentSize);
+    if (!storage->initialize()) {
+        return nullptr;
+    }
+    return storage;
+}
+
+} // namespace NEO
@@ -0,0 +1,16 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_packed_storage.h"
+
+namespace NEO {
+
+std::unique_ptr<CompilerCachePackedStorage> CompilerCachePackedStorage::create(const CompilerCacheConfig &) {
+    return nullptr;
+}
+
+} // namespace NEO
@@ -157,10 +157,12 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     while (context.pos < context.end) {
         reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
-        case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+        case ' ': {
+            auto spacesEnd = consumeSpaces(context.pos + 1, context.end);
+            context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0U;
+            context.pos = spacesEnd;
             break;
+        }
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
@@ -175,13 +177,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '#': {
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::singleCharacter));
-            auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentIt = findLineEnd(context.pos + 1, context.end);
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::comment));
             }
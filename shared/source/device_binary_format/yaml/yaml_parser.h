@@ -12,6 +12,7 @@
 #include "shared/source/utilities/stackvec.h"
 
 #include <array>
+#include <cstring>
 #include <iterator>
 #include <string>
 
@@ -168,6 +169,31 @@ constexpr const char *consumeStringLiteral(ConstStringRef wholeText, const char
     return it + 1;
 }
 
+// Consumes a run of spaces (e.g. indentation), comparing 8 characters at a time before falling back to per-character checks.
+inline const char *consumeSpaces(const char *parsePos, const char *parseEnd) {
+    constexpr uint64_t eightSpaces = 0x2020202020202020ULL;
+    while (parseEnd - parsePos >= static_cast<ptrdiff_t>(sizeof(eightSpaces))) {
+        uint64_t chunk = 0U;
+        memcpy(&chunk, parsePos, sizeof(chunk));
+        if (eightSpaces != chunk) {
+            break;
+        }
+        parsePos += sizeof(chunk);
+    }
+    while ((parsePos < parseEnd) && (' ' == *parsePos)) {
+        ++parsePos;
+    }
+    return parsePos;
+}
+
+inline const char *findLineEnd(const char *parsePos, const char *parseEnd) {
+    if (parsePos >= parseEnd) {
+        return parseEnd;
+    }
+    auto lineEnd = static_cast<const char *>(memchr(parsePos, '\n', parseEnd - parsePos));
+    return (nullptr != lineEnd) ? lineEnd : parseEnd;
+}
+
 using TokenId = uint32_t;
 
 constexpr TokenId invalidTokenId = std::numeric_limits<TokenId>::max();
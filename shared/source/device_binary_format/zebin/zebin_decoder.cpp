@@ -389,10 +389,7 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
     auto metadataSectionData = zebinSections.zeInfoSections[0]->data;
     ConstStringRef zeinfo(reinterpret_cast<const char *>(metadataSectionData.begin()), metadataSectionData.size());
 
-    std::string logStr("\n=== ZEInfo logging begin ===\n");
-    logStr.append(zeinfo.str());
-    logStr.append("=== ZEInfo logging end ===\n");
-    DBG_LOG(LogZEInfo, logStr.c_str());
+    DBG_LOG(LogZEInfo, "\n=== ZEInfo logging begin ===\n" + zeinfo.str() + "=== ZEInfo logging end ===\n");
     setKernelMiscInfoPosition(zeinfo, dst);
     if (std::string::npos != dst.kernelMiscInfoPos) {
         zeinfo = zeinfo.substr(static_cast<size_t>(0), dst.kernelMiscInfoPos);
@@ -403,17 +400,20 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
         return decodeZeInfoError;
     }
 
+    auto kernelTextSections = buildKernelSectionsIndex(Elf::SectionNames::textPrefix, elf, zebinSections.textKernelSections);
+    auto kernelGtpinInfoSections = buildKernelSectionsIndex(Elf::SectionNames::gtpinInfo, elf, zebinSections.gtpinInfoSections);
     for (auto &kernelInfo : dst.kernelInfos) {
-        ConstStringRef kernelName(kernelInfo->kernelDescriptor.kernelMetadata.kernelName);
-        auto kernelInstructions = getKernelHeap(kernelName, elf, zebinSections);
-        if (kernelInstructions.empty()) {
-            outErrReason.append("DeviceBinaryFormat::zebin : Could not find text section for kernel " + kernelName.str() + "\n");
+        const auto &kernelName = kernelInfo->kernelDescriptor.kernelMetadata.kernelName;
+        auto kernelTextSectionIt = kernelTextSections.find(kernelName);
+        if ((kernelTextSections.end() == kernelTextSectionIt) || kernelTextSectionIt->second.empty()) {
+            outErrReason.append("DeviceBinaryFormat::zebin : Could not find text section for kernel " + kernelName + "\n");
             return DecodeError::invalidBinary;
         }
+        auto kernelInstructions = kernelTextSectionIt->second;
 
-        auto gtpinInfoForKernel = getKernelGtpinInfo(kernelName, elf, zebinSections);
-        if (false == gtpinInfoForKernel.empty()) {
-            kernelInfo->igcInfoForGtpin = reinterpret_cast<const gtpin::igc_info_t *>(gtpinInfoForKernel.begin());
+        auto kernelGtpinInfoSectionIt = kernelGtpinInfoSections.find(kernelName);
+        if ((kernelGtpinInfoSections.end() != kernelGtpinInfoSectionIt) && (false == kernelGtpinInfoSectionIt->second.empty())) {
+            kernelInfo->igcInfoForGtpin = reinterpret_cast<const gtpin::igc_info_t *>(kernelGtpinInfoSectionIt->second.begin());
         }
 
         kernelInfo->heapInfo.pKernelHeap = kernelInstructions.begin();
@@ -432,36 +432,20 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
     return DecodeError::success;
 }
 
-template ArrayRef<const uint8_t> getKernelHeap<Elf::EI_CLASS_32>(ConstStringRef &kernelName, Elf::Elf<Elf::EI_CLASS_32> &elf, const ZebinSections<Elf::EI_CLASS_32> &zebinSections);
-template ArrayRef<const uint8_t> getKernelHeap<Elf::EI_CLASS_64>(ConstStringRef &kernelName, Elf::Elf<Elf::EI_CLASS_64> &elf, const ZebinSections<Elf::EI_CLASS_64> &zebinSections);
+template KernelSectionsIndex buildKernelSectionsIndex<Elf::EI_CLASS_32>(ConstStringRef sectionNamePrefix, Elf::Elf<Elf::EI_CLASS_32> &elf, const StackVec<typename ZebinSections<Elf::EI_CLASS_32>::SectionHeaderData *, 32> &kernelSections);
+template KernelSectionsIndex buildKernelSectionsIndex<Elf::EI_CLASS_64>(ConstStringRef sectionNamePrefix, Elf::Elf<Elf::EI_CLASS_64> &elf, const StackVec<typename ZebinSections<Elf::EI_CLASS_64>::SectionHeaderData *, 32> &kernelSections);
 template <Elf::ElfIdentifierClass numBits>
-ArrayRef<const uint8_t> getKernelHeap(ConstStringRef &kernelName, Elf::Elf<numBits> &elf, const ZebinSections<numBits> &zebinSections) {
+KernelSectionsIndex buildKernelSectionsIndex(ConstStringRef sectionNamePrefix, Elf::Elf<numBits> &elf, const StackVec<typename ZebinSections<numBits>::SectionHeaderData *, 32> &kernelSections) {
     auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
     ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
-    for (auto *textSection : zebinSections.textKernelSections) {
-        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
-        auto sufix = sectionName.substr(static_cast<int>(Elf::SectionNames::textPrefix.length()));
-        if (sufix == kernelName) {
-            return textSection->data;
-        }
-    }
-    return {};
-}
-
-template ArrayRef<const uint8_t> getKernelGtpinInfo<Elf::EI_CLASS_32>(ConstStringRef &kernelName, Elf::Elf<Elf::EI_CLASS_32> &elf, const ZebinSections<Elf::EI_CLASS_32> &zebinSections);
-template ArrayRef<const uint8_t> getKernelGtpinInfo<Elf::EI_CLASS_64>(ConstStringRef &kernelName, Elf::Elf<Elf::EI_CLASS_64> &elf, const ZebinSections<Elf::EI_CLASS_64> &zebinSections);
-template <Elf::ElfIdentifierClass numBits>
-ArrayRef<const uint8_t> getKernelGtpinInfo(ConstStringRef &kernelName, Elf::Elf<numBits> &elf, const ZebinSections<numBits> &zebinSections) {
-    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
-    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
-    for (auto *gtpinInfoSection : zebinSections.gtpinInfoSections) {
-        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + gtpinInfoSection->header->name);
-        auto sufix = sectionName.substr(static_cast<int>(Elf::SectionNames::gtpinInfo.length()));
-        if (sufix == kernelName) {
-            return gtpinInfoSection->data;
-        }
+    KernelSectionsIndex index;
+    index.reserve(kernelSections.size());
+    for (auto *kernelSection : kernelSections) {
+        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + kernelSection->header->name);
+        auto kernelName = sectionName.substr(static_cast<int>(sectionNamePrefix.length()));
+        index.emplace(std::string_view(kernelName.data(), kernelName.size()), kernelSection->data);
     }
-    return {};
+    return index;
 }
 
 } // namespace Zebin
@@ -13,6 +13,8 @@
 #include "shared/source/utilities/stackvec.h"
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace AOT {
@@ -68,11 +70,10 @@ DecodeError validateZebinSectionsCount(const ZebinSections<numBits> &sections, s
 template <Elf::ElfIdentifierClass numBits>
 DecodeError decodeZebin(ProgramInfo &dst, Elf::Elf<numBits> &elf, std::string &outErrReason, std::string &outWarning);
 
-template <Elf::ElfIdentifierClass numBits>
-ArrayRef<const uint8_t> getKernelHeap(ConstStringRef &kernelName, Elf::Elf<numBits> &elf, const ZebinSections<numBits> &zebinSections);
+using KernelSectionsIndex = std::unordered_map<std::string_view, ArrayRef<const uint8_t>>;
 
 template <Elf::ElfIdentifierClass numBits>
-ArrayRef<const uint8_t> getKernelGtpinInfo(ConstStringRef &kernelName, Elf::Elf<numBits> &elf, const ZebinSections<numBits> &zebinSections);
+KernelSectionsIndex buildKernelSectionsIndex(ConstStringRef sectionNamePrefix, Elf::Elf<numBits> &elf, const StackVec<typename ZebinSections<numBits>::SectionHeaderData *, 32> &kernelSections);
 
 void setKernelMiscInfoPosition(ConstStringRef metadata, ProgramInfo &dst);
 
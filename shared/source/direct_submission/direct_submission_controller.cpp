@@ -9,11 +9,13 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/sleep.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -29,6 +31,12 @@ DirectSubmissionController::DirectSubmissionController() {
     if (debugManager.flags.DirectSubmissionControllerMaxTimeout.get() != -1) {
         maxTimeout = std::chrono::microseconds{debugManager.flags.DirectSubmissionControllerMaxTimeout.get()};
     }
+    if (debugManager.flags.DirectSubmissionControllerAdaptiveTimeout.get() != -1) {
+        adaptiveTimeout = !!debugManager.flags.DirectSubmissionControllerAdaptiveTimeout.get();
+    }
+    if (debugManager.flags.DirectSubmissionControllerAdaptiveTimeoutPercentile.get() != -1) {
+        adaptiveTimeoutPercentile = std::clamp(static_cast<uint32_t>(debugManager.flags.DirectSubmissionControllerAdaptiveTimeoutPercentile.get()), 1u, 100u);
+    }
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
@@ -78,9 +86,24 @@ size_t DirectSubmissionController::getTimeoutParamsMapKey(QueueThrottle throttle
 
 void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceiver *csr) {
     std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+    if (debugManager.flags.DirectSubmissionControllerPrintStatistics.get()) {
+        auto directSubmission = directSubmissions.find(csr);
+        if (directSubmission != directSubmissions.end()) {
+            printStatistics(csr, directSubmission->second);
+        }
+    }
     directSubmissions.erase(csr);
 }
 
+DirectSubmissionControllerStatistics DirectSubmissionController::getStatistics(CommandStreamReceiver *csr) {
+    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+    auto directSubmission = directSubmissions.find(csr);
+    if (directSubmission == directSubmissions.end()) {
+        return {};
+    }
+    return directSubmission->second.idleState.statistics;
+}
+
 void DirectSubmissionController::startThread() {
     directSubmissionControllingThread = Thread::create(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
 }
@@ -137,6 +160,8 @@ void DirectSubmissionController::checkNewSubmissions() {
     }
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
     bool shouldRecalculateTimeout = false;
+    const auto now = getCpuTimestamp();
+    auto nextAdaptiveTimeout = this->maxTimeout;
     for (auto &directSubmission : this->directSubmissions) {
         auto csr = directSubmission.first;
         auto &state = directSubmission.second;
@@ -145,28 +170,85 @@ void DirectSubmissionController::checkNewSubmissions() {
         if (taskCount == state.taskCount) {
             if (state.isStopped) {
                 continue;
+            } else if (this->adaptiveTimeout && !this->isIdleTimeoutElapsed(state, now)) {
+                nextAdaptiveTimeout = std::min(nextAdaptiveTimeout, state.idleState.idleTimeout);
+                continue;
             } else {
                 auto lock = csr->obtainUniqueOwnership();
                 csr->stopDirectSubmission(false);
                 state.isStopped = true;
                 shouldRecalculateTimeout = true;
                 this->lowestThrottleSubmitted = QueueThrottle::HIGH;
+                this->recordStop(state, now);
             }
         } else {
+            this->recordSubmission(csr, state, now);
             state.isStopped = false;
             state.taskCount = taskCount;
-            if (this->adjustTimeoutOnThrottleAndAcLineStatus) {
+            if (this->adaptiveTimeout) {
+                nextAdaptiveTimeout = std::min(nextAdaptiveTimeout, state.idleState.idleTimeout);
+            } else if (this->adjustTimeoutOnThrottleAndAcLineStatus) {
                 this->updateLastSubmittedThrottle(csr->getLastDirectSubmissionThrottle());
                 this->applyTimeoutForAcLineStatusAndThrottle(csr->getAcLineConnected(true));
             }
         }
     }
-    if (shouldRecalculateTimeout) {
+    if (this->adaptiveTimeout) {
+        this->timeout = std::max(nextAdaptiveTimeout, std::chrono::microseconds{adaptiveMinTimeout});
+    } else if (shouldRecalculateTimeout) {
         this->recalculateTimeout();
     }
     this->timeSinceLastCheck = getCpuTimestamp();
 }
 
+// Gaps are timestamped by the csr at each dispatch, so they are not bounded by the controller check granularity
+void DirectSubmissionController::recordSubmission(CommandStreamReceiver *csr, DirectSubmissionState &state, SteadyClock::time_point now) {
+    auto &idleState = state.idleState;
+    if (state.isStopped) {
+        if (idleState.statistics.stops > 0u) {
+            idleState.statistics.restarts++;
+            idleState.statistics.timeStopped += std::chrono::duration_cast<std::chrono::microseconds>(now - idleState.lastStateChangeTimestamp);
+        }
+        idleState.lastStateChangeTimestamp = now;
+    }
+
+    idleState.lastSubmissionTimestamp = now;
+    if (!this->adaptiveTimeout) {
+        return;
+    }
+
+    csr->moveDirectSubmissionGapSamples(idleState.gapHistogram);
+
+    if (idleState.gapHistogram.numSamples < adaptiveMinSamples) {
+        idleState.idleTimeout = this->maxTimeout;
+    } else {
+        const auto gapTimeout = std::max(idleState.gapHistogram.getGapForPercentile(this->adaptiveTimeoutPercentile), std::chrono::microseconds{adaptiveMinTimeout});
+        idleState.idleTimeout = std::min(gapTimeout, this->maxTimeout);
+    }
+}
+
+void DirectSubmissionController::recordStop(DirectSubmissionState &state, SteadyClock::time_point now) {
+    auto &idleState = state.idleState;
+    idleState.statistics.stops++;
+    idleState.statistics.timeRunning += std::chrono::duration_cast<std::chrono::microseconds>(now - idleState.lastStateChangeTimestamp);
+    idleState.lastStateChangeTimestamp = now;
+}
+
+bool DirectSubmissionController::isIdleTimeoutElapsed(const DirectSubmissionState &state, SteadyClock::time_point now) const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(now - state.idleState.lastSubmissionTimestamp) >= state.idleState.idleTimeout;
+}
+
+void DirectSubmissionController::printStatistics(CommandStreamReceiver *csr, const DirectSubmissionState &state) {
+    const auto &statistics = state.idleState.statistics;
+    PRINT_DEBUG_STRING(true, stdout, "Direct submission controller statistics - engine: %s, stops: %llu, restarts: %llu, time running: %lld us, time stopped: %lld us, idle timeout: %lld us\n",
+                       EngineHelpers::engineTypeToString(csr->getOsContext().getEngineType()).c_str(),
+                       static_cast<unsigned long long>(statistics.stops),
+                       static_cast<unsigned long long>(statistics.restarts),
+                       static_cast<long long>(statistics.timeRunning.count()),
+                       static_cast<long long>(statistics.timeStopped.count()),
+                       static_cast<long long>(state.idleState.idleTimeout.count()));
+}
+
 bool DirectSubmissionController::sleep(std::unique_lock<std::mutex> &lock) {
     return NEO::waitOnConditionWithPredicate(condVar, lock, std::chrono::microseconds(this->timeout), [&] { return !pagingFenceRequests.empty(); });
 }
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/queue_throttle.h"
 #include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/direct_submission/submission_gap_histogram.h"
 #include "shared/source/helpers/device_bitfield.h"
 
 #include <array>
@@ -35,6 +36,13 @@ struct TimeoutParams {
     bool directSubmissionEnabled;
 };
 
+struct DirectSubmissionControllerStatistics {
+    uint64_t stops = 0u;
+    uint64_t restarts = 0u;
+    std::chrono::microseconds timeRunning{0};
+    std::chrono::microseconds timeStopped{0};
+};
+
 struct WaitForPagingFenceRequest {
     CommandStreamReceiver *csr;
     uint64_t pagingFenceValue;
@@ -43,6 +51,9 @@ struct WaitForPagingFenceRequest {
 class DirectSubmissionController {
   public:
     static constexpr size_t defaultTimeout = 5'000;
+    static constexpr size_t adaptiveMinTimeout = 100;
+    static constexpr uint32_t adaptiveMinSamples = 8u;
+    static constexpr uint32_t defaultAdaptiveTimeoutPercentile = 90u;
     DirectSubmissionController();
     virtual ~DirectSubmissionController();
 
@@ -58,11 +69,22 @@ class DirectSubmissionController {
 
     void enqueueWaitForPagingFence(CommandStreamReceiver *csr, uint64_t pagingFenceValue);
 
+    DirectSubmissionControllerStatistics getStatistics(CommandStreamReceiver *csr);
+
   protected:
+    struct IdleState {
+        SubmissionGapHistogram gapHistogram;
+        DirectSubmissionControllerStatistics statistics;
+        SteadyClock::time_point lastSubmissionTimestamp{};
+        SteadyClock::time_point lastStateChangeTimestamp{};
+        std::chrono::microseconds idleTimeout{defaultTimeout};
+    };
+
     struct DirectSubmissionState {
         DirectSubmissionState(DirectSubmissionState &&other) {
             isStopped = other.isStopped.load();
             taskCount = other.taskCount.load();
+            idleState = other.idleState;
         }
         DirectSubmissionState &operator=(const DirectSubmissionState &other) {
             if (this == &other) {
@@ -70,6 +92,7 @@ class DirectSubmissionController {
             }
             this->isStopped = other.isStopped.load();
             this->taskCount = other.taskCount.load();
+            this->idleState = other.idleState;
             return *this;
         }
 
@@ -81,6 +104,7 @@ class DirectSubmissionController {
 
         std::atomic_bool isStopped{true};
         std::atomic<TaskCountType> taskCount{0};
+        IdleState idleState;
     };
 
     static void *controlDirectSubmissionsState(void *self);
@@ -94,6 +118,11 @@ class DirectSubmissionController {
     void updateLastSubmittedThrottle(QueueThrottle throttle);
     size_t getTimeoutParamsMapKey(QueueThrottle throttle, bool acLineStatus);
 
+    void recordSubmission(CommandStreamReceiver *csr, DirectSubmissionState &state, SteadyClock::time_point now);
+    void recordStop(DirectSubmissionState &state, SteadyClock::time_point now);
+    bool isIdleTimeoutElapsed(const DirectSubmissionState &state, SteadyClock::time_point now) const;
+    void printStatistics(CommandStreamReceiver *csr, const DirectSubmissionState &state);
+
     void handlePagingFenceRequests(std::unique_lock<std::mutex> &lock, bool checkForNewSubmissions);
     MOCKABLE_VIRTUAL bool timeoutElapsed();
 
@@ -114,6 +143,8 @@ class DirectSubmissionController {
     std::unordered_map<size_t, TimeoutParams> timeoutParamsMap;
     QueueThrottle lowestThrottleSubmitted = QueueThrottle::HIGH;
     bool adjustTimeoutOnThrottleAndAcLineStatus = false;
+    bool adaptiveTimeout = false;
+    uint32_t adaptiveTimeoutPercentile = defaultAdaptiveTimeoutPercentile;
 
     std::condition_variable condVar;
     std::mutex condVarMutex;
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/queue_throttle.h"
+#include "shared/source/direct_submission/submission_gap_histogram.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/stackvec.h"
@@ -102,6 +103,10 @@ class DirectSubmissionHw {
         return this->lastSubmittedThrottle;
     }
 
+    SubmissionGapRecorder &getSubmissionGapRecorder() {
+        return this->submissionGapRecorder;
+    }
+
     virtual void unblockPagingFenceSemaphore(uint64_t pagingFenceValue){};
 
   protected:
@@ -122,6 +127,8 @@ class DirectSubmissionHw {
     uint64_t switchRingBuffers(ResidencyContainer *allocationsForResidency);
     virtual void handleSwitchRingBuffers(ResidencyContainer *allocationsForResidency) = 0;
     GraphicsAllocation *switchRingBuffersAllocations();
+    GraphicsAllocation *allocateRingBuffer();
+    void printStatistics();
 
     constexpr static uint64_t updateTagValueFail = std::numeric_limits<uint64_t>::max();
     virtual uint64_t updateTagValue(bool requireMonitorFence) = 0;
@@ -208,6 +215,10 @@ class DirectSubmissionHw {
     uint32_t previousRingBuffer = 0u;
     uint32_t maxRingBufferCount = std::numeric_limits<uint32_t>::max();
 
+    uint64_t ringBufferSwitches = 0u;
+    uint64_t bytesCopiedIntoRing = 0u;
+    uint64_t semaphoreWaits = 0u;
+
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
 
@@ -244,6 +255,7 @@ class DirectSubmissionHw {
     volatile uint32_t reserved = 0u;
     uint32_t dispatchErrorCode = 0;
     QueueThrottle lastSubmittedThrottle = QueueThrottle::MEDIUM;
+    SubmissionGapRecorder submissionGapRecorder;
 
     bool ringStart = false;
     bool disableCpuCacheFlush = true;
@@ -262,5 +274,6 @@ class DirectSubmissionHw {
     bool relaxedOrderingInitialized = false;
     bool relaxedOrderingSchedulerRequired = false;
     bool inputMonitorFenceDispatchRequirement = true;
+    bool recordSubmissionGaps = false;
 };
 } // namespace NEO
@@ -19,6 +19,7 @@
 #include "shared/source/gmm_helper/gmm_lib.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/definitions/command_encoder_args.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -59,6 +60,13 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
         this->maxRingBufferCount = debugManager.flags.DirectSubmissionMaxRingBuffers.get();
     }
 
+    if (debugManager.flags.DirectSubmissionPreallocatedRingBuffers.get() != -1) {
+        auto preallocatedRingBufferCount = std::min(static_cast<uint32_t>(debugManager.flags.DirectSubmissionPreallocatedRingBuffers.get()), this->maxRingBufferCount);
+        preallocatedRingBufferCount = std::max(preallocatedRingBufferCount, RingBufferUse::initialRingBufferCount);
+        this->ringBuffers.resize(preallocatedRingBufferCount);
+        this->maxRingBufferCount = std::min(this->maxRingBufferCount, preallocatedRingBufferCount);
+    }
+
     if (debugManager.flags.DirectSubmissionDisableCacheFlush.get() != -1) {
         disableCacheFlush = !!debugManager.flags.DirectSubmissionDisableCacheFlush.get();
     }
@@ -67,6 +75,8 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
         detectGpuHang = !!debugManager.flags.DirectSubmissionDetectGpuHang.get();
     }
 
+    recordSubmissionGaps = debugManager.flags.DirectSubmissionControllerAdaptiveTimeout.get() == 1;
+
     if (hwInfo->capabilityTable.isIntegratedDevice) {
         miMemFenceRequired = false;
     } else {
@@ -326,19 +336,13 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
 
     bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
     constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
-    constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
-    const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
-    const AllocationProperties commandStreamAllocationProperties{rootDeviceIndex,
-                                                                 true, allocationSize,
-                                                                 AllocationType::ringBuffer,
-                                                                 isMultiOsContextCapable, false, osContext.getDeviceBitfield()};
 
-    for (uint32_t ringBufferIndex = 0; ringBufferIndex < RingBufferUse::initialRingBufferCount; ringBufferIndex++) {
-        auto ringBuffer = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+    for (uint32_t ringBufferIndex = 0; ringBufferIndex < this->ringBuffers.size(); ringBufferIndex++) {
+        auto ringBuffer = allocateRingBuffer();
         this->ringBuffers[ringBufferIndex].ringBuffer = ringBuffer;
         UNRECOVERABLE_IF(ringBuffer == nullptr);
         allocations.push_back(ringBuffer);
-        memset(ringBuffer->getUnderlyingBuffer(), 0, allocationSize);
+        memset(ringBuffer->getUnderlyingBuffer(), 0, ringBuffer->getUnderlyingBufferSize());
     }
 
     const AllocationProperties semaphoreAllocationProperties{rootDeviceIndex,
@@ -380,7 +384,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
     }
 
     if (debugManager.flags.DirectSubmissionPrintBuffers.get()) {
-        for (uint32_t ringBufferIndex = 0; ringBufferIndex < RingBufferUse::initialRingBufferCount; ringBufferIndex++) {
+        for (uint32_t ringBufferIndex = 0; ringBufferIndex < this->ringBuffers.size(); ringBufferIndex++) {
             const auto ringBuffer = this->ringBuffers[ringBufferIndex].ringBuffer;
 
             printf("Ring buffer %u - gpu address: %" PRIx64 " - %" PRIx64 ", cpu address: %p - %p, size: %zu \n",
@@ -548,6 +552,7 @@ inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchSemaphoreSection(
     using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
 
     dispatchDisablePrefetcher(true);
+    this->semaphoreWaits++;
 
     if (this->relaxedOrderingEnabled && this->relaxedOrderingSchedulerRequired) {
         dispatchRelaxedOrderingSchedulerSection(value);
@@ -713,6 +718,7 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
             auto sizeToCopy = ptrDiff(returnCmd, cmdStreamTaskPtr);
             auto ringPtr = ringCommandStream.getSpace(sizeToCopy);
             memcpy(ringPtr, cmdStreamTaskPtr, sizeToCopy);
+            this->bytesCopiedIntoRing += sizeToCopy;
         } else {
             dispatchStartSection(commandStreamAddress);
         }
@@ -950,6 +956,9 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchUllsState() {
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp) {
     lastSubmittedThrottle = batchBuffer.throttle;
+    if (this->recordSubmissionGaps) {
+        submissionGapRecorder.recordSubmission(std::chrono::steady_clock::now());
+    }
     bool relaxedOrderingSchedulerWillBeNeeded = (this->relaxedOrderingSchedulerRequired || batchBuffer.hasRelaxedOrderingDependencies);
     bool inputRequiredMonitorFence = false;
     if (this->inputMonitorFenceDispatchRequirement) {
@@ -1081,6 +1090,7 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffersNeeded(size_t s
 template <typename GfxFamily, typename Dispatcher>
 inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers(ResidencyContainer *allocationsForResidency) {
     GraphicsAllocation *nextRingBuffer = switchRingBuffersAllocations();
+    this->ringBufferSwitches++;
     void *flushPtr = ringCommandStream.getSpace(0);
     uint64_t currentBufferGpuVa = ringCommandStream.getCurrentGpuAddressPosition();
 
@@ -1114,15 +1124,7 @@ inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRing
             this->currentRingBuffer = (this->currentRingBuffer + 1) % this->ringBuffers.size();
             nextAllocation = this->ringBuffers[this->currentRingBuffer].ringBuffer;
         } else {
-            bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
-            constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
-            constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
-            const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
-            const AllocationProperties commandStreamAllocationProperties{rootDeviceIndex,
-                                                                         true, allocationSize,
-                                                                         AllocationType::ringBuffer,
-                                                                         isMultiOsContextCapable, false, osContext.getDeviceBitfield()};
-            nextAllocation = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+            nextAllocation = allocateRingBuffer();
             this->currentRingBuffer = static_cast<uint32_t>(this->ringBuffers.size());
             this->ringBuffers.emplace_back(0ull, nextAllocation);
             auto ret = memoryOperationHandler->makeResidentWithinOsContext(&this->osContext, ArrayRef<GraphicsAllocation *>(&nextAllocation, 1u), false) == MemoryOperationsStatus::success;
@@ -1133,6 +1135,29 @@ inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRing
     return nextAllocation;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::allocateRingBuffer() {
+    bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
+    constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
+    constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
+    const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
+    const AllocationProperties commandStreamAllocationProperties{rootDeviceIndex,
+                                                                 true, allocationSize,
+                                                                 AllocationType::ringBuffer,
+                                                                 isMultiOsContextCapable, false, osContext.getDeviceBitfield()};
+    return memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::printStatistics() {
+    PRINT_DEBUG_STRING(true, stdout, "Direct submission statistics - engine: %s, ring buffers: %zu, ring buffer switches: %" PRIu64 ", bytes copied into ring: %" PRIu64 ", semaphore waits: %" PRIu64 "\n",
+                       EngineHelpers::engineTypeToString(this->osContext.getEngineType()).c_str(),
+                       this->ringBuffers.size(),
+                       this->ringBufferSwitches,
+                       this->bytesCopiedIntoRing,
+                       this->semaphoreWaits);
+}
+
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchMonitorFenceRequired(bool requireMonitorFence) {
     return !this->disableMonitorFence;
@@ -1140,6 +1165,9 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchMonitorFenceRequired(boo
 
 template <typename GfxFamily, typename Dispatcher>
 void DirectSubmissionHw<GfxFamily, Dispatcher>::deallocateResources() {
+    if (debugManager.flags.DirectSubmissionPrintStatistics.get()) {
+        printStatistics();
+    }
     for (uint32_t ringBufferIndex = 0; ringBufferIndex < this->ringBuffers.size(); ringBufferIndex++) {
         memoryManager->freeGraphicsMemory(this->ringBuffers[ringBufferIndex].ringBuffer);
     }
@@ -1238,6 +1266,7 @@ uint32_t DirectSubmissionHw<GfxFamily, Dispatcher>::getDispatchErrorCode() {
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchSemaphoreForPagingFence(uint64_t value) {
     using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
+    this->semaphoreWaits++;
     EncodeSemaphore<GfxFamily>::addMiSemaphoreWaitCommand(ringCommandStream,
                                                           this->gpuVaForPagingFenceSemaphore,
                                                           value,
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/submission_gap_histogram.h"
+
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+uint32_t SubmissionGapHistogram::getBucketIndex(std::chrono::microseconds gap) {
+    const auto gapCount = static_cast<uint64_t>(std::max(gap.count(), static_cast<std::chrono::microseconds::rep>(0)));
+    return gapCount == 0u ? 0u : std::min(Math::log2(gapCount) + 1u, numBuckets - 1u);
+}
+
+void SubmissionGapHistogram::addSample(std::chrono::microseconds gap) {
+    addSamples(getBucketIndex(gap), 1u);
+}
+
+void SubmissionGapHistogram::addSamples(uint32_t bucketIndex, uint32_t samplesCount) {
+    buckets[bucketIndex] += samplesCount;
+    numSamples += samplesCount;
+
+    if (numSamples >= decayThreshold) {
+        numSamples = 0u;
+        for (auto &bucketSamples : buckets) {
+            bucketSamples /= 2u;
+            numSamples += bucketSamples;
+        }
+    }
+}
+
+std::chrono::microseconds SubmissionGapHistogram::getGapForPercentile(uint32_t percentile) const {
+    const uint64_t requiredSamples = (static_cast<uint64_t>(numSamples) * percentile + 99u) / 100u;
+    uint64_t samples = 0u;
+    for (uint32_t bucket = 0u; bucket < numBuckets; bucket++) {
+        samples += buckets[bucket];
+        if (samples >= requiredSamples) {
+            return std::chrono::microseconds{1ll << bucket};
+        }
+    }
+    return std::chrono::microseconds{1ll << (numBuckets - 1u)};
+}
+
+void SubmissionGapRecorder::recordSubmission(std::chrono::steady_clock::time_point timestamp) {
+    if (submissionRecorded) {
+        const auto gap = std::chrono::duration_cast<std::chrono::microseconds>(timestamp - lastSubmissionTimestamp);
+        pendingSamples[SubmissionGapHistogram::getBucketIndex(gap)].fetch_add(1u, std::memory_order_relaxed);
+    }
+    lastSubmissionTimestamp = timestamp;
+    submissionRecorded = true;
+}
+
+void SubmissionGapRecorder::moveSamplesTo(SubmissionGapHistogram &histogram) {
+    for (uint32_t bucket = 0u; bucket < SubmissionGapHistogram::numBuckets; bucket++) {
+        if (auto samplesCount = pendingSamples[bucket].exchange(0u, std::memory_order_relaxed)) {
+            histogram.addSamples(bucket, samplesCount);
+        }
+    }
+}
+
+} // namespace NEO
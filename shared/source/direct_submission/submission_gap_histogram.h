@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace NEO {
+
+// Log2 histogram of gaps between submissions, bucket N holds gaps in [2^(N-1), 2^N) microseconds
+struct SubmissionGapHistogram {
+    static constexpr uint32_t numBuckets = 24u;
+    static constexpr uint32_t decayThreshold = 256u;
+
+    static uint32_t getBucketIndex(std::chrono::microseconds gap);
+    void addSample(std::chrono::microseconds gap);
+    void addSamples(uint32_t bucketIndex, uint32_t samplesCount);
+    std::chrono::microseconds getGapForPercentile(uint32_t percentile) const;
+
+    std::array<uint32_t, numBuckets> buckets = {};
+    uint32_t numSamples = 0u;
+};
+
+// Gaps between consecutive submissions of one engine. Recorded by the submitting thread
+// and moved into a histogram by the direct submission controller.
+class SubmissionGapRecorder {
+  public:
+    void recordSubmission(std::chrono::steady_clock::time_point timestamp);
+    void moveSamplesTo(SubmissionGapHistogram &histogram);
+
+  protected:
+    std::array<std::atomic<uint32_t>, SubmissionGapHistogram::numBuckets> pendingSamples = {};
+    std::chrono::steady_clock::time_point lastSubmissionTimestamp{};
+    bool submissionRecorded = false;
+};
+
+} // namespace NEO
@@ -19,6 +19,7 @@ namespace NEO {
 
 struct uint16x8_t;
 struct uint16x16_t;
+struct uint16x32_t;
 
 // This is the initial value of SIMD for local ID
 // computation.  It correlates to the SIMD lane.
@@ -41,6 +42,10 @@ LocalIDHelper::LocalIDHelper() {
         LocalIDHelper::generateSimd16 = generateLocalIDsSimd<uint16x16_t, 16>;
         LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x16_t, 32>;
     }
+    bool supportsAVX512 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvx512);
+    if (supportsAVX512) {
+        LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x32_t, 32>;
+    }
 }
 
 LocalIDHelper LocalIDHelper::initializer;
@@ -19,16 +19,20 @@
 
 namespace NEO {
 
+LocalIdsCache::LocalIdsCacheEntry::~LocalIdsCacheEntry() {
+    alignedFree(localIdsData);
+}
+
 LocalIdsCache::LocalIdsCache(size_t cacheSize, std::array<uint8_t, 3> wgDimOrder, uint32_t grfCount, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages)
-    : wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
+    : cacheSize(cacheSize), wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
       grfCount(grfCount), grfSize(grfSize), simdSize(simdSize), usesOnlyImages(usesOnlyImages) {
     UNRECOVERABLE_IF(cacheSize == 0)
-    cache.resize(cacheSize);
+    cache = std::make_unique<CacheSlot[]>(cacheSize);
 }
 
 LocalIdsCache::~LocalIdsCache() {
-    for (auto &cacheEntry : cache) {
-        alignedFree(cacheEntry.localIdsData);
+    for (size_t i = 0; i < cacheSize; i++) {
+        delete cache[i].entry.load(std::memory_order_relaxed);
     }
 }
 
@@ -50,39 +54,78 @@ size_t LocalIdsCache::getLocalIdsSizePerThread() const {
     return localIdsSizePerThread;
 }
 
-void LocalIdsCache::setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination) {
-    entry.accessCounter++;
-    std::memcpy(destination, entry.localIdsData, entry.localIdsSize);
+bool LocalIdsCache::setLocalIdsFromCache(const Vec3<uint16_t> &group, void *destination) {
+    activeReaders.fetch_add(1u, std::memory_order_seq_cst);
+
+    bool entryFound = false;
+    for (size_t i = 0; i < cacheSize; i++) {
+        auto entry = cache[i].entry.load(std::memory_order_seq_cst);
+        if (entry != nullptr && entry->groupSize == group) {
+            cache[i].lastAccess.store(accessClock.fetch_add(1u, std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+            std::memcpy(destination, entry->localIdsData, entry->localIdsSize);
+            entryFound = true;
+            break;
+        }
+    }
+
+    activeReaders.fetch_sub(1u, std::memory_order_release);
+    return entryFound;
 }
 
 void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    if (setLocalIdsFromCache(group, destination)) {
+        return;
+    }
+
     auto setLocalIdsLock = lock();
-    LocalIdsCacheEntry *leastAccessedEntry = &cache[0];
-    for (auto &cacheEntry : cache) {
-        if (cacheEntry.groupSize == group) {
-            return setLocalIdsForEntry(cacheEntry, destination);
-        }
+    if (setLocalIdsFromCache(group, destination)) {
+        return;
+    }
+
+    auto &slot = getLeastRecentlyUsedSlot();
+    commitNewEntry(slot, group, rootDeviceEnvironment);
+    auto entry = slot.entry.load(std::memory_order_relaxed);
+    std::memcpy(destination, entry->localIdsData, entry->localIdsSize);
+}
 
-        if (cacheEntry.accessCounter < leastAccessedEntry->accessCounter) {
-            leastAccessedEntry = &cacheEntry;
+LocalIdsCache::CacheSlot &LocalIdsCache::getLeastRecentlyUsedSlot() {
+    auto leastRecentlyUsedSlot = &cache[0];
+    for (size_t i = 1; i < cacheSize; i++) {
+        if (cache[i].lastAccess.load(std::memory_order_relaxed) < leastRecentlyUsedSlot->lastAccess.load(std::memory_order_relaxed)) {
+            leastRecentlyUsedSlot = &cache[i];
         }
     }
-
-    commitNewEntry(*leastAccessedEntry, group, rootDeviceEnvironment);
-    setLocalIdsForEntry(*leastAccessedEntry, destination);
+    return *leastRecentlyUsedSlot;
 }
 
-void LocalIdsCache::commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) {
-    entry.localIdsSize = getLocalIdsSizeForGroup(group, rootDeviceEnvironment);
-    entry.groupSize = group;
-    entry.accessCounter = 0U;
-    if (entry.localIdsSize > entry.localIdsSizeAllocated) {
-        alignedFree(entry.localIdsData);
-        entry.localIdsData = static_cast<uint8_t *>(alignedMalloc(entry.localIdsSize, 32));
-        entry.localIdsSizeAllocated = entry.localIdsSize;
+void LocalIdsCache::commitNewEntry(CacheSlot &slot, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    auto evictedEntry = slot.entry.exchange(nullptr, std::memory_order_seq_cst);
+    if (evictedEntry != nullptr) {
+        retiredEntries.emplace_back(evictedEntry);
     }
-    NEO::generateLocalIDs(entry.localIdsData, static_cast<uint16_t>(simdSize),
+
+    // Readers that register from now on can not observe retired entries, so once no reader is active
+    // the most recently retired entry is reused and the remaining ones are released.
+    std::unique_ptr<LocalIdsCacheEntry> entry;
+    if (!retiredEntries.empty() && activeReaders.load(std::memory_order_seq_cst) == 0u) {
+        entry = std::move(retiredEntries.back());
+        retiredEntries.clear();
+    } else {
+        entry = std::make_unique<LocalIdsCacheEntry>();
+    }
+
+    entry->localIdsSize = getLocalIdsSizeForGroup(group, rootDeviceEnvironment);
+    entry->groupSize = group;
+    if (entry->localIdsSize > entry->localIdsSizeAllocated) {
+        alignedFree(entry->localIdsData);
+        entry->localIdsData = static_cast<uint8_t *>(alignedMalloc(entry->localIdsSize, 32));
+        entry->localIdsSizeAllocated = entry->localIdsSize;
+    }
+    NEO::generateLocalIDs(entry->localIdsData, static_cast<uint16_t>(simdSize),
                           {group[0], group[1], group[2]}, wgDimOrder, usesOnlyImages, grfSize, grfCount, rootDeviceEnvironment);
+
+    slot.lastAccess.store(accessClock.fetch_add(1u, std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+    slot.entry.store(entry.release(), std::memory_order_seq_cst);
 }
 
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
@@ -5,22 +5,41 @@
  *
  */
 
+#pragma once
 #include "shared/source/helpers/vec.h"
-#include "shared/source/utilities/stackvec.h"
 
 #include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 struct RootDeviceEnvironment;
+
+// LRU cache of generated per-thread local ids, keyed by work group size.
+// Simd, grf and dimensions order are fixed per cache (one cache per kernel).
+// Cache hits do not take the lock - entries are published through atomic slots and replaced ones are
+// retired until no reader can observe them. Only misses serialize on the lock to generate new data.
 class LocalIdsCache {
   public:
+    static constexpr size_t defaultCacheSize = 16u;
+
     struct LocalIdsCacheEntry {
+        LocalIdsCacheEntry() = default;
+        LocalIdsCacheEntry(const LocalIdsCacheEntry &) = delete;
+        LocalIdsCacheEntry &operator=(const LocalIdsCacheEntry &) = delete;
+        ~LocalIdsCacheEntry();
+
         Vec3<uint16_t> groupSize = {0, 0, 0};
         uint8_t *localIdsData = nullptr;
         size_t localIdsSize = 0U;
         size_t localIdsSizeAllocated = 0U;
-        size_t accessCounter = 0;
+    };
+
+    struct CacheSlot {
+        std::atomic<LocalIdsCacheEntry *> entry{nullptr};
+        std::atomic<uint64_t> lastAccess{0u};
     };
 
     LocalIdsCache() = delete;
@@ -33,13 +52,19 @@ class LocalIdsCache {
     void setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment);
     size_t getLocalIdsSizeForGroup(const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) const;
     size_t getLocalIdsSizePerThread() const;
+    size_t getCacheSize() const { return cacheSize; }
 
   protected:
-    void setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination);
-    void commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment);
+    bool setLocalIdsFromCache(const Vec3<uint16_t> &group, void *destination);
+    CacheSlot &getLeastRecentlyUsedSlot();
+    void commitNewEntry(CacheSlot &slot, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment);
     std::unique_lock<std::mutex> lock();
 
-    StackVec<LocalIdsCacheEntry, 4> cache;
+    const size_t cacheSize;
+    std::unique_ptr<CacheSlot[]> cache;
+    std::vector<std::unique_ptr<LocalIdsCacheEntry>> retiredEntries;
+    std::atomic<uint32_t> activeReaders{0u};
+    std::atomic<uint64_t> accessClock{0u};
     std::mutex setLocalIdsMutex;
     const std::array<uint8_t, 3> wgDimOrder;
     const uint32_t localIdsSizePerThread;
@@ -48,4 +73,4 @@ class LocalIdsCache {
     const uint8_t simdSize;
     const bool usesOnlyImages;
 };
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
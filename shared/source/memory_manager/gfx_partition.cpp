@@ -7,7 +7,9 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -94,7 +96,16 @@ static void reserve57BitRangeWithMemoryMapsParse(OSMemory *osMemory, OSMemory::R
     reserveRangeWithMemoryMapsParse(osMemory, reservedCpuAddressRange, areaBase, areaTop, reservationSize);
 }
 
-GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &reservedCpuAddressRangeForHeapSvm) : reservedCpuAddressRangeForHeapSvm(reservedCpuAddressRangeForHeapSvm), osMemory(OSMemory::create()) {}
+GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &reservedCpuAddressRangeForHeapSvm) : reservedCpuAddressRangeForHeapSvm(reservedCpuAddressRangeForHeapSvm), osMemory(OSMemory::create()) {
+    const auto segregatedFitHeapsMask = debugManager.flags.SegregatedFitHeapAllocatorHeapsMask.get();
+    if (segregatedFitHeapsMask > 0) {
+        for (uint32_t heapIndex = 0; heapIndex < static_cast<uint32_t>(HeapIndex::totalHeaps); heapIndex++) {
+            if (isBitSet(static_cast<uint64_t>(segregatedFitHeapsMask), heapIndex)) {
+                heaps[heapIndex].setAllocatorMode(HeapAllocatorMode::segregatedFit);
+            }
+        }
+    }
+}
 
 GfxPartition::~GfxPartition() {
     osMemory->releaseCpuAddressRange(reservedCpuAddressRangeForHeapSvm);
@@ -116,7 +127,7 @@ void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAli
         size -= 2 * heapGranularity;
     }
 
-    alloc = std::make_unique<HeapAllocator>(base + heapGranularity, size, allocationAlignment);
+    alloc = std::make_unique<HeapAllocator>(base + heapGranularity, size, allocationAlignment, HeapAllocator::defaultSizeThreshold, allocatorMode);
 }
 
 void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t size) {
@@ -125,7 +136,7 @@ void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t siz
 
     size -= GfxPartition::heapGranularity;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u, allocatorMode);
 }
 
 void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint64_t frontWindowSize) {
@@ -136,14 +147,14 @@ void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint6
     size -= GfxPartition::heapGranularity;
     size -= frontWindowSize;
 
-    alloc = std::make_unique<HeapAllocator>(base + frontWindowSize, size, MemoryConstants::pageSize);
+    alloc = std::make_unique<HeapAllocator>(base + frontWindowSize, size, MemoryConstants::pageSize, HeapAllocator::defaultSizeThreshold, allocatorMode);
 }
 
 void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size) {
     this->base = base;
     this->size = size;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u, allocatorMode);
 }
 
 uint64_t GfxPartition::Heap::allocate(size_t &size) {
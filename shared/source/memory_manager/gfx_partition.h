@@ -13,6 +13,7 @@
 
 namespace NEO {
 class HeapAllocator;
+enum class HeapAllocatorMode : uint32_t;
 
 enum class HeapIndex : uint32_t {
     heapInternalDeviceMemory = 0u,
@@ -119,10 +120,13 @@ class GfxPartition {
         uint64_t allocate(size_t &size);
         uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment);
         void free(uint64_t ptr, size_t size);
+        void setAllocatorMode(HeapAllocatorMode allocatorMode) { this->allocatorMode = allocatorMode; }
+        HeapAllocatorMode getAllocatorMode() const { return allocatorMode; }
 
       protected:
         uint64_t base = 0, size = 0;
         std::unique_ptr<HeapAllocator> alloc;
+        HeapAllocatorMode allocatorMode{};
     };
 
     Heap &getHeap(HeapIndex heapIndex) {
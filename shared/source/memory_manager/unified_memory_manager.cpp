@@ -19,6 +19,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/compression_selector.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_reuse_cleaner.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
@@ -43,20 +44,31 @@ void SVMAllocsManager::MapBasedAllocationTracker::remove(const SvmAllocationData
     allocations.erase(iter);
 }
 
+size_t SVMAllocsManager::SvmAllocationCache::getSizeClassEnd(size_t size) {
+    return std::max(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(size))), MemoryConstants::pageSize64k);
+}
+
 bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
     std::lock_guard<std::mutex> lock(this->mtx);
     if (size + this->totalSize > this->maxSize) {
         return false;
     }
-    allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
+    auto insertedIt = allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
+    insertedIt->saveTime = std::chrono::steady_clock::now();
     this->totalSize += size;
     return true;
 }
 
 void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
-         allocationIter != allocations.end();
+    auto endIter = allocations.end();
+    if (this->sizeClassesEnabled) {
+        endIter = std::upper_bound(allocations.begin(), allocations.end(), getSizeClassEnd(size), [](size_t sizeClassEnd, const SvmCacheAllocationInfo &info) {
+            return sizeClassEnd < info.allocationSize;
+        });
+    }
+    for (auto allocationIter = std::lower_bound(allocations.begin(), endIter, size);
+         allocationIter != endIter;
          ++allocationIter) {
         void *allocationPtr = allocationIter->allocation;
         SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
@@ -66,9 +78,11 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
             svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
             totalSize -= allocationIter->allocationSize;
             allocations.erase(allocationIter);
+            this->hits++;
             return allocationPtr;
         }
     }
+    this->misses++;
     return nullptr;
 }
 
@@ -79,10 +93,38 @@ void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManag
         DEBUG_BREAK_IF(nullptr == svmData);
         svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::none, svmData);
     }
+    this->evictions += this->allocations.size();
     this->allocations.clear();
     this->totalSize = 0u;
 }
 
+void SVMAllocsManager::SvmAllocationCache::trimOldAllocs(std::chrono::steady_clock::time_point trimTimePoint) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    auto newEnd = std::remove_if(this->allocations.begin(), this->allocations.end(), [&](const SvmCacheAllocationInfo &cachedAllocationInfo) {
+        if (cachedAllocationInfo.saveTime > trimTimePoint) {
+            return false;
+        }
+        SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
+        DEBUG_BREAK_IF(nullptr == svmData);
+        svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::none, svmData);
+        this->totalSize -= cachedAllocationInfo.allocationSize;
+        this->evictions++;
+        return true;
+    });
+    this->allocations.erase(newEnd, this->allocations.end());
+}
+
+SvmAllocationCacheStats SVMAllocsManager::SvmAllocationCache::getStats() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    SvmAllocationCacheStats stats;
+    stats.hits = this->hits;
+    stats.misses = this->misses;
+    stats.evictions = this->evictions;
+    stats.bytesHeld = this->totalSize;
+    stats.maxSize = this->maxSize;
+    return stats;
+}
+
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
     if (allocations.size() == 0) {
         return nullptr;
@@ -174,9 +216,17 @@ void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &co
 
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsContextSupport)
     : memoryManager(memoryManager), multiOsContextSupport(multiOsContextSupport) {
+    if (debugManager.flags.EnableLockFreeSvmAllocLookup.get() != -1) {
+        lockFreeLookupEnabled = !!debugManager.flags.EnableLockFreeSvmAllocLookup.get();
+    }
 }
 
-SVMAllocsManager::~SVMAllocsManager() = default;
+SVMAllocsManager::~SVMAllocsManager() {
+    if (unifiedMemoryReuseCleaner) {
+        unifiedMemoryReuseCleaner->unregisterSvmAllocationCache(&usmDeviceAllocationsCache);
+        unifiedMemoryReuseCleaner->unregisterSvmAllocationCache(&usmHostAllocationsCache);
+    }
+}
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationProperties svmProperties,
                                        const RootDeviceIndicesContainer &rootDeviceIndices,
@@ -438,7 +488,7 @@ void SVMAllocsManager::insertSVMAlloc(const SvmAllocationData &svmAllocData) {
 void SVMAllocsManager::removeSVMAlloc(const SvmAllocationData &svmAllocData) {
     std::unique_lock<std::shared_mutex> lock(mtx);
     internalAllocationsMap.erase(svmAllocData.getAllocId());
-    svmAllocs.remove(reinterpret_cast<void *>(svmAllocData.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    removeSVMAllocUnlocked(reinterpret_cast<void *>(svmAllocData.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
 }
 
 bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
@@ -564,6 +614,14 @@ void SVMAllocsManager::trimUSMHostAllocCache() {
     this->usmHostAllocationsCache.trim(this);
 }
 
+SvmAllocationCacheStats SVMAllocsManager::getUSMDeviceAllocCacheStats() {
+    return this->usmDeviceAllocationsCache.getStats();
+}
+
+SvmAllocationCacheStats SVMAllocsManager::getUSMHostAllocCacheStats() {
+    return this->usmHostAllocationsCache.getStats();
+}
+
 void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                                     const RootDeviceIndicesContainer &rootDeviceIndices,
                                                     const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields) {
@@ -682,7 +740,14 @@ void SVMAllocsManager::freeSVMData(SvmAllocationData *svmData) {
     std::unique_lock<std::mutex> lockForIndirect(mtxForIndirectAccess);
     std::unique_lock<std::shared_mutex> lock(mtx);
     internalAllocationsMap.erase(svmData->getAllocId());
-    svmAllocs.remove(reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    removeSVMAllocUnlocked(reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+}
+
+void SVMAllocsManager::removeSVMAllocUnlocked(const void *ptr) {
+    if (lockFreeLookupEnabled) {
+        svmAllocsLookupIndex.remove(ptr);
+    }
+    svmAllocs.remove(ptr);
 }
 
 void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
@@ -701,6 +766,10 @@ void SVMAllocsManager::initUsmDeviceAllocationsCache(Device &device) {
         fractionOfTotalMemoryForRecycling = 0.01 * std::min(100, debugManager.flags.ExperimentalEnableDeviceAllocationCache.get());
     }
     this->usmDeviceAllocationsCache.maxSize = static_cast<size_t>(fractionOfTotalMemoryForRecycling * totalDeviceMemory);
+    if (debugManager.flags.ExperimentalDeviceAllocationCacheBudget.get() != -1) {
+        this->usmDeviceAllocationsCache.maxSize = static_cast<size_t>(debugManager.flags.ExperimentalDeviceAllocationCacheBudget.get()) * MemoryConstants::megaByte;
+    }
+    initUsmAllocationsCacheCommon(this->usmDeviceAllocationsCache);
 }
 
 void SVMAllocsManager::initUsmHostAllocationsCache() {
@@ -711,6 +780,17 @@ void SVMAllocsManager::initUsmHostAllocationsCache() {
         fractionOfTotalMemoryForRecycling = 0.01 * std::min(100, debugManager.flags.ExperimentalEnableHostAllocationCache.get());
     }
     this->usmHostAllocationsCache.maxSize = static_cast<size_t>(fractionOfTotalMemoryForRecycling * totalSystemMemory);
+    if (debugManager.flags.ExperimentalHostAllocationCacheBudget.get() != -1) {
+        this->usmHostAllocationsCache.maxSize = static_cast<size_t>(debugManager.flags.ExperimentalHostAllocationCacheBudget.get()) * MemoryConstants::megaByte;
+    }
+    initUsmAllocationsCacheCommon(this->usmHostAllocationsCache);
+}
+
+void SVMAllocsManager::initUsmAllocationsCacheCommon(SvmAllocationCache &cache) {
+    cache.svmAllocsManager = this;
+    if (debugManager.flags.ExperimentalUsmAllocationCacheSizeClasses.get() != -1) {
+        cache.sizeClassesEnabled = !!debugManager.flags.ExperimentalUsmAllocationCacheSizeClasses.get();
+    }
 }
 
 void SVMAllocsManager::initUsmAllocationsCaches(Device &device) {
@@ -729,6 +809,18 @@ void SVMAllocsManager::initUsmAllocationsCaches(Device &device) {
     if (this->usmHostAllocationsCacheEnabled) {
         this->initUsmHostAllocationsCache();
     }
+
+    if (this->usmDeviceAllocationsCacheEnabled || this->usmHostAllocationsCacheEnabled) {
+        this->unifiedMemoryReuseCleaner = device.getExecutionEnvironment()->initializeUnifiedMemoryReuseCleaner();
+        if (this->unifiedMemoryReuseCleaner) {
+            if (this->usmDeviceAllocationsCacheEnabled) {
+                this->unifiedMemoryReuseCleaner->registerSvmAllocationCache(&this->usmDeviceAllocationsCache);
+            }
+            if (this->usmHostAllocationsCacheEnabled) {
+                this->unifiedMemoryReuseCleaner->registerSvmAllocationCache(&this->usmHostAllocationsCache);
+            }
+        }
+    }
 }
 
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
@@ -905,6 +997,9 @@ std::unique_lock<std::mutex> SVMAllocsManager::obtainOwnership() {
 void SVMAllocsManager::insertSVMAlloc(void *svmPtr, const SvmAllocationData &allocData) {
     std::unique_lock<std::shared_mutex> lock(mtx);
     this->svmAllocs.insert(svmPtr, allocData);
+    if (lockFreeLookupEnabled) {
+        svmAllocsLookupIndex.insert(svmPtr, allocData.size, svmAllocs.getImpl(svmPtr, false)->second.get());
+    }
     UNRECOVERABLE_IF(internalAllocationsMap.count(allocData.getAllocId()) > 0);
     for (auto alloc : allocData.gpuAllocations.getGraphicsAllocations()) {
         if (alloc != nullptr) {
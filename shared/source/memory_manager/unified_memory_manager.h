@@ -11,11 +11,13 @@
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/lock_free_pointer_index.h"
 #include "shared/source/utilities/sorted_vector.h"
 
 #include "memory_properties_flags.h"
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -28,8 +30,17 @@ class CommandStreamReceiver;
 class GraphicsAllocation;
 class MemoryManager;
 class Device;
+class UnifiedMemoryReuseCleaner;
 struct VirtualMemoryReservation;
 
+struct SvmAllocationCacheStats {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    uint64_t evictions = 0u;
+    size_t bytesHeld = 0u;
+    size_t maxSize = 0u;
+};
+
 struct SvmAllocationData {
     SvmAllocationData(uint32_t maxRootDeviceIndex) : gpuAllocations(maxRootDeviceIndex), maxRootDeviceIndex(maxRootDeviceIndex){};
     SvmAllocationData(const SvmAllocationData &svmAllocData) : SvmAllocationData(svmAllocData.maxRootDeviceIndex) {
@@ -146,6 +157,7 @@ class SVMAllocsManager {
     struct SvmCacheAllocationInfo {
         size_t allocationSize;
         void *allocation;
+        std::chrono::steady_clock::time_point saveTime{};
         SvmCacheAllocationInfo(size_t allocationSize, void *allocation) : allocationSize(allocationSize), allocation(allocation) {}
         bool operator<(SvmCacheAllocationInfo const &other) const {
             return allocationSize < other.allocationSize;
@@ -156,13 +168,22 @@ class SVMAllocsManager {
     };
 
     struct SvmAllocationCache {
+        static size_t getSizeClassEnd(size_t size);
+
         bool insert(size_t size, void *);
         void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
         void trim(SVMAllocsManager *svmAllocsManager);
+        void trimOldAllocs(std::chrono::steady_clock::time_point trimTimePoint);
+        SvmAllocationCacheStats getStats();
         std::vector<SvmCacheAllocationInfo> allocations;
         std::mutex mtx;
+        SVMAllocsManager *svmAllocsManager = nullptr;
         size_t maxSize = 0;
         size_t totalSize = 0;
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t evictions = 0u;
+        bool sizeClassesEnabled = false;
     };
 
     enum class FreePolicyType : uint32_t {
@@ -193,6 +214,9 @@ class SVMAllocsManager {
     template <typename T,
               std::enable_if_t<std::is_same_v<T, void> || std::is_same_v<T, const void>, int> = 0>
     SvmAllocationData *getSVMAlloc(T *ptr) {
+        if (lockFreeLookupEnabled) {
+            return svmAllocsLookupIndex.get(ptr);
+        }
         std::shared_lock<std::shared_mutex> lock(mtx);
         return svmAllocs.get(ptr);
     }
@@ -211,6 +235,8 @@ class SVMAllocsManager {
     bool freeSVMAlloc(void *ptr) { return freeSVMAlloc(ptr, false); }
     void trimUSMDeviceAllocCache();
     void trimUSMHostAllocCache();
+    SvmAllocationCacheStats getUSMDeviceAllocCacheStats();
+    SvmAllocationCacheStats getUSMHostAllocCacheStats();
     void insertSVMAlloc(const SvmAllocationData &svmData);
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return svmAllocs.getNumAllocs(); }
@@ -253,11 +279,14 @@ class SVMAllocsManager {
 
     void initUsmDeviceAllocationsCache(Device &device);
     void initUsmHostAllocationsCache();
+    void initUsmAllocationsCacheCommon(SvmAllocationCache &cache);
     void freeSVMData(SvmAllocationData *svmData);
     void insertSVMAlloc(void *ptr, const SvmAllocationData &allocData);
+    void removeSVMAllocUnlocked(const void *ptr);
     void makeResidentForAllocationsWithId(uint32_t allocationId, CommandStreamReceiver &csr);
 
     SortedVectorBasedAllocationTracker svmAllocs;
+    LockFreePointerIndex<SvmAllocationData> svmAllocsLookupIndex;
     MapOperationsTracker svmMapOperations;
     MapBasedAllocationTracker svmDeferFreeAllocs;
     MemoryManager *memoryManager;
@@ -268,6 +297,8 @@ class SVMAllocsManager {
     SvmAllocationCache usmHostAllocationsCache;
     bool usmDeviceAllocationsCacheEnabled = false;
     bool usmHostAllocationsCacheEnabled = false;
+    bool lockFreeLookupEnabled = false;
+    UnifiedMemoryReuseCleaner *unifiedMemoryReuseCleaner = nullptr;
     std::multimap<uint32_t, GraphicsAllocation *> internalAllocationsMap;
 };
 } // namespace NEO
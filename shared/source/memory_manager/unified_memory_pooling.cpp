@@ -15,18 +15,27 @@
 namespace NEO {
 
 bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize) {
+    return initialize(svmMemoryManager, memoryProperties, poolSize, 0u, allocationThreshold);
+}
+
+bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize, size_t minServicedSize, size_t maxServicedSize) {
     this->pool = svmMemoryManager->createUnifiedMemoryAllocation(poolSize, memoryProperties);
     if (nullptr == this->pool) {
         return false;
     }
     this->svmMemoryManager = svmMemoryManager;
     this->poolEnd = ptrOffset(this->pool, poolSize);
+    // pools dedicated to small allocations reuse freed chunks by size class instead of scanning free lists
+    auto allocatorMode = maxServicedSize < allocationThreshold ? HeapAllocatorMode::segregatedFit : HeapAllocatorMode::linearFreeLists;
     this->chunkAllocator.reset(new HeapAllocator(castToUint64(this->pool),
                                                  poolSize,
                                                  chunkAlignment,
-                                                 allocationThreshold / 2));
+                                                 allocationThreshold / 2,
+                                                 allocatorMode));
     this->poolSize = poolSize;
     this->poolMemoryType = memoryProperties.memoryType;
+    this->minServicedSize = minServicedSize;
+    this->maxServicedSize = maxServicedSize;
     return true;
 }
 
@@ -41,16 +50,24 @@ void UsmMemAllocPool::cleanup() {
         this->pool = nullptr;
         this->poolEnd = nullptr;
         this->poolSize = 0u;
+        this->minServicedSize = 0u;
+        this->maxServicedSize = 0u;
         this->poolMemoryType = InternalMemoryType::notSpecified;
     }
 }
 
+bool UsmMemAllocPool::isEmpty() {
+    std::unique_lock<std::mutex> lock(mtx);
+    return 0u == this->allocations.getNumAllocs();
+}
+
 bool UsmMemAllocPool::alignmentIsAllowed(size_t alignment) {
     return alignment % chunkAlignment == 0;
 }
 
 bool UsmMemAllocPool::canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties) {
-    return size <= allocationThreshold &&
+    return size >= minServicedSize &&
+           size <= maxServicedSize &&
            alignmentIsAllowed(memoryProperties.alignment) &&
            memoryProperties.memoryType == this->poolMemoryType &&
            memoryProperties.allocationFlags.allFlags == 0u &&
@@ -124,4 +141,193 @@ size_t UsmMemAllocPool::getOffsetInPool(const void *ptr) {
     return 0u;
 }
 
-} // namespace NEO
\ No newline at end of file
+bool UsmMemAllocPoolsManager::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t maxPoolsSize) {
+    if (nullptr == svmMemoryManager || 0u == maxPoolsSize) {
+        return false;
+    }
+    this->svmMemoryManager = svmMemoryManager;
+    this->maxPoolsSize = maxPoolsSize;
+    this->rootDeviceIndices = memoryProperties.rootDeviceIndices;
+    this->subdeviceBitfields = memoryProperties.subdeviceBitfields;
+    this->poolMemoryProperties = std::make_unique<UnifiedMemoryProperties>(memoryProperties.memoryType, memoryProperties.alignment, this->rootDeviceIndices, this->subdeviceBitfields);
+    this->poolMemoryProperties->device = memoryProperties.device;
+    return true;
+}
+
+bool UsmMemAllocPoolsManager::isInitialized() {
+    return nullptr != this->svmMemoryManager;
+}
+
+void UsmMemAllocPoolsManager::cleanup() {
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    for (auto &sizeClassPools : this->pools) {
+        for (auto &pool : sizeClassPools) {
+            pool->cleanup();
+        }
+        sizeClassPools.clear();
+    }
+    this->poolsByAddress.clear();
+    this->poolsSize = 0u;
+    this->svmMemoryManager = nullptr;
+}
+
+void UsmMemAllocPoolsManager::trim() {
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    trimUnlocked();
+}
+
+void UsmMemAllocPoolsManager::trimUnlocked() {
+    for (auto &sizeClassPools : this->pools) {
+        for (auto it = sizeClassPools.begin(); it != sizeClassPools.end();) {
+            if ((*it)->isEmpty()) {
+                this->poolsSize -= (*it)->getPoolSize();
+                this->poolsByAddress.erase((*it)->getPoolAddress());
+                (*it)->cleanup();
+                it = sizeClassPools.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+uint32_t UsmMemAllocPoolsManager::getSizeClassIndex(size_t size) {
+    for (uint32_t i = 0u; i < sizeClasses.size(); i++) {
+        if (size <= sizeClasses[i].maxServicedSize) {
+            return i;
+        }
+    }
+    UNRECOVERABLE_IF(true);
+    return 0u;
+}
+
+bool UsmMemAllocPoolsManager::canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    return isInitialized() &&
+           size <= UsmMemAllocPool::allocationThreshold &&
+           memoryProperties.alignment % UsmMemAllocPool::chunkAlignment == 0 &&
+           memoryProperties.memoryType == this->poolMemoryProperties->memoryType &&
+           memoryProperties.device == this->poolMemoryProperties->device &&
+           memoryProperties.allocationFlags.allFlags == 0u &&
+           memoryProperties.allocationFlags.allAllocFlags == 0u;
+}
+
+std::unique_ptr<UsmMemAllocPool> UsmMemAllocPoolsManager::createPool(uint32_t sizeClassIndex) {
+    auto &sizeClass = sizeClasses[sizeClassIndex];
+    auto pool = std::make_unique<UsmMemAllocPool>();
+    if (false == pool->initialize(this->svmMemoryManager, *this->poolMemoryProperties, sizeClass.poolSize, sizeClass.minServicedSize, sizeClass.maxServicedSize)) {
+        return nullptr;
+    }
+    return pool;
+}
+
+void *UsmMemAllocPoolsManager::allocateFromExistingPools(uint32_t sizeClassIndex, size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    auto &sizeClassPools = this->pools[sizeClassIndex];
+    for (auto it = sizeClassPools.rbegin(); it != sizeClassPools.rend(); ++it) {
+        if (auto pooledPtr = (*it)->createUnifiedMemoryAllocation(size, memoryProperties)) {
+            return pooledPtr;
+        }
+    }
+    return nullptr;
+}
+
+void *UsmMemAllocPoolsManager::createUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    if (false == canBePooled(size, memoryProperties)) {
+        return nullptr;
+    }
+    const auto sizeClassIndex = getSizeClassIndex(size);
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        if (auto pooledPtr = allocateFromExistingPools(sizeClassIndex, size, memoryProperties)) {
+            return pooledPtr;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    if (auto pooledPtr = allocateFromExistingPools(sizeClassIndex, size, memoryProperties)) {
+        return pooledPtr;
+    }
+
+    const auto newPoolSize = sizeClasses[sizeClassIndex].poolSize;
+    if (this->poolsSize + newPoolSize > this->maxPoolsSize) {
+        trimUnlocked();
+        if (this->poolsSize + newPoolSize > this->maxPoolsSize) {
+            return nullptr;
+        }
+    }
+
+    auto newPool = createPool(sizeClassIndex);
+    if (nullptr == newPool) {
+        trimUnlocked();
+        newPool = createPool(sizeClassIndex);
+        if (nullptr == newPool) {
+            return nullptr;
+        }
+    }
+    auto pooledPtr = newPool->createUnifiedMemoryAllocation(size, memoryProperties);
+    this->poolsSize += newPool->getPoolSize();
+    this->poolsByAddress[newPool->getPoolAddress()] = newPool.get();
+    this->pools[sizeClassIndex].push_back(std::move(newPool));
+    return pooledPtr;
+}
+
+UsmMemAllocPool *UsmMemAllocPoolsManager::getPoolContainingPtr(const void *ptr) {
+    auto poolIt = this->poolsByAddress.upper_bound(ptr);
+    if (poolIt == this->poolsByAddress.begin()) {
+        return nullptr;
+    }
+    --poolIt;
+    return poolIt->second->isInPool(ptr) ? poolIt->second : nullptr;
+}
+
+bool UsmMemAllocPoolsManager::isInPool(const void *ptr) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    return nullptr != getPoolContainingPtr(ptr);
+}
+
+bool UsmMemAllocPoolsManager::freeSVMAlloc(const void *ptr, bool blocking) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    if (auto pool = getPoolContainingPtr(ptr)) {
+        return pool->freeSVMAlloc(ptr, blocking);
+    }
+    return false;
+}
+
+size_t UsmMemAllocPoolsManager::getPooledAllocationSize(const void *ptr) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    if (auto pool = getPoolContainingPtr(ptr)) {
+        return pool->getPooledAllocationSize(ptr);
+    }
+    return 0u;
+}
+
+void *UsmMemAllocPoolsManager::getPooledAllocationBasePtr(const void *ptr) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    if (auto pool = getPoolContainingPtr(ptr)) {
+        return pool->getPooledAllocationBasePtr(ptr);
+    }
+    return nullptr;
+}
+
+size_t UsmMemAllocPoolsManager::getOffsetInPool(const void *ptr) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    if (auto pool = getPoolContainingPtr(ptr)) {
+        return pool->getOffsetInPool(ptr);
+    }
+    return 0u;
+}
+
+size_t UsmMemAllocPoolsManager::getPoolsSize() {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    return this->poolsSize;
+}
+
+size_t UsmMemAllocPoolsManager::getPoolsCount() {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    size_t poolsCount = 0u;
+    for (auto &sizeClassPools : this->pools) {
+        poolsCount += sizeClassPools.size();
+    }
+    return poolsCount;
+}
+
+} // namespace NEO
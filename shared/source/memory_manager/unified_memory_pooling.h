@@ -11,6 +11,9 @@
 #include "shared/source/utilities/heap_allocator.h"
 #include "shared/source/utilities/sorted_vector.h"
 
+#include <array>
+#include <shared_mutex>
+
 namespace NEO {
 class UsmMemAllocPool {
   public:
@@ -24,7 +27,9 @@ class UsmMemAllocPool {
 
     UsmMemAllocPool() = default;
     bool initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize);
+    bool initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize, size_t minServicedSize, size_t maxServicedSize);
     bool isInitialized();
+    bool isEmpty();
     void cleanup();
     bool alignmentIsAllowed(size_t alignment);
     bool canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties);
@@ -34,6 +39,8 @@ class UsmMemAllocPool {
     size_t getPooledAllocationSize(const void *ptr);
     void *getPooledAllocationBasePtr(const void *ptr);
     size_t getOffsetInPool(const void *ptr);
+    size_t getPoolSize() const { return poolSize; }
+    const void *getPoolAddress() const { return pool; }
 
     static constexpr auto allocationThreshold = 1 * MemoryConstants::megaByte;
     static constexpr auto chunkAlignment = 512u;
@@ -41,6 +48,8 @@ class UsmMemAllocPool {
 
   protected:
     size_t poolSize{};
+    size_t minServicedSize{};
+    size_t maxServicedSize{};
     std::unique_ptr<HeapAllocator> chunkAllocator;
     void *pool{};
     void *poolEnd{};
@@ -50,4 +59,56 @@ class UsmMemAllocPool {
     InternalMemoryType poolMemoryType;
 };
 
+// Growable set of pools split into size classes. Each class has its own pools and heap allocators, so
+// small allocations do not fragment the pools serving bigger ones and allocations of different classes
+// do not contend on the same lock. When all pools of a class are full, another pool is added as long as
+// the total size of pools stays within the limit; pools without allocations are released by trim().
+class UsmMemAllocPoolsManager {
+  public:
+    using UnifiedMemoryProperties = SVMAllocsManager::UnifiedMemoryProperties;
+    struct SizeClass {
+        size_t minServicedSize;
+        size_t maxServicedSize;
+        size_t poolSize;
+    };
+    static constexpr std::array<SizeClass, 3> sizeClasses = {{
+        {0u, 4 * MemoryConstants::kiloByte, 2 * MemoryConstants::megaByte},
+        {4 * MemoryConstants::kiloByte + 1, 64 * MemoryConstants::kiloByte, 4 * MemoryConstants::megaByte},
+        {64 * MemoryConstants::kiloByte + 1, UsmMemAllocPool::allocationThreshold, 16 * MemoryConstants::megaByte},
+    }};
+
+    UsmMemAllocPoolsManager() = default;
+    MOCKABLE_VIRTUAL ~UsmMemAllocPoolsManager() = default;
+    bool initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t maxPoolsSize);
+    bool isInitialized();
+    void cleanup();
+    void trim();
+    bool canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties);
+    void *createUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties);
+    bool isInPool(const void *ptr);
+    bool freeSVMAlloc(const void *ptr, bool blocking);
+    size_t getPooledAllocationSize(const void *ptr);
+    void *getPooledAllocationBasePtr(const void *ptr);
+    size_t getOffsetInPool(const void *ptr);
+    size_t getPoolsSize();
+    size_t getPoolsCount();
+
+  protected:
+    static uint32_t getSizeClassIndex(size_t size);
+    void *allocateFromExistingPools(uint32_t sizeClassIndex, size_t size, const UnifiedMemoryProperties &memoryProperties);
+    MOCKABLE_VIRTUAL std::unique_ptr<UsmMemAllocPool> createPool(uint32_t sizeClassIndex);
+    UsmMemAllocPool *getPoolContainingPtr(const void *ptr);
+    void trimUnlocked();
+
+    std::array<std::vector<std::unique_ptr<UsmMemAllocPool>>, sizeClasses.size()> pools;
+    std::map<const void *, UsmMemAllocPool *> poolsByAddress;
+    RootDeviceIndicesContainer rootDeviceIndices;
+    std::map<uint32_t, DeviceBitfield> subdeviceBitfields;
+    std::unique_ptr<UnifiedMemoryProperties> poolMemoryProperties;
+    SVMAllocsManager *svmMemoryManager{};
+    size_t maxPoolsSize{};
+    size_t poolsSize{};
+    std::shared_mutex mtx;
+};
+
 } // namespace NEO
\ No newline at end of file
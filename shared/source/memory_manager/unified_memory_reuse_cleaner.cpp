@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_reuse_cleaner.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+UnifiedMemoryReuseCleaner::UnifiedMemoryReuseCleaner(std::chrono::milliseconds maxHoldTime)
+    : maxHoldTime(maxHoldTime), sleepTime(std::max(std::chrono::milliseconds(1), std::min(maxSleepTime, maxHoldTime / 2))) {
+}
+
+UnifiedMemoryReuseCleaner::~UnifiedMemoryReuseCleaner() {
+    UNRECOVERABLE_IF(unifiedMemoryReuseCleanerThread);
+}
+
+void UnifiedMemoryReuseCleaner::startThread() {
+    unifiedMemoryReuseCleanerThread = Thread::create(cleanUnifiedMemoryReuse, reinterpret_cast<void *>(this));
+}
+
+void UnifiedMemoryReuseCleaner::stopThread() {
+    {
+        std::lock_guard<std::mutex> lock(condVarMutex);
+        keepCleaning.store(false);
+    }
+    condVar.notify_one();
+    if (unifiedMemoryReuseCleanerThread) {
+        unifiedMemoryReuseCleanerThread->join();
+        unifiedMemoryReuseCleanerThread.reset();
+    }
+}
+
+void *UnifiedMemoryReuseCleaner::cleanUnifiedMemoryReuse(void *self) {
+    auto cleaner = reinterpret_cast<UnifiedMemoryReuseCleaner *>(self);
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(cleaner->condVarMutex);
+            cleaner->condVar.wait_for(lock, cleaner->sleepTime, [cleaner] { return !cleaner->keepCleaning.load(); });
+        }
+        if (!cleaner->keepCleaning.load()) {
+            return nullptr;
+        }
+        cleaner->trimOldInCaches();
+    }
+}
+
+void UnifiedMemoryReuseCleaner::registerSvmAllocationCache(SvmAllocationCache *cache) {
+    std::lock_guard<std::mutex> lock(svmAllocationCachesMutex);
+    svmAllocationCaches.push_back(cache);
+}
+
+void UnifiedMemoryReuseCleaner::unregisterSvmAllocationCache(SvmAllocationCache *cache) {
+    std::lock_guard<std::mutex> lock(svmAllocationCachesMutex);
+    svmAllocationCaches.erase(std::remove(svmAllocationCaches.begin(), svmAllocationCaches.end(), cache), svmAllocationCaches.end());
+}
+
+void UnifiedMemoryReuseCleaner::trimOldInCaches() {
+    const auto trimTimePoint = std::chrono::steady_clock::now() - maxHoldTime;
+    std::lock_guard<std::mutex> lock(svmAllocationCachesMutex);
+    for (auto cache : svmAllocationCaches) {
+        cache->trimOldAllocs(trimTimePoint);
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Background thread releasing allocations which were held in usm allocation caches for longer than maxHoldTime.
+// Each pass releases only expired allocations, so caches shrink gradually instead of being trimmed all at once.
+class UnifiedMemoryReuseCleaner : NonCopyableOrMovableClass {
+    using SvmAllocationCache = SVMAllocsManager::SvmAllocationCache;
+
+  public:
+    static constexpr auto maxSleepTime = std::chrono::milliseconds(15);
+
+    UnifiedMemoryReuseCleaner(std::chrono::milliseconds maxHoldTime);
+    virtual ~UnifiedMemoryReuseCleaner();
+
+    MOCKABLE_VIRTUAL void startThread();
+    void stopThread();
+
+    void registerSvmAllocationCache(SvmAllocationCache *cache);
+    void unregisterSvmAllocationCache(SvmAllocationCache *cache);
+
+    std::chrono::milliseconds getMaxHoldTime() const { return maxHoldTime; }
+
+  protected:
+    static void *cleanUnifiedMemoryReuse(void *self);
+    void trimOldInCaches();
+
+    std::unique_ptr<Thread> unifiedMemoryReuseCleanerThread;
+    std::vector<SvmAllocationCache *> svmAllocationCaches;
+    std::mutex svmAllocationCachesMutex;
+
+    std::condition_variable condVar;
+    std::mutex condVarMutex;
+    std::atomic_bool keepCleaning = true;
+
+    const std::chrono::milliseconds maxHoldTime;
+    const std::chrono::milliseconds sleepTime;
+};
+
+} // namespace NEO
@@ -233,6 +233,7 @@ class BufferObject {
     uint32_t getOsContextId(OsContext *osContext);
 
     const auto &getBindInfo() const { return bindInfo; }
+    void setBindInfo(OsContext *osContext, uint32_t vmHandleId, bool bound) { this->bindInfo[getOsContextId(osContext)][vmHandleId] = bound; }
 
     void setChunked(bool chunked) { this->chunked = chunked; }
     bool isChunked() const { return this->chunked; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,9 +13,10 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <iostream>
-#include <queue>
 
 namespace NEO {
 
@@ -37,13 +38,21 @@ void DrmGemCloseWorker::closeThread() {
 DrmGemCloseWorker::~DrmGemCloseWorker() {
     active = false;
     closeThread();
+    processQueue();
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
-    queue.push(bo);
-    lock.unlock();
+    auto workItem = new WorkItem{bo, nullptr};
+    auto head = pendingItems.load(std::memory_order_relaxed);
+    do {
+        workItem->next = head;
+    } while (!pendingItems.compare_exchange_weak(head, workItem, std::memory_order_release, std::memory_order_relaxed));
+
+    if (head == nullptr) {
+        // worker checks for pending items under the mutex, taking it here prevents a lost wakeup
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+    }
     condition.notify_one();
 }
 
@@ -59,46 +68,73 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+GemCloseWorkerStats DrmGemCloseWorker::getStats() const {
+    GemCloseWorkerStats stats;
+    stats.drainedBatches = drainedBatches.load();
+    stats.closedObjects = closedObjects.load();
+    stats.lastDrainTimeNs = lastDrainTimeNs.load();
+    stats.maxDrainTimeNs = maxDrainTimeNs.load();
+    return stats;
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo, false);
     workCount--;
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
-    while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
-        inputQueue.pop();
-        close(workItem);
+void DrmGemCloseWorker::drainPendingItems(std::vector<BufferObject *> &batch) {
+    auto workItem = pendingItems.exchange(nullptr, std::memory_order_acquire);
+    while (workItem) {
+        batch.push_back(workItem->bo);
+        auto next = workItem->next;
+        delete workItem;
+        workItem = next;
+    }
+    // items are linked newest first, restore submission order
+    std::reverse(batch.begin(), batch.end());
+}
+
+void DrmGemCloseWorker::processQueue() {
+    std::vector<BufferObject *> batch;
+    drainPendingItems(batch);
+    if (batch.empty()) {
+        return;
+    }
+
+    auto drainStart = std::chrono::steady_clock::now();
+
+    for (auto bo : batch) {
+        close(bo);
+    }
+
+    auto drainTimeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - drainStart).count());
+    drainedBatches++;
+    closedObjects += batch.size();
+    lastDrainTimeNs = drainTimeNs;
+    if (drainTimeNs > maxDrainTimeNs.load()) {
+        maxDrainTimeNs = drainTimeNs;
     }
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
     std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
     lock.unlock();
 
     while (self->active) {
         lock.lock();
 
-        while (self->queue.empty() && self->active) {
+        while (self->pendingItems.load(std::memory_order_acquire) == nullptr && self->active) {
             self->condition.wait(lock);
         }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
-        }
-
         lock.unlock();
-        self->processQueue(localQueue);
+        self->processQueue();
     }
 
-    lock.lock();
-    self->processQueue(self->queue);
+    self->processQueue();
 
-    lock.unlock();
     self->workerDone.store(true);
     return nullptr;
 }
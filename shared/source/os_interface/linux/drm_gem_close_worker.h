@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,10 +9,9 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
-#include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -24,6 +23,13 @@ enum class GemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct GemCloseWorkerStats {
+    uint64_t drainedBatches = 0u;
+    uint64_t closedObjects = 0u;
+    uint64_t lastDrainTimeNs = 0u;
+    uint64_t maxDrainTimeNs = 0u;
+};
+
 class DrmGemCloseWorker {
   public:
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
@@ -36,19 +42,32 @@ class DrmGemCloseWorker {
     MOCKABLE_VIRTUAL void close(bool blocking);
 
     bool isEmpty();
+    GemCloseWorkerStats getStats() const;
 
   protected:
+    struct WorkItem {
+        BufferObject *bo;
+        WorkItem *next;
+    };
+
     void close(BufferObject *workItem);
     void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
+    void processQueue();
+    void drainPendingItems(std::vector<BufferObject *> &batch);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    // Multi-producer single-consumer list, producers push to the head without taking a lock
+    std::atomic<WorkItem *> pendingItems{nullptr};
     std::atomic<uint32_t> workCount{0};
 
+    std::atomic<uint64_t> drainedBatches{0u};
+    std::atomic<uint64_t> closedObjects{0u};
+    std::atomic<uint64_t> lastDrainTimeNs{0u};
+    std::atomic<uint64_t> maxDrainTimeNs{0u};
+
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
@@ -17,6 +17,9 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_context.h"
 
 namespace NEO {
@@ -47,9 +50,30 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::lock(Device *device, Arra
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto &drm = static_cast<OsContextLinux *>(osContext)->getDrm();
+    auto vmBindIoctlCountBefore = drm.getIoctlHelper()->getVmBindIoctlCount();
+
+    MemoryOperationsStatus result = MemoryOperationsStatus::success;
+    if (isVmBindBatchingEnabled()) {
+        drm.beginVmBindBatch();
+        result = makeResidentWithinOsContextImpl(osContext, gfxAllocations, evictable);
+        if (drm.endVmBindBatch() != 0 && result == MemoryOperationsStatus::success) {
+            // buffer objects from failed batch are unbound again, retry them one by one with eviction fallback
+            result = makeResidentWithinOsContextImpl(osContext, gfxAllocations, evictable);
+        }
+    } else {
+        result = makeResidentWithinOsContextImpl(osContext, gfxAllocations, evictable);
+    }
+
+    this->lastResidencyVmBindIoctlCount = drm.getIoctlHelper()->getVmBindIoctlCount() - vmBindIoctlCountBefore;
+    return result;
+}
+
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
     auto deviceBitfield = osContext->getDeviceBitfield();
 
-    std::lock_guard<std::mutex> lock(mutex);
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -149,6 +173,10 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeWithResidencyContain
     return MemoryOperationsStatus::success;
 }
 
+bool DrmMemoryOperationsHandlerBind::isVmBindBatchingEnabled() const {
+    return debugManager.flags.EnableVmBindBatching.get() == 1;
+}
+
 std::unique_lock<std::mutex> DrmMemoryOperationsHandlerBind::lockHandlerIfUsed() {
     return std::unique_lock<std::mutex>();
 }
@@ -216,6 +244,11 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
             }
         }
 
+        Drm *drm = nullptr;
+        if (isVmBindBatchingEnabled() && !evictCandidates.empty()) {
+            drm = this->rootDeviceEnvironment.osInterface->getDriverModel()->as<Drm>();
+            drm->beginVmBindBatch();
+        }
         for (auto &allocationToEvict : evictCandidates) {
             for (const auto &engine : engines) {
                 if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
@@ -225,6 +258,9 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
                 }
             }
         }
+        if (drm) {
+            drm->endVmBindBatch();
+        }
         evictCandidates.clear();
     }
 
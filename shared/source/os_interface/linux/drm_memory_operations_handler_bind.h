@@ -28,9 +28,14 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
 
     MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) override;
 
+    uint64_t getLastResidencyVmBindIoctlCount() const { return lastResidencyVmBindIoctlCount; }
+
   protected:
     MOCKABLE_VIRTUAL int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
+    MemoryOperationsStatus makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable);
     MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion);
+    bool isVmBindBatchingEnabled() const;
     const RootDeviceEnvironment &rootDeviceEnvironment;
+    uint64_t lastResidencyVmBindIoctlCount = 0u;
 };
 } // namespace NEO
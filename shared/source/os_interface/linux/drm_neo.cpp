@@ -47,6 +47,7 @@
 #include "shared/source/utilities/directory.h"
 #include "shared/source/utilities/io_functions.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <fcntl.h>
@@ -444,6 +445,57 @@ std::unique_lock<std::mutex> Drm::lockBindFenceMutex() {
     return std::unique_lock<std::mutex>(this->bindFenceMutex);
 }
 
+// Binds and unbinds issued by the owning thread between begin and end are submitted together.
+// Callers serialize batches (memory operations handler lock), other threads keep binding directly.
+void Drm::beginVmBindBatch() {
+    if (vmBindBatchDepth++ == 0u) {
+        vmBindBatchOwner.store(std::this_thread::get_id());
+        ioctlHelper->beginVmBindBatch();
+    }
+}
+
+int Drm::endVmBindBatch() {
+    UNRECOVERABLE_IF(vmBindBatchDepth == 0u);
+    if (--vmBindBatchDepth > 0u) {
+        return 0;
+    }
+
+    auto ret = ioctlHelper->endVmBindBatch();
+    for (auto osContext : vmBindBatchPagingFenceContexts) {
+        static_cast<OsContextLinux *>(osContext)->waitForPagingFence();
+    }
+
+    vmBindBatchEntries.clear();
+    vmBindBatchPagingFenceContexts.clear();
+    vmBindBatchOwner.store(std::thread::id());
+    return ret;
+}
+
+bool Drm::isVmBindBatchActive() const {
+    return vmBindBatchOwner.load() == std::this_thread::get_id();
+}
+
+void Drm::addVmBindBatchEntry(BufferObject *bo, OsContext *osContext, uint32_t vmHandleId, bool bind) {
+    vmBindBatchEntries.push_back({bo, osContext, vmHandleId, bind});
+}
+
+// Called by ioctl helper once operations queued so far were submitted.
+// Failed submission is not applied by kernel, so binding state of affected buffer objects is restored.
+void Drm::retireVmBindBatchEntries(bool applied) {
+    if (!applied) {
+        for (auto entry = vmBindBatchEntries.rbegin(); entry != vmBindBatchEntries.rend(); entry++) {
+            entry->bo->setBindInfo(entry->osContext, entry->vmHandleId, !entry->bind);
+        }
+    }
+    vmBindBatchEntries.clear();
+}
+
+void Drm::deferPagingFenceWait(OsContext *osContext) {
+    if (std::find(vmBindBatchPagingFenceContexts.begin(), vmBindBatchPagingFenceContexts.end(), osContext) == vmBindBatchPagingFenceContexts.end()) {
+        vmBindBatchPagingFenceContexts.push_back(osContext);
+    }
+}
+
 int Drm::getEuTotal(int &euTotal) {
     return getParamIoctl(DrmParam::paramEuTotal, &euTotal);
 }
@@ -1449,6 +1501,7 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
         bindIterations = 1;
     }
 
+    const bool vmBindBatchActive = drm->isVmBindBatchActive();
     int ret = 0;
     for (size_t i = 0; i < bindIterations; i++) {
 
@@ -1509,13 +1562,21 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
                 break;
             }
         }
+        // ops with extensions are never queued by ioctl helper, their binding state is final here
+        if (vmBindBatchActive && vmBind.extensions == 0u) {
+            drm->addVmBindBatchEntry(bo, osContext, vmHandleId, bind);
+        }
         bool waitOnUserFenceAfterBindAndUnbind = false;
         if (debugManager.flags.EnableWaitOnUserFenceAfterBindAndUnbind.get() != -1) {
             waitOnUserFenceAfterBindAndUnbind = !!debugManager.flags.EnableWaitOnUserFenceAfterBindAndUnbind.get();
         }
         if (ioctlHelper->isWaitBeforeBindRequired(bind) && waitOnUserFenceAfterBindAndUnbind && drm->useVMBindImmediate()) {
-            auto osContextLinux = static_cast<OsContextLinux *>(osContext);
-            osContextLinux->waitForPagingFence();
+            if (vmBindBatchActive) {
+                drm->deferPagingFenceWait(osContext);
+            } else {
+                auto osContextLinux = static_cast<OsContextLinux *>(osContext);
+                osContextLinux->waitForPagingFence();
+            }
         }
         if (incrementFenceValue) {
             if (drm->isPerContextVMRequired()) {
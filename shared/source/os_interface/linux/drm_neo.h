@@ -25,6 +25,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -244,6 +245,13 @@ class Drm : public DriverModel {
 
     [[nodiscard]] std::unique_lock<std::mutex> lockBindFenceMutex();
 
+    void beginVmBindBatch();
+    MOCKABLE_VIRTUAL int endVmBindBatch();
+    bool isVmBindBatchActive() const;
+    void addVmBindBatchEntry(BufferObject *bo, OsContext *osContext, uint32_t vmHandleId, bool bind);
+    void retireVmBindBatchEntries(bool applied);
+    void deferPagingFenceWait(OsContext *osContext);
+
     void setPciDomain(uint32_t domain) {
         pciDomain = domain;
     }
@@ -324,6 +332,17 @@ class Drm : public DriverModel {
     };
     std::unordered_map<DrmIoctl, IoctlStatisticsEntry> ioctlStatistics;
 
+    struct VmBindBatchEntry {
+        BufferObject *bo;
+        OsContext *osContext;
+        uint32_t vmHandleId;
+        bool bind;
+    };
+    std::vector<VmBindBatchEntry> vmBindBatchEntries;
+    std::vector<OsContext *> vmBindBatchPagingFenceContexts;
+    std::atomic<std::thread::id> vmBindBatchOwner{};
+    uint32_t vmBindBatchDepth = 0u;
+
     std::mutex bindFenceMutex;
     std::array<uint64_t, EngineLimits::maxHandleCount> pagingFence;
     std::array<uint64_t, EngineLimits::maxHandleCount> fenceVal;
@@ -23,6 +23,9 @@
 namespace NEO {
 
 int IoctlHelper::ioctl(DrmIoctl request, void *arg) {
+    if (request == DrmIoctl::gemVmBind || request == DrmIoctl::gemVmUnbind) {
+        vmBindIoctlCount.fetch_add(1u, std::memory_order_relaxed);
+    }
     return drm.ioctl(request, arg);
 }
 
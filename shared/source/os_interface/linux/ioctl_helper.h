@@ -15,6 +15,7 @@
 
 #include "igfxfmid.h"
 
+#include <atomic>
 #include <cinttypes>
 #include <cstddef>
 #include <cstdint>
@@ -212,8 +213,13 @@ class IoctlHelper {
     virtual bool allocateInterrupt(uint32_t &outHandle) { return false; }
     virtual bool releaseInterrupt(uint32_t handle) { return false; }
 
+    virtual void beginVmBindBatch() { return; }
+    virtual int endVmBindBatch() { return 0; }
+    uint64_t getVmBindIoctlCount() const { return vmBindIoctlCount.load(std::memory_order_relaxed); }
+
   protected:
     Drm &drm;
+    std::atomic<uint64_t> vmBindIoctlCount{0u};
 };
 
 class IoctlHelperI915 : public IoctlHelper {
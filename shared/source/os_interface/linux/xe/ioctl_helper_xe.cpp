@@ -1320,6 +1320,17 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
 
         bindInfo[index].addr = bind.bind.addr;
 
+        if (drm.isVmBindBatchActive()) {
+            // extension chain is owned by the caller and released once this call returns,
+            // so ops with extensions are submitted directly after the ops queued so far
+            if (bind.bind.extensions == 0u) {
+                return queueVmBindOp(bind.vm_id, bind.bind, sync[0].addr, sync[0].timeline_value);
+            }
+            if (ret = submitPendingVmBindOps(); ret != 0) {
+                return ret;
+            }
+        }
+
         ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
 
         xeLog(" vm=%d obj=0x%x off=0x%llx range=0x%llx addr=0x%llx operation=%d(%s) flags=%d(%s) nsy=%d pat=%hu ret=%d\n",
@@ -1341,17 +1352,7 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
             return ret;
         }
 
-        constexpr auto oneSecTimeout = 1000000000ll;
-        constexpr auto infiniteTimeout = -1;
-        bool debuggingEnabled = drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled();
-        uint64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
-        if (debugManager.flags.VmBindWaitUserFenceTimeout.get() != -1) {
-            timeout = debugManager.flags.VmBindWaitUserFenceTimeout.get();
-        }
-        return xeWaitUserFence(bind.exec_queue_id, DRM_XE_UFENCE_WAIT_OP_EQ,
-                               sync[0].addr,
-                               sync[0].timeline_value, timeout,
-                               false, NEO::InterruptId::notUsed, nullptr);
+        return waitForVmBindFence(sync[0].addr, sync[0].timeline_value);
     }
 
     xeLog("error:  -> IoctlHelperXe::%s %s index=%d vmid=0x%x h=0x%x s=0x%llx o=0x%llx l=0x%llx f=0x%llx pat=%hu r=%d\n",
@@ -1362,6 +1363,81 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
     return ret;
 }
 
+int IoctlHelperXe::waitForVmBindFence(uint64_t fenceAddress, uint64_t fenceValue) {
+    constexpr auto oneSecTimeout = 1000000000ll;
+    constexpr auto infiniteTimeout = -1;
+    bool debuggingEnabled = drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled();
+    uint64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
+    if (debugManager.flags.VmBindWaitUserFenceTimeout.get() != -1) {
+        timeout = debugManager.flags.VmBindWaitUserFenceTimeout.get();
+    }
+    return xeWaitUserFence(0u, DRM_XE_UFENCE_WAIT_OP_EQ, fenceAddress, fenceValue, timeout,
+                           false, NEO::InterruptId::notUsed, nullptr);
+}
+
+void IoctlHelperXe::beginVmBindBatch() {
+    vmBindBatchResult = 0;
+}
+
+int IoctlHelperXe::endVmBindBatch() {
+    submitPendingVmBindOps();
+    auto ret = vmBindBatchResult;
+    vmBindBatchResult = 0;
+    return ret;
+}
+
+// Ops of one vm bound with the same fence are executed in order by the vm bind queue,
+// so the whole batch is submitted as a single array bind and waited for on the fence value of the last op.
+int IoctlHelperXe::queueVmBindOp(uint32_t vmId, const drm_xe_vm_bind_op &bindOp, uint64_t fenceAddress, uint64_t fenceValue) {
+    if (!pendingVmBindOps.empty() && (pendingVmBindVmId != vmId || pendingVmBindFenceAddress != fenceAddress)) {
+        auto ret = submitPendingVmBindOps();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    pendingVmBindOps.push_back(bindOp);
+    pendingVmBindVmId = vmId;
+    pendingVmBindFenceAddress = fenceAddress;
+    pendingVmBindFenceValue = fenceValue;
+    return 0;
+}
+
+int IoctlHelperXe::submitPendingVmBindOps() {
+    if (pendingVmBindOps.empty()) {
+        return 0;
+    }
+
+    drm_xe_sync sync[1] = {};
+    sync[0].type = DRM_XE_SYNC_TYPE_USER_FENCE;
+    sync[0].flags = DRM_XE_SYNC_FLAG_SIGNAL;
+    sync[0].addr = pendingVmBindFenceAddress;
+    sync[0].timeline_value = pendingVmBindFenceValue;
+
+    drm_xe_vm_bind bind = {};
+    bind.vm_id = pendingVmBindVmId;
+    bind.num_binds = static_cast<uint32_t>(pendingVmBindOps.size());
+    bind.num_syncs = 1;
+    bind.syncs = reinterpret_cast<uintptr_t>(&sync);
+    if (bind.num_binds == 1) {
+        bind.bind = pendingVmBindOps[0];
+    } else {
+        bind.vector_of_binds = reinterpret_cast<uintptr_t>(pendingVmBindOps.data());
+    }
+
+    auto ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
+    xeLog(" -> IoctlHelperXe::%s vm=%d nbinds=%u ret=%d\n", __FUNCTION__, bind.vm_id, bind.num_binds, ret);
+    if (ret == 0) {
+        ret = waitForVmBindFence(sync[0].addr, sync[0].timeline_value);
+    }
+
+    pendingVmBindOps.clear();
+    drm.retireVmBindBatchEntries(ret == 0);
+    if (ret != 0 && vmBindBatchResult == 0) {
+        vmBindBatchResult = ret;
+    }
+    return ret;
+}
+
 std::string IoctlHelperXe::getDrmParamString(DrmParam drmParam) const {
     switch (drmParam) {
     case DrmParam::contextCreateExtSetparam:
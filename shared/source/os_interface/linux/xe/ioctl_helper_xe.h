@@ -21,6 +21,7 @@ namespace XeDrm {
 struct drm_xe_engine_class_instance;
 struct drm_xe_query_gt_list;
 struct drm_xe_query_config;
+struct drm_xe_vm_bind_op;
 } // namespace XeDrm
 
 enum class EngineClass : uint16_t;
@@ -133,6 +134,8 @@ class IoctlHelperXe : public IoctlHelper {
     void registerBOBindHandle(Drm *drm, DrmAllocation *drmAllocation) override;
     bool resourceRegistrationEnabled() override { return true; }
     bool isPreemptionSupported() override { return true; }
+    void beginVmBindBatch() override;
+    int endVmBindBatch() override;
 
   protected:
     static constexpr uint32_t maxContextSetProperties = 4;
@@ -146,6 +149,9 @@ class IoctlHelperXe : public IoctlHelper {
     virtual int xeWaitUserFence(uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout, bool userInterrupt, uint32_t externalInterruptId, GraphicsAllocation *allocForInterruptWait);
     void setupXeWaitUserFenceStruct(void *arg, uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout);
     int xeVmBind(const VmBindParams &vmBindParams, bool bindOp);
+    int waitForVmBindFence(uint64_t fenceAddress, uint64_t fenceValue);
+    int queueVmBindOp(uint32_t vmId, const XeDrm::drm_xe_vm_bind_op &bindOp, uint64_t fenceAddress, uint64_t fenceValue);
+    int submitPendingVmBindOps();
     void xeShowBindTable();
     void updateBindInfo(uint32_t handle, uint64_t userPtr, uint64_t size);
     int debuggerOpenIoctl(DrmIoctl request, void *arg);
@@ -181,6 +187,12 @@ class IoctlHelperXe : public IoctlHelper {
     std::vector<uint32_t> hwconfig;
     std::vector<XeDrm::drm_xe_engine_class_instance> contextParamEngine;
 
+    std::vector<XeDrm::drm_xe_vm_bind_op> pendingVmBindOps;
+    uint64_t pendingVmBindFenceAddress = 0u;
+    uint64_t pendingVmBindFenceValue = 0u;
+    uint32_t pendingVmBindVmId = 0u;
+    int vmBindBatchResult = 0;
+
     std::vector<uint64_t> queryGtListData;
     constexpr static int invalidIndex = -1;
     StackVec<int, 2> gtIdToTileId;
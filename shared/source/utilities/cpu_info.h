@@ -21,6 +21,7 @@ struct CpuInfo {
     static const uint64_t featureWaitPkg = 0x000000001ULL;
     static const uint64_t featureAvX2 = 0x000800000ULL;
     static const uint64_t featureNeon = 0x001000000ULL;
+    static const uint64_t featureAvx512 = 0x002000000ULL;
     static const uint64_t featureClflush = 0x2000000000ULL;
 
     CpuInfo() : features(featureNone) {
@@ -35,6 +36,8 @@ struct CpuInfo {
         uint32_t functionId,
         uint32_t subfunctionId) const;
 
+    uint64_t xgetbv(uint32_t xcr) const;
+
     void detect() const;
 
     bool isFeatureSupported(uint64_t feature) const {
@@ -67,6 +70,7 @@ struct CpuInfo {
 
     static void (*cpuidexFunc)(int *, int, int);
     static void (*cpuidFunc)(int *, int);
+    static uint64_t (*xgetbvFunc)(uint32_t);
     static void (*getCpuFlagsFunc)(std::string &);
 
   protected:
@@ -8,6 +8,7 @@
 #include "shared/source/utilities/heap_allocator.h"
 
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/utilities/logger.h"
 
 #include <algorithm>
@@ -32,6 +33,15 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
         return 0llu;
     }
 
+    if (mode == HeapAllocatorMode::segregatedFit) {
+        auto ptrReturn = allocateSegregatedFit(sizeToAllocate, alignment);
+        if (ptrReturn != 0llu) {
+            availableSize -= sizeToAllocate;
+            DEBUG_BREAK_IF(!isAligned(ptrReturn, alignment));
+        }
+        return ptrReturn;
+    }
+
     std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
     uint32_t defragmentCount = 0;
 
@@ -89,6 +99,12 @@ void HeapAllocator::free(uint64_t ptr, size_t size) {
     std::lock_guard<std::mutex> lock(mtx);
     DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
 
+    if (mode == HeapAllocatorMode::segregatedFit) {
+        freeSegregatedFit(ptr, size);
+        availableSize += size;
+        return;
+    }
+
     if (ptr == pRightBound) {
         pRightBound = ptr + size;
         mergeLastFreedSmall();
@@ -200,4 +216,111 @@ void HeapAllocator::defragment() {
     DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
 }
 
+uint64_t HeapAllocator::allocateSegregatedFit(size_t sizeToAllocate, size_t alignment) {
+    const bool allocateFromTop = sizeToAllocate <= sizeThreshold;
+
+    uint64_t ptrReturn = getFromFreeRanges(sizeToAllocate, alignment, allocateFromTop);
+    if (ptrReturn != 0llu) {
+        return ptrReturn;
+    }
+
+    if (allocateFromTop) {
+        const uint64_t pStart = pRightBound - sizeToAllocate;
+        const uint64_t misalignment = pStart - alignDown(pStart, alignment);
+        if (pLeftBound + sizeToAllocate + misalignment <= pRightBound) {
+            if (misalignment) {
+                pRightBound -= misalignment;
+                insertFreeRange(pRightBound, static_cast<size_t>(misalignment));
+            }
+            pRightBound -= sizeToAllocate;
+            ptrReturn = pRightBound;
+        }
+    } else {
+        const uint64_t misalignment = alignUp(pLeftBound, alignment) - pLeftBound;
+        if (pLeftBound + misalignment + sizeToAllocate <= pRightBound) {
+            if (misalignment) {
+                insertFreeRange(pLeftBound, static_cast<size_t>(misalignment));
+                pLeftBound += misalignment;
+            }
+            ptrReturn = pLeftBound;
+            pLeftBound += sizeToAllocate;
+        }
+    }
+    return ptrReturn;
+}
+
+void HeapAllocator::freeSegregatedFit(uint64_t ptr, size_t size) {
+    uint64_t rangeStart = ptr;
+    uint64_t rangeEnd = ptr + size;
+
+    auto nextIt = freeRangesByAddress.lower_bound(rangeStart);
+    if (nextIt != freeRangesByAddress.end() && nextIt->first == rangeEnd) {
+        rangeEnd += nextIt->second;
+        eraseFreeRange(nextIt);
+        nextIt = freeRangesByAddress.lower_bound(rangeStart);
+    }
+    if (nextIt != freeRangesByAddress.begin()) {
+        auto prevIt = std::prev(nextIt);
+        if (prevIt->first + prevIt->second == rangeStart) {
+            rangeStart = prevIt->first;
+            eraseFreeRange(prevIt);
+        }
+    }
+
+    if (rangeStart == pRightBound) {
+        pRightBound = rangeEnd;
+    } else if (rangeEnd == pLeftBound) {
+        pLeftBound = rangeStart;
+    } else {
+        insertFreeRange(rangeStart, static_cast<size_t>(rangeEnd - rangeStart));
+    }
+}
+
+uint64_t HeapAllocator::getFromFreeRanges(size_t sizeToAllocate, size_t alignment, bool allocateFromTop) {
+    for (auto sizeClass = getSizeClass(sizeToAllocate); sizeClass < numSizeClasses; sizeClass++) {
+        auto &freeRangesBySize = freeRangesBySizeClass[sizeClass];
+        for (auto it = freeRangesBySize.lower_bound({sizeToAllocate, 0u}); it != freeRangesBySize.end(); ++it) {
+            const uint64_t chunkPtr = it->second;
+            const uint64_t chunkEnd = chunkPtr + it->first;
+
+            uint64_t ptr = 0u;
+            if (allocateFromTop) {
+                ptr = alignDown(chunkEnd - sizeToAllocate, alignment);
+                if (ptr < chunkPtr) {
+                    continue;
+                }
+            } else {
+                ptr = alignUp(chunkPtr, alignment);
+                if (ptr + sizeToAllocate > chunkEnd) {
+                    continue;
+                }
+            }
+
+            eraseFreeRange(freeRangesByAddress.find(chunkPtr));
+            if (ptr > chunkPtr) {
+                insertFreeRange(chunkPtr, static_cast<size_t>(ptr - chunkPtr));
+            }
+            if (ptr + sizeToAllocate < chunkEnd) {
+                insertFreeRange(ptr + sizeToAllocate, static_cast<size_t>(chunkEnd - ptr - sizeToAllocate));
+            }
+            return ptr;
+        }
+    }
+    return 0llu;
+}
+
+void HeapAllocator::insertFreeRange(uint64_t ptr, size_t size) {
+    freeRangesByAddress.emplace(ptr, size);
+    freeRangesBySizeClass[getSizeClass(size)].emplace(size, ptr);
+}
+
+void HeapAllocator::eraseFreeRange(std::map<uint64_t, size_t>::iterator rangeIt) {
+    freeRangesBySizeClass[getSizeClass(rangeIt->second)].erase({rangeIt->second, rangeIt->first});
+    freeRangesByAddress.erase(rangeIt);
+}
+
+size_t HeapAllocator::getSizeClass(size_t size) const {
+    return std::min(static_cast<size_t>(Math::log2(static_cast<uint64_t>(size))), numSizeClasses - 1);
+}
+
 } // namespace NEO
@@ -9,8 +9,11 @@
 
 #include "shared/source/helpers/constants.h"
 
+#include <array>
 #include <cstdint>
+#include <map>
 #include <mutex>
+#include <set>
 #include <vector>
 
 namespace NEO {
@@ -23,15 +26,25 @@ struct HeapChunk {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
+enum class HeapAllocatorMode : uint32_t {
+    linearFreeLists = 0,
+    segregatedFit = 1
+};
+
 class HeapAllocator {
   public:
+    static constexpr size_t defaultSizeThreshold = 4 * MemoryConstants::megaByte;
+
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, MemoryConstants::pageSize) {
     }
 
-    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : HeapAllocator(address, size, allocationAlignment, 4 * MemoryConstants::megaByte) {
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : HeapAllocator(address, size, allocationAlignment, defaultSizeThreshold) {
+    }
+
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : HeapAllocator(address, size, allocationAlignment, threshold, HeapAllocatorMode::linearFreeLists) {
     }
 
-    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold, HeapAllocatorMode mode) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold), mode(mode) {
         pLeftBound = address;
         pRightBound = address + size;
         freedChunksBig.reserve(10);
@@ -58,16 +71,29 @@ class HeapAllocator {
 
     double getUsage() const;
 
+    HeapAllocatorMode getMode() const {
+        return mode;
+    }
+
   protected:
+    static constexpr size_t numSizeClasses = 64;
+    using FreeRangesBySize = std::set<std::pair<size_t, uint64_t>>;
+
     const uint64_t size;
     uint64_t availableSize;
     uint64_t pLeftBound;
     uint64_t pRightBound;
     size_t allocationAlignment;
     const size_t sizeThreshold;
+    const HeapAllocatorMode mode;
 
     std::vector<HeapChunk> freedChunksSmall;
     std::vector<HeapChunk> freedChunksBig;
+
+    // segregatedFit mode: free ranges indexed by address for O(log n) coalescing
+    // and binned by power-of-two size class (ordered by size) for O(log n) best fit lookup
+    std::map<uint64_t, size_t> freeRangesByAddress;
+    std::array<FreeRangesBySize, numSizeClasses> freeRangesBySizeClass;
     std::mutex mtx;
 
     uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment);
@@ -122,5 +148,12 @@ class HeapAllocator {
     }
 
     void defragment();
+
+    uint64_t allocateSegregatedFit(size_t sizeToAllocate, size_t alignment);
+    void freeSegregatedFit(uint64_t ptr, size_t size);
+    uint64_t getFromFreeRanges(size_t sizeToAllocate, size_t alignment, bool allocateFromTop);
+    void insertFreeRange(uint64_t ptr, size_t size);
+    void eraseFreeRange(std::map<uint64_t, size_t>::iterator rangeIt);
+    size_t getSizeClass(size_t size) const;
 };
 } // namespace NEO
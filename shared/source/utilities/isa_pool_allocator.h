@@ -71,13 +71,13 @@ class ISAPoolAllocator : public AbstractBuffersAllocator<ISAPool, GraphicsAlloca
     SharedIsaAllocation *requestGraphicsAllocationForIsa(bool isBuiltin, size_t size);
     void freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAllocation);
 
-  private:
-    SharedIsaAllocation *tryAllocateISA(bool isBuiltin, size_t size);
-
     size_t getAllocationSize(bool isBuiltin) const {
         return isBuiltin ? buitinAllocationSize : userAllocationSize;
     }
 
+  private:
+    SharedIsaAllocation *tryAllocateISA(bool isBuiltin, size_t size);
+
     Device *device;
     size_t userAllocationSize = MemoryConstants::pageSize2M * 2;
     size_t buitinAllocationSize = MemoryConstants::pageSize64k;
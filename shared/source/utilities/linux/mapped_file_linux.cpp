@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/utilities/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace NEO {
+
+class MappedFileLinux : public MappedFile {
+  public:
+    ~MappedFileLinux() override {
+        if (false == data.empty()) {
+            SysCalls::munmap(const_cast<uint8_t *>(data.begin()), data.size());
+        }
+    }
+
+    bool map(const char *filePath) {
+        auto fd = SysCalls::open(filePath, O_RDONLY);
+        if (fd < 0) {
+            PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "Could not open file %s\n", filePath);
+            return false;
+        }
+
+        bool mapped = false;
+        struct stat statBuffer = {};
+        if ((SysCalls::fstat(fd, &statBuffer) == 0) && (statBuffer.st_size > 0)) {
+            auto size = static_cast<size_t>(statBuffer.st_size);
+            auto ptr = SysCalls::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if ((ptr != MAP_FAILED) && (ptr != nullptr)) {
+                data = ArrayRef<const uint8_t>(static_cast<const uint8_t *>(ptr), size);
+                mapped = true;
+            }
+        }
+        SysCalls::close(fd);
+
+        if (false == mapped) {
+            PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "Could not map file %s\n", filePath);
+        }
+        return mapped;
+    }
+};
+
+std::unique_ptr<MappedFile> MappedFile::create(const char *filePath) {
+    if (nullptr == filePath) {
+        return nullptr;
+    }
+
+    auto mappedFile = std::make_unique<MappedFileLinux>();
+    if (false == mappedFile->map(filePath)) {
+        return nullptr;
+    }
+    return mappedFile;
+}
+
+} // namespace NEO
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+// Read-optimized index of [address, address + size) ranges.
+// Readers never take a lock - they search an immutable sorted snapshot that writers replace as a whole (copy-on-write).
+// Replaced snapshots are retired and reclaimed once no reader can still observe them (epoch based grace period).
+// Reader presence is tracked in per-thread sharded counters, so concurrent lookups do not share a cache line.
+// Readers are counted under the parity of the epoch they entered in, so a grace period only waits for readers
+// of the previous epoch to leave and is not blocked by lookups which keep entering in the current epoch.
+template <typename ValueType>
+class LockFreePointerIndex {
+  public:
+    struct Entry {
+        uintptr_t address;
+        size_t size;
+        ValueType *value;
+    };
+    using Snapshot = std::vector<Entry>;
+
+    static constexpr uint32_t numReaderShards = 64u;
+
+    LockFreePointerIndex() = default;
+    LockFreePointerIndex(const LockFreePointerIndex &) = delete;
+    LockFreePointerIndex &operator=(const LockFreePointerIndex &) = delete;
+
+    ~LockFreePointerIndex() {
+        delete currentSnapshot.load(std::memory_order_relaxed);
+    }
+
+    void insert(const void *ptr, size_t size, ValueType *value) {
+        std::lock_guard<std::mutex> lock(writerMtx);
+        auto newSnapshot = copyCurrentSnapshot(1u);
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+        auto position = std::upper_bound(newSnapshot->begin(), newSnapshot->end(), address, compareAddressWithEntry);
+        newSnapshot->insert(position, Entry{address, size, value});
+        publish(std::move(newSnapshot));
+    }
+
+    bool remove(const void *ptr) {
+        std::lock_guard<std::mutex> lock(writerMtx);
+        auto snapshot = currentSnapshot.load(std::memory_order_relaxed);
+        if (snapshot == nullptr || findExact(*snapshot, reinterpret_cast<uintptr_t>(ptr)) == snapshot->end()) {
+            return false;
+        }
+        auto newSnapshot = copyCurrentSnapshot(0u);
+        newSnapshot->erase(findExact(*newSnapshot, reinterpret_cast<uintptr_t>(ptr)));
+        publish(std::move(newSnapshot));
+        return true;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(writerMtx);
+        publish(nullptr);
+    }
+
+    ValueType *get(const void *ptr) const {
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+
+        auto &readerShard = readerShards[getReaderShardIndex()];
+        std::atomic<uint32_t> *activeReaders = nullptr;
+        while (true) {
+            const auto epoch = readerEpoch.load(std::memory_order_seq_cst);
+            activeReaders = &readerShard.activeReaders[epoch % 2];
+            activeReaders->fetch_add(1u, std::memory_order_seq_cst);
+            if (readerEpoch.load(std::memory_order_seq_cst) == epoch) {
+                break;
+            }
+            activeReaders->fetch_sub(1u, std::memory_order_release);
+        }
+
+        ValueType *retVal = nullptr;
+        auto snapshot = currentSnapshot.load(std::memory_order_seq_cst);
+        if (snapshot != nullptr) {
+            const auto address = reinterpret_cast<uintptr_t>(ptr);
+            auto it = std::upper_bound(snapshot->begin(), snapshot->end(), address, compareAddressWithEntry);
+            if (it != snapshot->begin()) {
+                --it;
+                if (address == it->address || address - it->address < it->size) {
+                    retVal = it->value;
+                }
+            }
+        }
+
+        activeReaders->fetch_sub(1u, std::memory_order_release);
+        return retVal;
+    }
+
+    size_t getNumEntries() const {
+        std::lock_guard<std::mutex> lock(writerMtx);
+        auto snapshot = currentSnapshot.load(std::memory_order_relaxed);
+        return snapshot ? snapshot->size() : 0u;
+    }
+
+    size_t getNumRetiredSnapshots() const {
+        std::lock_guard<std::mutex> lock(writerMtx);
+        return retiredSnapshots.size();
+    }
+
+  protected:
+    struct alignas(MemoryConstants::cacheLineSize) ReaderShard {
+        std::atomic<uint32_t> activeReaders[2] = {};
+    };
+
+    struct RetiredSnapshot {
+        std::unique_ptr<Snapshot> snapshot;
+        uint64_t retireEpoch;
+    };
+
+    static bool compareAddressWithEntry(uintptr_t address, const Entry &entry) {
+        return address < entry.address;
+    }
+
+    static bool compareEntryWithAddress(const Entry &entry, uintptr_t address) {
+        return entry.address < address;
+    }
+
+    static uint32_t getReaderShardIndex() {
+        static std::atomic<uint32_t> nextReaderShard{0u};
+        thread_local const uint32_t readerShardIndex = nextReaderShard.fetch_add(1u, std::memory_order_relaxed) % numReaderShards;
+        return readerShardIndex;
+    }
+
+    static typename Snapshot::const_iterator findExact(const Snapshot &snapshot, uintptr_t address) {
+        auto it = std::lower_bound(snapshot.begin(), snapshot.end(), address, compareEntryWithAddress);
+        if (it != snapshot.end() && it->address == address) {
+            return it;
+        }
+        return snapshot.end();
+    }
+
+    std::unique_ptr<Snapshot> copyCurrentSnapshot(size_t additionalEntries) const {
+        auto newSnapshot = std::make_unique<Snapshot>();
+        auto snapshot = currentSnapshot.load(std::memory_order_relaxed);
+        if (snapshot != nullptr) {
+            newSnapshot->reserve(snapshot->size() + additionalEntries);
+            newSnapshot->assign(snapshot->begin(), snapshot->end());
+        }
+        return newSnapshot;
+    }
+
+    void publish(std::unique_ptr<Snapshot> newSnapshot) {
+        auto oldSnapshot = currentSnapshot.exchange(newSnapshot.release(), std::memory_order_seq_cst);
+        if (oldSnapshot != nullptr) {
+            retiredSnapshots.push_back({std::unique_ptr<Snapshot>(oldSnapshot), readerEpoch.load(std::memory_order_relaxed)});
+        }
+        reclaimRetiredSnapshots();
+    }
+
+    // The epoch advances only when no reader of the previous epoch is left, so active readers always belong
+    // to the current or the previous epoch. Readers which entered after the epoch moved past the retire epoch
+    // can only observe newer snapshots, hence a snapshot is released two epochs after it was retired.
+    bool tryAdvanceReaderEpoch() {
+        const auto epoch = readerEpoch.load(std::memory_order_relaxed);
+        for (auto &readerShard : readerShards) {
+            if (readerShard.activeReaders[(epoch + 1) % 2].load(std::memory_order_seq_cst) != 0u) {
+                return false;
+            }
+        }
+        readerEpoch.store(epoch + 1, std::memory_order_seq_cst);
+        return true;
+    }
+
+    void reclaimRetiredSnapshots() {
+        if (retiredSnapshots.empty()) {
+            return;
+        }
+        if (tryAdvanceReaderEpoch()) {
+            tryAdvanceReaderEpoch();
+        }
+        const auto epoch = readerEpoch.load(std::memory_order_relaxed);
+        retiredSnapshots.erase(std::remove_if(retiredSnapshots.begin(), retiredSnapshots.end(),
+                                              [epoch](const RetiredSnapshot &retired) { return retired.retireEpoch + 2 <= epoch; }),
+                               retiredSnapshots.end());
+    }
+
+    mutable std::array<ReaderShard, numReaderShards> readerShards;
+    std::atomic<uint64_t> readerEpoch{0u};
+    std::atomic<Snapshot *> currentSnapshot{nullptr};
+    std::vector<RetiredSnapshot> retiredSnapshots;
+    mutable std::mutex writerMtx;
+};
+
+} // namespace NEO
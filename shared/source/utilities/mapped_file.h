@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace NEO {
+
+// Read-only contents of a whole file.
+// On Linux the file is memory mapped, so views into getData() stay valid for the lifetime
+// of the object without the file ever being copied into heap memory.
+class MappedFile : NonCopyableOrMovableClass {
+  public:
+    static std::unique_ptr<MappedFile> create(const char *filePath);
+
+    virtual ~MappedFile() = default;
+
+    ArrayRef<const uint8_t> getData() const {
+        return data;
+    }
+
+  protected:
+    MappedFile() = default;
+
+    ArrayRef<const uint8_t> data;
+};
+
+} // namespace NEO
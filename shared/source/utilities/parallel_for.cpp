@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+namespace NEO {
+
+namespace ParallelFor {
+
+size_t getWorkersCount(size_t itemsCount) {
+    if (debugManager.flags.ModuleLoadWorkerThreads.get() != -1) {
+        auto workersCount = static_cast<size_t>(std::max(debugManager.flags.ModuleLoadWorkerThreads.get(), 1));
+        return std::max(std::min(workersCount, itemsCount), size_t{1u});
+    }
+
+    auto hardwareThreads = static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u));
+    auto workersForItems = std::max(itemsCount / minItemsPerWorker, size_t{1u});
+    return std::min({hardwareThreads, maxWorkersCount, workersForItems});
+}
+
+} // namespace ParallelFor
+
+} // namespace NEO
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+namespace ParallelFor {
+inline constexpr size_t maxWorkersCount = 8u;
+inline constexpr size_t minItemsPerWorker = 64u;
+
+size_t getWorkersCount(size_t itemsCount);
+} // namespace ParallelFor
+
+// Calls func(itemId) for every itemId in [0, itemsCount) using a bounded number of short-lived workers,
+// the calling thread included. Items are split into contiguous ranges, so func must only modify
+// state owned by the given item. Small item counts are processed serially on the calling thread.
+template <typename FuncT>
+void parallelFor(size_t itemsCount, FuncT &&func) {
+    auto workersCount = ParallelFor::getWorkersCount(itemsCount);
+    if (workersCount <= 1u) {
+        for (size_t itemId = 0u; itemId < itemsCount; itemId++) {
+            func(itemId);
+        }
+        return;
+    }
+
+    auto itemsPerWorker = (itemsCount + workersCount - 1u) / workersCount;
+    auto processRange = [&](size_t workerId) {
+        auto rangeBegin = workerId * itemsPerWorker;
+        auto rangeEnd = std::min(rangeBegin + itemsPerWorker, itemsCount);
+        for (size_t itemId = rangeBegin; itemId < rangeEnd; itemId++) {
+            func(itemId);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount - 1u);
+    for (size_t workerId = 1u; workerId < workersCount; workerId++) {
+        workers.emplace_back(processRange, workerId);
+    }
+    processRange(0u);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace NEO
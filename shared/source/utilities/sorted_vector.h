@@ -34,21 +34,17 @@ class BaseSortedPointerWithValueVector {
     }
 
     void insert(const void *ptr, const ValueType &value) {
-        allocations.push_back(std::make_pair(ptr, std::make_unique<ValueType>(value)));
-        for (size_t i = allocations.size() - 1; i > 0; --i) {
-            if (allocations[i].first < allocations[i - 1].first) {
-                std::iter_swap(allocations.begin() + i, allocations.begin() + i - 1);
-            } else {
-                break;
-            }
-        }
+        auto position = std::upper_bound(allocations.begin(), allocations.end(), ptr, [](const void *insertedPtr, const PointerPair &other) {
+            return insertedPtr < other.first;
+        });
+        allocations.insert(position, std::make_pair(ptr, std::make_unique<ValueType>(value)));
     }
 
     void remove(const void *ptr) {
-        auto removeIt = std::remove_if(allocations.begin(), allocations.end(), [&ptr](const PointerPair &other) {
-            return ptr == other.first;
-        });
-        allocations.erase(removeIt);
+        auto removeIt = getImpl(ptr, false);
+        if (removeIt != allocations.end()) {
+            allocations.erase(removeIt);
+        }
     }
 
     typename Container::iterator getImpl(const void *ptr, bool allowOffset) {
@@ -13,6 +13,8 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <tuple>
+
 namespace NEO {
 
 StagingBuffer::StagingBuffer(void *baseAddress, size_t size) : baseAddress(baseAddress) {
@@ -27,6 +29,9 @@ StagingBufferManager::StagingBufferManager(SVMAllocsManager *svmAllocsManager, c
     if (debugManager.flags.StagingBufferSize.get() != -1) {
         chunkSize = debugManager.flags.StagingBufferSize.get() * MemoryConstants::kiloByte;
     }
+    if (debugManager.flags.StagingBufferPipelineDepth.get() > 0) {
+        pipelineDepth = static_cast<size_t>(debugManager.flags.StagingBufferPipelineDepth.get());
+    }
 }
 
 StagingBufferManager::~StagingBufferManager() {
@@ -44,12 +49,9 @@ StagingBufferManager::~StagingBufferManager() {
  */
 int32_t StagingBufferManager::performChunkCopy(void *chunkDst, const void *chunkSrc, size_t size, ChunkCopyFunction &chunkCopyFunc, CommandStreamReceiver *csr) {
     auto allocatedSize = size;
-    auto [allocator, chunkBuffer] = requestStagingBuffer(allocatedSize, csr);
+    auto [allocator, chunkBuffer] = requestStagingBuffer(allocatedSize, false);
     auto ret = chunkCopyFunc(chunkDst, addrToPtr(chunkBuffer), chunkSrc, size);
-    {
-        auto lock = std::lock_guard<std::mutex>(mtx);
-        trackers.push_back({allocator, chunkBuffer, allocatedSize, csr->peekTaskCount()});
-    }
+    trackChunk({allocator, chunkBuffer, allocatedSize, csr->peekTaskCount(), csr});
     if (csr->isAnyDirectSubmissionEnabled()) {
         csr->flushTagUpdate();
     }
@@ -85,25 +87,140 @@ int32_t StagingBufferManager::performCopy(void *dstPtr, const void *srcPtr, size
     return 0;
 }
 
+/*
+ * This method copies data from USM allocation to non-USM memory by splitting transfer into chunks.
+ * Caller provides function transferring single chunk from USM allocation into staging buffer.
+ * Staging buffer of given chunk is copied to destination on CPU once GPU finished the transfer,
+ * while the transfer of next chunk is already submitted, so CPU and GPU copies overlap.
+ */
+StagingTransferStatus StagingBufferManager::performReadCopy(void *dstPtr, const void *srcPtr, size_t size, ChunkCopyFunction &chunkCopyFunc, CommandStreamReceiver *csr) {
+    StagingTransferStatus result{};
+    StagingReadChunk pendingChunk{};
+    bool hasPendingChunk = false;
+
+    for (size_t offset = 0; offset < size; offset += chunkSize) {
+        auto copySize = std::min(chunkSize, size - offset);
+        auto allocatedSize = copySize;
+        auto [allocator, chunkBuffer] = requestStagingBuffer(allocatedSize, hasPendingChunk);
+        if (chunkBuffer == 0) {
+            // pending chunk holds the last staging buffer allowed by pipeline depth, finish it first
+            hasPendingChunk = false;
+            result.waitStatus = finishReadChunk(pendingChunk, csr);
+            if (result.waitStatus == WaitStatus::gpuHang) {
+                return result;
+            }
+            allocatedSize = copySize;
+            std::tie(allocator, chunkBuffer) = requestStagingBuffer(allocatedSize, false);
+        }
+        auto chunkDst = ptrOffset(dstPtr, offset);
+
+        result.chunkCopyStatus = chunkCopyFunc(chunkDst, addrToPtr(chunkBuffer), ptrOffset(srcPtr, offset), copySize);
+        StagingReadChunk readChunk{allocator, chunkBuffer, allocatedSize, chunkDst, copySize, csr->peekTaskCount()};
+        if (csr->isAnyDirectSubmissionEnabled()) {
+            csr->flushTagUpdate();
+        }
+
+        if (result.chunkCopyStatus != 0) {
+            if (hasPendingChunk) {
+                trackChunk({pendingChunk.allocator, pendingChunk.chunkAddress, pendingChunk.allocatedSize, pendingChunk.taskCountToWait, csr});
+            }
+            trackChunk({readChunk.allocator, readChunk.chunkAddress, readChunk.allocatedSize, readChunk.taskCountToWait, csr});
+            return result;
+        }
+
+        if (hasPendingChunk) {
+            result.waitStatus = finishReadChunk(pendingChunk, csr);
+            if (result.waitStatus == WaitStatus::gpuHang) {
+                trackChunk({readChunk.allocator, readChunk.chunkAddress, readChunk.allocatedSize, readChunk.taskCountToWait, csr});
+                return result;
+            }
+        }
+        pendingChunk = readChunk;
+        hasPendingChunk = true;
+    }
+
+    if (hasPendingChunk) {
+        result.waitStatus = finishReadChunk(pendingChunk, csr);
+    }
+    return result;
+}
+
+/*
+ * This method waits for GPU transfer of read chunk, copies it to destination and releases its staging buffer.
+ * If GPU hang is detected, chunk is tracked and released once its task count is ready.
+ */
+WaitStatus StagingBufferManager::finishReadChunk(const StagingReadChunk &readChunk, CommandStreamReceiver *csr) {
+    auto waitStatus = waitForChunk(readChunk.taskCountToWait, csr);
+    if (waitStatus == WaitStatus::gpuHang) {
+        trackChunk({readChunk.allocator, readChunk.chunkAddress, readChunk.allocatedSize, readChunk.taskCountToWait, csr});
+        return waitStatus;
+    }
+
+    memcpy(readChunk.chunkDst, addrToPtr(readChunk.chunkAddress), readChunk.size);
+
+    auto lock = std::lock_guard<std::mutex>(mtx);
+    readChunk.allocator->free(readChunk.chunkAddress, readChunk.allocatedSize);
+    return waitStatus;
+}
+
+WaitStatus StagingBufferManager::waitForChunk(TaskCountType taskCountToWait, CommandStreamReceiver *csr) {
+    csr->flushBatchedSubmissions();
+    return csr->waitForTaskCount(taskCountToWait);
+}
+
+void StagingBufferManager::trackChunk(const StagingBufferTracker &tracker) {
+    auto lock = std::lock_guard<std::mutex>(mtx);
+    trackers.push_back(tracker);
+}
+
 /*
  * This method returns allocator and chunk from staging buffer.
  * Creates new staging buffer if it failed to allocate chunk from existing buffers.
+ * If number of staging buffers is limited, waits for oldest tracked chunks instead of creating new buffer.
+ * Wait is done on command stream receiver which submitted the chunk, without holding the manager lock.
+ * Read chunk pending on caller side counts into the limit too, then no chunk is returned
+ * and caller has to finish its pending chunk before requesting again.
  */
-std::pair<HeapAllocator *, uint64_t> StagingBufferManager::requestStagingBuffer(size_t &size, CommandStreamReceiver *csr) {
-    auto lock = std::lock_guard<std::mutex>(mtx);
+std::pair<HeapAllocator *, uint64_t> StagingBufferManager::requestStagingBuffer(size_t &size, bool hasPendingReadChunk) {
+    auto lock = std::unique_lock<std::mutex>(mtx);
 
     auto [allocator, chunkBuffer] = getExistingBuffer(size);
     if (chunkBuffer != 0) {
         return {allocator, chunkBuffer};
     }
 
-    clearTrackedChunks(csr);
+    clearTrackedChunks();
 
     auto [retriedAllocator, retriedChunkBuffer] = getExistingBuffer(size);
     if (retriedChunkBuffer != 0) {
         return {retriedAllocator, retriedChunkBuffer};
     }
 
+    if (pipelineDepth != 0u && stagingBuffers.size() >= pipelineDepth) {
+        while (!trackers.empty()) {
+            auto oldestTracker = trackers.front();
+            lock.unlock();
+            auto waitStatus = waitForChunk(static_cast<TaskCountType>(oldestTracker.taskCountToWait), oldestTracker.csr);
+            lock.lock();
+            if (waitStatus != WaitStatus::ready) {
+                break;
+            }
+
+            auto trackersCount = trackers.size();
+            clearTrackedChunks();
+            auto [waitedAllocator, waitedChunkBuffer] = getExistingBuffer(size);
+            if (waitedChunkBuffer != 0) {
+                return {waitedAllocator, waitedChunkBuffer};
+            }
+            if (trackers.size() == trackersCount) {
+                break;
+            }
+        }
+        if (hasPendingReadChunk) {
+            return {nullptr, 0u};
+        }
+    }
+
     StagingBuffer stagingBuffer{allocateStagingBuffer(), chunkSize};
     allocator = stagingBuffer.getAllocator();
     chunkBuffer = allocator->allocate(size);
@@ -150,13 +267,25 @@ bool StagingBufferManager::isValidForCopy(Device &device, void *dstPtr, const vo
     return stagingCopyEnabled && hostToUsmCopy && !hasDependencies && (isUsedByOsContext || size <= chunkSize);
 }
 
-void StagingBufferManager::clearTrackedChunks(CommandStreamReceiver *csr) {
+bool StagingBufferManager::isValidForStagingRead(void *dstPtr, const void *srcPtr, bool hasDependencies) const {
+    auto stagingReadEnabled = false;
+    if (debugManager.flags.EnableReadWithStagingBuffers.get() != -1) {
+        stagingReadEnabled = !!debugManager.flags.EnableReadWithStagingBuffers.get();
+    }
+    auto usmDstData = svmAllocsManager->getSVMAlloc(dstPtr);
+    auto usmSrcData = svmAllocsManager->getSVMAlloc(srcPtr);
+    bool deviceUsmToHostCopy = usmSrcData != nullptr && usmSrcData->memoryType == InternalMemoryType::deviceUnifiedMemory && usmDstData == nullptr;
+    return stagingReadEnabled && deviceUsmToHostCopy && !hasDependencies;
+}
+
+void StagingBufferManager::clearTrackedChunks() {
     for (auto iterator = trackers.begin(); iterator != trackers.end();) {
+        auto csr = iterator->csr;
         if (csr->testTaskCountReady(csr->getTagAddress(), iterator->taskCountToWait)) {
             iterator->allocator->free(iterator->chunkAddress, iterator->size);
             iterator = trackers.erase(iterator);
         } else {
-            break;
+            iterator++;
         }
     }
 }
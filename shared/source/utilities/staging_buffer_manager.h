@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/command_stream/wait_status.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/stackvec.h"
 
@@ -45,29 +47,50 @@ struct StagingBufferTracker {
     uint64_t chunkAddress;
     size_t size;
     uint64_t taskCountToWait;
+    CommandStreamReceiver *csr;
+};
+
+struct StagingReadChunk {
+    HeapAllocator *allocator;
+    uint64_t chunkAddress;
+    size_t allocatedSize;
+    void *chunkDst;
+    size_t size;
+    TaskCountType taskCountToWait;
+};
+
+struct StagingTransferStatus {
+    int32_t chunkCopyStatus = 0; // status from L0/OCL chunk copy
+    WaitStatus waitStatus = WaitStatus::ready;
 };
 
 class StagingBufferManager {
   public:
     StagingBufferManager(SVMAllocsManager *svmAllocsManager, const RootDeviceIndicesContainer &rootDeviceIndices, const std::map<uint32_t, DeviceBitfield> &deviceBitfields);
-    ~StagingBufferManager();
+    MOCKABLE_VIRTUAL ~StagingBufferManager();
     StagingBufferManager(StagingBufferManager &&other) noexcept = delete;
     StagingBufferManager(const StagingBufferManager &other) = delete;
     StagingBufferManager &operator=(StagingBufferManager &&other) noexcept = delete;
     StagingBufferManager &operator=(const StagingBufferManager &other) = delete;
 
     bool isValidForCopy(Device &device, void *dstPtr, const void *srcPtr, size_t size, bool hasDependencies, uint32_t osContextId) const;
+    bool isValidForStagingRead(void *dstPtr, const void *srcPtr, bool hasDependencies) const;
     int32_t performCopy(void *dstPtr, const void *srcPtr, size_t size, ChunkCopyFunction &chunkCopyFunc, CommandStreamReceiver *csr);
+    StagingTransferStatus performReadCopy(void *dstPtr, const void *srcPtr, size_t size, ChunkCopyFunction &chunkCopyFunc, CommandStreamReceiver *csr);
 
-  private:
-    std::pair<HeapAllocator *, uint64_t> requestStagingBuffer(size_t &size, CommandStreamReceiver *csr);
+  protected:
+    std::pair<HeapAllocator *, uint64_t> requestStagingBuffer(size_t &size, bool hasPendingReadChunk);
     std::pair<HeapAllocator *, uint64_t> getExistingBuffer(size_t &size);
     void *allocateStagingBuffer();
-    void clearTrackedChunks(CommandStreamReceiver *csr);
+    void clearTrackedChunks();
+    void trackChunk(const StagingBufferTracker &tracker);
+    MOCKABLE_VIRTUAL WaitStatus waitForChunk(TaskCountType taskCountToWait, CommandStreamReceiver *csr);
 
     int32_t performChunkCopy(void *chunkDst, const void *chunkSrc, size_t size, ChunkCopyFunction &chunkCopyFunc, CommandStreamReceiver *csr);
+    WaitStatus finishReadChunk(const StagingReadChunk &readChunk, CommandStreamReceiver *csr);
 
     size_t chunkSize = MemoryConstants::pageSize2M;
+    size_t pipelineDepth = 0u;
     std::mutex mtx;
     std::vector<StagingBuffer> stagingBuffers;
     std::vector<StagingBufferTracker> trackers;
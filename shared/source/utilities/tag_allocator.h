@@ -144,6 +144,11 @@ class TagAllocatorBase {
 
     virtual TagNodeBase *getTag() = 0;
 
+    // Grows the pool up front, so that up to tagsCount tags can be taken without allocating on the hot path
+    virtual void preallocateTags(size_t tagsCount) = 0;
+
+    size_t getTotalTagCount() const { return totalTagCount; }
+
   protected:
     TagAllocatorBase() = delete;
 
@@ -166,6 +171,7 @@ class TagAllocatorBase {
     MemoryManager *memoryManager;
     size_t tagCount;
     size_t tagSize;
+    size_t totalTagCount = 0;
     bool doNotReleaseNodes = false;
 
     std::mutex allocatorMutex;
@@ -183,6 +189,8 @@ class TagAllocator : public TagAllocatorBase {
 
     void returnTag(TagNodeBase *node) override;
 
+    void preallocateTags(size_t tagsCount) override;
+
   protected:
     TagAllocator() = delete;
 
@@ -194,13 +202,21 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
+    void pushToReturnedTags(NodeType *node);
+
+    void releaseReturnedTags();
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
 
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
 
+    // With node cache enabled, used tags are not tracked and released ones are linked here without locking
+    std::atomic<NodeType *> returnedTags{nullptr};
+
     bool initializeTags = true;
+    bool nodeCacheEnabled = false;
 };
 } // namespace NEO
 
@@ -16,11 +16,18 @@ TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDevice
                                     size_t tagSize, bool doNotReleaseNodes, bool initializeTags, DeviceBitfield deviceBitfield)
     : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield), initializeTags(initializeTags) {
 
+    if (debugManager.flags.EnableTagAllocatorNodeCache.get() != -1) {
+        nodeCacheEnabled = !!debugManager.flags.EnableTagAllocatorNodeCache.get();
+    }
+
     populateFreeTags();
 }
 
 template <typename TagType>
 TagNodeBase *TagAllocator<TagType>::getTag() {
+    if (freeTags.peekIsEmpty()) {
+        releaseReturnedTags();
+    }
     if (freeTags.peekIsEmpty()) {
         releaseDeferredTags();
     }
@@ -30,7 +37,9 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
         populateFreeTags();
         node = freeTags.removeFrontOne().release();
     }
-    usedTags.pushFrontOne(*node);
+    if (!nodeCacheEnabled) {
+        usedTags.pushFrontOne(*node);
+    }
     node->incRefCount();
 
     if (initializeTags) {
@@ -47,24 +56,66 @@ TagNodeBase *TagAllocator<TagType>::getTag() {
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
-    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
-    DEBUG_BREAK_IF(usedNode == nullptr);
 
     if (debugManager.flags.PrintTimestampPacketUsage.get() == 1) {
         printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), nodeT->getGpuAddress());
     }
 
+    if (nodeCacheEnabled) {
+        pushToReturnedTags(nodeT);
+        return;
+    }
+
+    [[maybe_unused]] auto usedNode = usedTags.removeOne(*nodeT).release();
+    DEBUG_BREAK_IF(usedNode == nullptr);
+
     freeTags.pushFrontOne(*nodeT);
 }
 
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
+    if (nodeCacheEnabled) {
+        deferredTags.pushFrontOne(*nodeT);
+        return;
+    }
     auto usedNode = usedTags.removeOne(*nodeT).release();
     DEBUG_BREAK_IF(!usedNode);
     deferredTags.pushFrontOne(*usedNode);
 }
 
+template <typename TagType>
+void TagAllocator<TagType>::pushToReturnedTags(NodeType *node) {
+    auto head = returnedTags.load(std::memory_order_relaxed);
+    do {
+        node->next = head;
+    } while (!returnedTags.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::releaseReturnedTags() {
+    auto currentNode = returnedTags.exchange(nullptr, std::memory_order_acquire);
+    if (currentNode == nullptr) {
+        return;
+    }
+
+    IDList<NodeType, false> pendingFreeTags;
+    while (currentNode != nullptr) {
+        auto nextNode = currentNode->next;
+        pendingFreeTags.pushFrontOne(*currentNode);
+        currentNode = nextNode;
+    }
+    freeTags.splice(*pendingFreeTags.detachNodes());
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::preallocateTags(size_t tagsCount) {
+    std::unique_lock<std::mutex> lock(allocatorMutex);
+    while (totalTagCount < tagsCount) {
+        populateFreeTags();
+    }
+}
+
 template <typename TagType>
 void TagAllocator<TagType>::releaseDeferredTags() {
     IDList<NodeType, false> pendingFreeTags;
@@ -133,6 +184,7 @@ void TagAllocator<TagType>::populateFreeTags() {
     }
 
     tagPoolMemory.push_back(std::move(nodesMemory));
+    totalTagCount += tagCount;
 }
 
 template <typename TagType>
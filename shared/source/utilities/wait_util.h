@@ -9,6 +9,8 @@
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <thread>
@@ -18,6 +20,7 @@ namespace NEO {
 namespace WaitUtils {
 
 constexpr uint32_t defaultWaitCount = 1u;
+constexpr uint32_t adaptiveSpinPauseCount = 8u;
 
 extern uint64_t waitpkgCounterValue;
 extern uint32_t waitpkgControlValue;
@@ -59,6 +62,83 @@ inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType exp
     return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>());
 }
 
+enum class WaitPhase : uint32_t {
+    spin,
+    monitorWait,
+    yield
+};
+
+// Selects wait phase from time already spent in the current wait: spin, then umwait (when enabled), then yield.
+// Phase thresholds follow a moving average of completion times observed by the owner of the policy.
+// Each command stream receiver owns one policy, so command queues sharing an engine also share the learned thresholds.
+// The policy is enabled for all command stream receivers at once with EnableAdaptiveWaitPolicy, there is no per queue selection.
+class AdaptiveWaitPolicy {
+  public:
+    static constexpr int64_t minSpinTimeNs = 1'000;
+    static constexpr int64_t maxSpinTimeNs = 100'000;
+    static constexpr int64_t maxMonitorWaitTimeNs = 1'000'000;
+    static constexpr int64_t spinThresholdMultiplier = 2;
+    static constexpr int64_t monitorWaitThresholdMultiplier = 8;
+    static constexpr int64_t maxMonitorWaitCounterScale = 16;
+    static constexpr int64_t averageWeight = 8;
+
+    WaitPhase getPhase(int64_t waitTimeNs) const {
+        if (waitTimeNs < getSpinThreshold()) {
+            return WaitPhase::spin;
+        }
+        if (waitpkgUse && waitTimeNs < getMonitorWaitThreshold()) {
+            return WaitPhase::monitorWait;
+        }
+        return WaitPhase::yield;
+    }
+
+    int64_t getSpinThreshold() const {
+        return std::clamp(getAverageCompletionTime() * spinThresholdMultiplier, minSpinTimeNs, maxSpinTimeNs);
+    }
+
+    int64_t getMonitorWaitThreshold() const {
+        return std::clamp(getAverageCompletionTime() * monitorWaitThresholdMultiplier, getSpinThreshold(), maxMonitorWaitTimeNs);
+    }
+
+    // umwait slices get longer the further the wait goes past the spin phase
+    uint64_t getMonitorWaitCounterModifier(int64_t waitTimeNs) const {
+        auto scale = std::min(waitTimeNs / getSpinThreshold(), maxMonitorWaitCounterScale);
+        return waitpkgCounterValue * static_cast<uint64_t>(scale);
+    }
+
+    void recordCompletion(int64_t waitTimeNs) {
+        waitTimeNs = std::max(waitTimeNs, static_cast<int64_t>(1));
+        auto average = getAverageCompletionTime();
+        auto newAverage = (average == 0) ? waitTimeNs : average + (waitTimeNs - average) / averageWeight;
+        averageCompletionTimeNs.store(newAverage, std::memory_order_relaxed);
+    }
+
+    int64_t getAverageCompletionTime() const {
+        return averageCompletionTimeNs.load(std::memory_order_relaxed);
+    }
+
+  protected:
+    std::atomic<int64_t> averageCompletionTimeNs{0};
+};
+
+inline bool waitFunctionWithPolicy(volatile TagAddressType *pollAddress, TaskCountType expectedValue, const AdaptiveWaitPolicy &waitPolicy, int64_t waitTimeNs) {
+    switch (waitPolicy.getPhase(waitTimeNs)) {
+    case WaitPhase::spin:
+        for (uint32_t i = 0; i < adaptiveSpinPauseCount; i++) {
+            CpuIntrinsics::pause();
+        }
+        return *pollAddress >= expectedValue;
+    case WaitPhase::monitorWait:
+        if (*pollAddress >= expectedValue) {
+            return true;
+        }
+        monitorWait(pollAddress, waitPolicy.getMonitorWaitCounterModifier(waitTimeNs));
+        return *pollAddress >= expectedValue;
+    default:
+        return waitFunction(pollAddress, expectedValue);
+    }
+}
+
 void init();
 } // namespace WaitUtils
 
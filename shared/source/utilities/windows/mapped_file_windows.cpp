@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/utilities/mapped_file.h"
+
+namespace NEO {
+
+class MappedFileWindows : public MappedFile {
+  public:
+    bool load(const char *filePath) {
+        size_t size = 0u;
+        contents = loadDataFromFile(filePath, size);
+        if ((nullptr == contents) || (0u == size)) {
+            return false;
+        }
+        data = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(contents.get()), size);
+        return true;
+    }
+
+  protected:
+    std::unique_ptr<char[]> contents;
+};
+
+std::unique_ptr<MappedFile> MappedFile::create(const char *filePath) {
+    if (nullptr == filePath) {
+        return nullptr;
+    }
+
+    auto mappedFile = std::make_unique<MappedFileWindows>();
+    if (false == mappedFile->load(filePath)) {
+        return nullptr;
+    }
+    return mappedFile;
+}
+
+} // namespace NEO
@@ -24,6 +24,7 @@ void CpuInfo::detect() const {
     constexpr size_t edx = 3;
 
     uint32_t cpuInfo[4] = {};
+    uint64_t enabledXsaveStates = 0u;
 
     cpuid(cpuInfo, 0u);
     auto numFunctionIds = cpuInfo[eax];
@@ -31,6 +32,11 @@ void CpuInfo::detect() const {
         cpuid(cpuInfo, processorInfo);
         {
             features |= cpuInfo[edx] & BIT(19) ? featureClflush : featureNone;
+
+            // OSXSAVE, OS enabled XGETBV to report which register states it saves on context switch
+            if (cpuInfo[ecx] & BIT(27)) {
+                enabledXsaveStates = xgetbv(0u);
+            }
         }
     }
 
@@ -40,6 +46,11 @@ void CpuInfo::detect() const {
             auto mask = BIT(5) | BIT(3) | BIT(8);
             features |= (cpuInfo[ebx] & mask) == mask ? featureAvX2 : featureNone;
 
+            // AVX-512 is usable only when the OS saves SSE, AVX, opmask and ZMM register states (XCR0 bits 1-2 and 5-7)
+            auto avx512Mask = BIT(16) | BIT(30);
+            auto avx512StatesMask = BIT(1) | BIT(2) | BIT(5) | BIT(6) | BIT(7);
+            features |= ((cpuInfo[ebx] & avx512Mask) == avx512Mask) && ((enabledXsaveStates & avx512StatesMask) == avx512StatesMask) ? featureAvx512 : featureNone;
+
             features |= (cpuInfo[ecx] & BIT(5)) ? featureWaitPkg : featureNone;
         }
     }
@@ -53,7 +64,7 @@ void CpuInfo::detect() const {
         }
     }
     if (debugManager.flags.PrintCpuFlags.get()) {
-        printf("CPUFlags:\nCLFlush: %d Avx2: %d WaitPkg: %d\nVirtual Address Size %u\n", !!(features & featureClflush), !!(features & featureAvX2), !!(features & featureWaitPkg), virtualAddressSize);
+        printf("CPUFlags:\nCLFlush: %d Avx2: %d Avx512: %d WaitPkg: %d\nVirtual Address Size %u\n", !!(features & featureClflush), !!(features & featureAvX2), !!(features & featureAvx512), !!(features & featureWaitPkg), virtualAddressSize);
     }
 }
 } // namespace NEO
@@ -20,6 +20,7 @@
 
 #include <map>
 #include <optional>
+#include <thread>
 
 namespace NEO {
 class GmmPageTableMngr;
@@ -290,6 +291,12 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
         latestWaitForCompletionWithTimeoutTaskCount.store(taskCountToWait);
         latestWaitForCompletionWithTimeoutWaitParams = params;
         waitForCompletionWithTimeoutTaskCountCalled++;
+        if (checkOwnershipOnWaitForCompletion) {
+            std::thread([this]() {
+                std::unique_lock<CommandStreamReceiver::MutexType> ownershipLock(this->ownershipMutex, std::try_to_lock);
+                ownershipHeldOnWaitForCompletion = !ownershipLock.owns_lock();
+            }).join();
+        }
         if (callBaseWaitForCompletionWithTimeout) {
             return BaseClass::waitForCompletionWithTimeout(params, taskCountToWait);
         }
@@ -539,6 +546,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     std::mutex mutex;
     std::atomic<uint32_t> recursiveLockCounter;
     std::atomic<uint32_t> waitForCompletionWithTimeoutTaskCountCalled{0};
+    std::atomic<bool> ownershipHeldOnWaitForCompletion{false};
     std::atomic<uint64_t> pagingFenceValueToUnblock{0u};
     uint32_t makeSurfacePackNonResidentCalled = false;
     uint32_t blitBufferCalled = 0;
@@ -579,6 +587,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     bool blitterDirectSubmissionAvailable = false;
     bool callBaseIsMultiOsContextCapable = false;
     bool callBaseWaitForCompletionWithTimeout = true;
+    bool checkOwnershipOnWaitForCompletion = false;
     bool shouldFailFlushBatchedSubmissions = false;
     bool shouldFlushBatchedSubmissionsReturnSuccess = false;
     bool callBaseFillReusableAllocationsList = false;
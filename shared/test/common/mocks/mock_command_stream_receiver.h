@@ -32,6 +32,7 @@ using namespace NEO;
 class MockCommandStreamReceiver : public CommandStreamReceiver {
   public:
     using CommandStreamReceiver::activePartitions;
+    using CommandStreamReceiver::adaptiveWaitPolicyEnabled;
     using CommandStreamReceiver::baseWaitFunction;
     using CommandStreamReceiver::checkForNewResources;
     using CommandStreamReceiver::checkImplicitFlushForGpuIdle;
@@ -57,6 +58,7 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
     using CommandStreamReceiver::timeStampPostSyncWriteOffset;
     using CommandStreamReceiver::useGpuIdleImplicitFlush;
     using CommandStreamReceiver::useNewResourceImplicitFlush;
+    using CommandStreamReceiver::waitPolicy;
 
     MockCommandStreamReceiver(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex, const DeviceBitfield deviceBitfield)
         : CommandStreamReceiver(executionEnvironment, rootDeviceIndex, deviceBitfield) {
@@ -237,6 +239,10 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
         return getLastDirectSubmissionThrottleReturnValue;
     }
 
+    void moveDirectSubmissionGapSamples(SubmissionGapHistogram &histogram) override {
+        directSubmissionGapRecorder.moveSamplesTo(histogram);
+    }
+
     bool getAcLineConnected(bool updateStatus) const override {
         return getAcLineConnectedReturnValue;
     }
@@ -271,6 +277,7 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
     CommandStreamReceiverType commandStreamReceiverType = CommandStreamReceiverType::hardware;
     BatchBuffer latestFlushedBatchBuffer = {};
     QueueThrottle getLastDirectSubmissionThrottleReturnValue = QueueThrottle::MEDIUM;
+    SubmissionGapRecorder directSubmissionGapRecorder;
     bool getAcLineConnectedReturnValue = true;
     bool submitDependencyUpdateReturnValue = true;
     std::atomic<uint64_t> pagingFenceValueToUnblock{0u};
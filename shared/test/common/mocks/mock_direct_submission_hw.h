@@ -17,6 +17,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass = DirectSubmissionHw<GfxFamily, Dispatcher>;
     using BaseClass::activeTiles;
     using BaseClass::allocateResources;
+    using BaseClass::bytesCopiedIntoRing;
     using BaseClass::completionFenceAllocation;
     using BaseClass::copyCommandBufferIntoRing;
     using BaseClass::cpuCachelineFlush;
@@ -59,6 +60,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::inputMonitorFenceDispatchRequirement;
     using BaseClass::isDisablePrefetcherRequired;
     using BaseClass::lastSubmittedThrottle;
+    using BaseClass::maxRingBufferCount;
     using BaseClass::miMemFenceRequired;
     using BaseClass::osContext;
     using BaseClass::partitionConfigSet;
@@ -67,11 +69,13 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::performDiagnosticMode;
     using BaseClass::preinitializedRelaxedOrderingScheduler;
     using BaseClass::preinitializedTaskStoreSection;
+    using BaseClass::recordSubmissionGaps;
     using BaseClass::relaxedOrderingEnabled;
     using BaseClass::relaxedOrderingInitialized;
     using BaseClass::relaxedOrderingSchedulerAllocation;
     using BaseClass::relaxedOrderingSchedulerRequired;
     using BaseClass::reserved;
+    using BaseClass::ringBufferSwitches;
     using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
     using BaseClass::ringStart;
@@ -80,8 +84,10 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::semaphoreGpuVa;
     using BaseClass::semaphorePtr;
     using BaseClass::semaphores;
+    using BaseClass::semaphoreWaits;
     using BaseClass::setReturnAddress;
     using BaseClass::stopRingBuffer;
+    using BaseClass::switchRingBuffers;
     using BaseClass::switchRingBuffersAllocations;
     using BaseClass::switchRingBuffersNeeded;
     using BaseClass::systemMemoryFenceAddressSet;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/memory_manager/gfx_partition.h"
+#include "shared/source/utilities/heap_allocator.h"
 
 using namespace NEO;
 
@@ -22,6 +23,10 @@ class MockGfxPartition : public GfxPartition {
         return getHeap(heapIndex).getSize();
     }
 
+    HeapAllocatorMode getHeapAllocatorMode(HeapIndex heapIndex) {
+        return getHeap(heapIndex).getAllocatorMode();
+    }
+
     bool heapInitialized(HeapIndex heapIndex) {
         return getHeapSize(heapIndex) > 0;
     }
@@ -15,13 +15,16 @@
 namespace NEO {
 struct MockSVMAllocsManager : public SVMAllocsManager {
   public:
+    using SVMAllocsManager::lockFreeLookupEnabled;
     using SVMAllocsManager::memoryManager;
     using SVMAllocsManager::mtxForIndirectAccess;
     using SVMAllocsManager::multiOsContextSupport;
     using SVMAllocsManager::svmAllocs;
+    using SVMAllocsManager::svmAllocsLookupIndex;
     using SVMAllocsManager::SVMAllocsManager;
     using SVMAllocsManager::svmDeferFreeAllocs;
     using SVMAllocsManager::svmMapOperations;
+    using SVMAllocsManager::unifiedMemoryReuseCleaner;
     using SVMAllocsManager::usmDeviceAllocationsCache;
     using SVMAllocsManager::usmDeviceAllocationsCacheEnabled;
     using SVMAllocsManager::usmHostAllocationsCache;
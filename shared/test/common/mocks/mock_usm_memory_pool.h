@@ -12,9 +12,33 @@ namespace NEO {
 class MockUsmMemAllocPool : public UsmMemAllocPool {
   public:
     using UsmMemAllocPool::allocations;
+    using UsmMemAllocPool::chunkAllocator;
+    using UsmMemAllocPool::maxServicedSize;
+    using UsmMemAllocPool::minServicedSize;
     using UsmMemAllocPool::pool;
     using UsmMemAllocPool::poolEnd;
     using UsmMemAllocPool::poolMemoryType;
     using UsmMemAllocPool::poolSize;
 };
+
+class MockUsmMemAllocPoolsManager : public UsmMemAllocPoolsManager {
+  public:
+    using UsmMemAllocPoolsManager::getSizeClassIndex;
+    using UsmMemAllocPoolsManager::maxPoolsSize;
+    using UsmMemAllocPoolsManager::pools;
+    using UsmMemAllocPoolsManager::poolsByAddress;
+    using UsmMemAllocPoolsManager::poolsSize;
+
+    std::unique_ptr<UsmMemAllocPool> createPool(uint32_t sizeClassIndex) override {
+        createPoolCalled++;
+        if (createPoolFailures > 0u) {
+            createPoolFailures--;
+            return nullptr;
+        }
+        return UsmMemAllocPoolsManager::createPool(sizeClassIndex);
+    }
+
+    uint32_t createPoolCalled = 0u;
+    uint32_t createPoolFailures = 0u;
+};
 } // namespace NEO
\ No newline at end of file
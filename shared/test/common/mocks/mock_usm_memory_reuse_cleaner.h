@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/unified_memory_reuse_cleaner.h"
+
+namespace NEO {
+struct MockUnifiedMemoryReuseCleaner : public UnifiedMemoryReuseCleaner {
+  public:
+    using UnifiedMemoryReuseCleaner::keepCleaning;
+    using UnifiedMemoryReuseCleaner::sleepTime;
+    using UnifiedMemoryReuseCleaner::svmAllocationCaches;
+    using UnifiedMemoryReuseCleaner::trimOldInCaches;
+    using UnifiedMemoryReuseCleaner::UnifiedMemoryReuseCleaner;
+    using UnifiedMemoryReuseCleaner::unifiedMemoryReuseCleanerThread;
+
+    void startThread() override {
+        startThreadCalled = true;
+        if (callBaseStartThread) {
+            UnifiedMemoryReuseCleaner::startThread();
+        }
+    }
+
+    bool callBaseStartThread = false;
+    bool startThreadCalled = false;
+};
+} // namespace NEO
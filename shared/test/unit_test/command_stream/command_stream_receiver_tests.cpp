@@ -328,6 +328,16 @@ HWTEST_F(CommandStreamReceiverTest, WhenCreatingCsrThenTimestampTypeIs32b) {
     EXPECT_EQ(expectedOffset, tag->getGlobalStartOffset());
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenPreallocateTimestampPacketTagsSetWhenCreatingTimestampPacketAllocatorThenTagsArePreallocated) {
+    DebugManagerStateRestore restorer;
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    debugManager.flags.PreallocateTimestampPacketTags.set(static_cast<int32_t>(csr.getPreferredTagPoolSize() * 2 + 1));
+    csr.timestampPacketAllocator.reset();
+
+    auto allocator = csr.getTimestampPacketAllocator();
+    EXPECT_EQ(csr.getPreferredTagPoolSize() * 3, allocator->getTotalTagCount());
+}
+
 HWTEST_F(CommandStreamReceiverTest, WhenCreatingCsrThenFlagsAreSetCorrectly) {
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
     csr.initProgrammingFlags();
@@ -1839,6 +1849,58 @@ TEST(CommandStreamReceiverSimpleTest, givenMultipleActivePartitionsWhenWaitingFo
     CpuIntrinsicsTests::pauseAddress = nullptr;
 }
 
+TEST(CommandStreamReceiverSimpleTest, givenAdaptiveWaitPolicyDebugFlagWhenCreatingCsrThenPolicyIsEnabledAccordingly) {
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment executionEnvironment;
+    DeviceBitfield deviceBitfield(1);
+
+    MockCommandStreamReceiver defaultCsr(executionEnvironment, 0, deviceBitfield);
+    EXPECT_FALSE(defaultCsr.adaptiveWaitPolicyEnabled);
+
+    debugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+    MockCommandStreamReceiver enabledCsr(executionEnvironment, 0, deviceBitfield);
+    EXPECT_TRUE(enabledCsr.adaptiveWaitPolicyEnabled);
+
+    debugManager.flags.EnableAdaptiveWaitPolicy.set(0);
+    MockCommandStreamReceiver disabledCsr(executionEnvironment, 0, deviceBitfield);
+    EXPECT_FALSE(disabledCsr.adaptiveWaitPolicyEnabled);
+}
+
+TEST(CommandStreamReceiverSimpleTest, givenAdaptiveWaitPolicyEnabledWhenWaitingForTaskCountThenSpinPhaseIsUsedAndCompletionTimeIsRecorded) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableWaitpkg.set(0);
+    debugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+
+    MockExecutionEnvironment executionEnvironment;
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    EXPECT_TRUE(csr.adaptiveWaitPolicyEnabled);
+
+    csr.mockTagAddress[0] = 0u;
+    csr.latestFlushedTaskCount = 3u;
+
+    VariableBackup<volatile TagAddressType *> backupPauseAddress(&CpuIntrinsicsTests::pauseAddress);
+    VariableBackup<TaskCountType> backupPauseValue(&CpuIntrinsicsTests::pauseValue);
+    VariableBackup<uint32_t> backupPauseOffset(&CpuIntrinsicsTests::pauseOffset);
+
+    CpuIntrinsicsTests::pauseAddress = &csr.mockTagAddress[0];
+    CpuIntrinsicsTests::pauseValue = 3u;
+    CpuIntrinsicsTests::pauseOffset = 0u;
+
+    CpuIntrinsicsTests::pauseCounter = 0;
+
+    EXPECT_EQ(0, csr.waitPolicy.getAverageCompletionTime());
+    auto waitStatus = csr.baseWaitFunction(&csr.mockTagAddress[0], WaitParams{false, false, false, 0}, 3u);
+    EXPECT_EQ(WaitStatus::ready, waitStatus);
+    EXPECT_EQ(WaitUtils::adaptiveSpinPauseCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_LT(0, csr.waitPolicy.getAverageCompletionTime());
+
+    auto averageCompletionTime = csr.waitPolicy.getAverageCompletionTime();
+    waitStatus = csr.baseWaitFunction(&csr.mockTagAddress[0], WaitParams{false, false, false, 0}, 3u);
+    EXPECT_EQ(WaitStatus::ready, waitStatus);
+    EXPECT_EQ(averageCompletionTime, csr.waitPolicy.getAverageCompletionTime());
+}
+
 TEST(CommandStreamReceiverSimpleTest, givenEmptyTemporaryAllocationListWhenWaitingForTaskCountForCleaningTemporaryAllocationsThenDoNotWait) {
     DebugManagerStateRestore restorer;
     debugManager.flags.EnableWaitpkg.set(0);
@@ -11,6 +11,7 @@
 #include "shared/source/command_stream/stream_properties.h"
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/kernel/grf_config.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
@@ -20,6 +21,8 @@
 
 #include "test_traits_common.h"
 
+#include <bitset>
+
 using namespace NEO;
 
 struct MockStateComputeModeProperties : public StateComputeModeProperties {
@@ -216,9 +219,15 @@ void verifyIsDirty() {
     auto allProperties = getAllProperties(properties);
 
     EXPECT_FALSE(properties.isDirty());
+    EXPECT_EQ(0u, properties.getDirtyMask());
+    uint32_t allDirtyMask = 0u;
     for (auto pProperty : allProperties) {
         pProperty->isDirty = true;
         EXPECT_TRUE(properties.isDirty());
+        auto dirtyMask = properties.getDirtyMask();
+        EXPECT_EQ(1u, std::bitset<32>(dirtyMask).count());
+        EXPECT_EQ(0u, allDirtyMask & dirtyMask);
+        allDirtyMask |= dirtyMask;
         pProperty->isDirty = false;
         EXPECT_FALSE(properties.isDirty());
     }
@@ -227,6 +236,7 @@ void verifyIsDirty() {
     }
 
     EXPECT_EQ(!allProperties.empty(), properties.isDirty());
+    EXPECT_EQ(allDirtyMask, properties.getDirtyMask());
 
     properties.clearIsDirty();
     for (auto pProperty : allProperties) {
@@ -396,6 +406,36 @@ TEST(StreamPropertiesTests, givenGrfNumberAndThreadArbitrationStateComputeModePr
     EXPECT_EQ(threadArbitration, scmProperties.threadArbitrationPolicy.value);
 }
 
+TEST(StreamPropertiesTests, givenKernelsWithAlternatingGrfNumberWhenSettingStateComputeModePropertiesThenOnlyLargeGrfModeIsReportedDirtyOnChange) {
+    MockStateComputeModeProperties scmProperties{};
+    scmProperties.propertiesSupportLoaded = true;
+    scmProperties.scmPropertiesSupport.largeGrfMode = true;
+    scmProperties.scmPropertiesSupport.threadArbitrationPolicy = true;
+
+    MockStateComputeModeProperties largeGrfModeDirty{};
+    largeGrfModeDirty.largeGrfMode.isDirty = true;
+    const auto largeGrfModeDirtyMask = largeGrfModeDirty.getDirtyMask();
+
+    int32_t threadArbitration = 1;
+    scmProperties.setPropertiesAll(false, GrfConfig::defaultGrfNumber, threadArbitration, PreemptionMode::Initial);
+
+    constexpr uint32_t numKernels = 1000u;
+    uint32_t numStateChanges = 0u;
+    uint32_t grfNumbers[] = {GrfConfig::defaultGrfNumber, GrfConfig::largeGrfNumber};
+    for (uint32_t i = 0; i < numKernels; i++) {
+        auto grfNumber = grfNumbers[(i / 2) % 2];
+        scmProperties.setPropertiesGrfNumberThreadArbitration(grfNumber, threadArbitration);
+
+        auto dirtyMask = scmProperties.getDirtyMask();
+        if (dirtyMask != 0u) {
+            EXPECT_EQ(largeGrfModeDirtyMask, dirtyMask);
+            numStateChanges++;
+        }
+        EXPECT_EQ(grfNumber == GrfConfig::largeGrfNumber ? 1 : 0, scmProperties.largeGrfMode.value);
+    }
+    EXPECT_EQ(numKernels / 2 - 1, numStateChanges);
+}
+
 TEST(StreamPropertiesTests, givenSetAllStateComputeModePropertiesWhenResettingStateThenResetValuesAndDirtyKeepSupportFlagLoaded) {
     DebugManagerStateRestore restorer;
     debugManager.flags.ForceScratchAndMTPBufferSizeMode.set(2);
@@ -1434,6 +1474,29 @@ TEST(StreamPropertiesTests, givenSetAllStateBaseAddressPropertiesWhenResettingSt
     EXPECT_TRUE(sbaProperties.stateBaseAddressPropertiesSupport.bindingTablePoolBaseAddress);
 }
 
+TEST(StreamPropertiesTests, givenStateBaseAddressPropertiesWhenOnlySizeChangesThenDirtyMaskIsNotSet) {
+    MockStateBaseAddressProperties sbaProperties{};
+    sbaProperties.propertiesSupportLoaded = true;
+    sbaProperties.stateBaseAddressPropertiesSupport.bindingTablePoolBaseAddress = true;
+
+    sbaProperties.setPropertiesAll(1, 0x1000, 0x100, 0x2000, 0x200, 0x3000, 0x300, 0x4000, 0x400);
+    auto allDirtyMask = sbaProperties.getDirtyMask();
+    EXPECT_EQ(5u, std::bitset<32>(allDirtyMask).count());
+
+    sbaProperties.setPropertiesAll(1, 0x1000, 0x1000, 0x2000, 0x2000, 0x3000, 0x3000, 0x4000, 0x4000);
+    EXPECT_EQ(0u, sbaProperties.getDirtyMask());
+    EXPECT_EQ(0x4000u, sbaProperties.indirectObjectSize.value);
+
+    sbaProperties.setPropertyStatelessMocs(2);
+    auto statelessMocsDirtyMask = sbaProperties.getDirtyMask();
+    EXPECT_EQ(1u, std::bitset<32>(statelessMocsDirtyMask).count());
+    EXPECT_NE(0u, allDirtyMask & statelessMocsDirtyMask);
+
+    sbaProperties.clearIsDirty();
+    EXPECT_EQ(0u, sbaProperties.getDirtyMask());
+    EXPECT_FALSE(sbaProperties.isDirty());
+}
+
 TEST(StreamPropertiesTests, givenAllStreamPropertiesSetWhenAllStreamPropertiesResetStateThenAllValuesBringToInitValue) {
     MockExecutionEnvironment executionEnvironment{};
     auto &rootDeviceEnvironment = *executionEnvironment.rootDeviceEnvironments[0];
@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_packed_storage.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace NEO;
+
+class MockCompilerCachePackedStorage : public CompilerCachePackedStorage {
+  public:
+    using CompilerCachePackedStorage::getSegment;
+    using CompilerCachePackedStorage::index;
+    using CompilerCachePackedStorage::initialize;
+
+    MockCompilerCachePackedStorage(uint64_t segmentSize) : CompilerCachePackedStorage(segmentSize) {}
+
+    IndexFile *mapIndex() override {
+        mapIndexCalled++;
+        if (failMapIndex) {
+            return nullptr;
+        }
+        return indexFile.get();
+    }
+
+    bool lockIndex() override {
+        lockIndexCalled++;
+        return !failLockIndex;
+    }
+
+    void unlockIndex() override {
+        unlockIndexCalled++;
+    }
+
+    bool readSegment(uint32_t segment, uint64_t offset, void *data, size_t size) override {
+        auto &segmentData = segments[segment];
+        if (offset + size > segmentData.size()) {
+            return false;
+        }
+        memcpy(data, segmentData.data() + offset, size);
+        return true;
+    }
+
+    bool writeSegment(uint32_t segment, uint64_t offset, const void *data, size_t size) override {
+        writeSegmentCalled++;
+        if (failWriteSegment) {
+            return false;
+        }
+        auto &segmentData = segments[segment];
+        if (offset + size > segmentData.size()) {
+            segmentData.resize(static_cast<size_t>(offset + size));
+        }
+        memcpy(segmentData.data() + offset, data, size);
+        return true;
+    }
+
+    std::unique_ptr<IndexFile> indexFile = std::make_unique<IndexFile>();
+    std::array<std::vector<char>, numSegments> segments;
+    uint32_t mapIndexCalled = 0u;
+    uint32_t lockIndexCalled = 0u;
+    uint32_t unlockIndexCalled = 0u;
+    uint32_t writeSegmentCalled = 0u;
+    bool failMapIndex = false;
+    bool failLockIndex = false;
+    bool failWriteSegment = false;
+};
+
+struct CompilerCachePackedStorageTest : public ::testing::Test {
+    void SetUp() override {
+        storage = std::make_unique<MockCompilerCachePackedStorage>(segmentSize);
+        ASSERT_TRUE(storage->initialize());
+    }
+
+    static std::string getHash(uint32_t id) {
+        char hash[17] = {};
+        snprintf(hash, sizeof(hash), "%016x", id + 1);
+        return hash;
+    }
+
+    static constexpr uint64_t segmentSize = 256u;
+    std::unique_ptr<MockCompilerCachePackedStorage> storage;
+};
+
+TEST_F(CompilerCachePackedStorageTest, givenNewIndexWhenInitializingThenHeaderIsWrittenAndIndexIsEmpty) {
+    auto &header = storage->index->header;
+    EXPECT_EQ(CompilerCachePackedStorage::indexMagic, header.magic.load());
+    EXPECT_EQ(CompilerCachePackedStorage::indexVersion, header.version);
+    EXPECT_EQ(segmentSize, header.segmentSize);
+    EXPECT_EQ(1u, storage->lockIndexCalled);
+    EXPECT_EQ(1u, storage->unlockIndexCalled);
+
+    size_t size = 0;
+    EXPECT_EQ(nullptr, storage->load(getHash(0), size));
+    EXPECT_EQ(0u, size);
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenStoredBinaryWhenLoadingThenSameBinaryIsReturnedWithoutLockingIndex) {
+    const char binary[] = "12345678";
+    EXPECT_TRUE(storage->store(getHash(0), binary, sizeof(binary)));
+
+    const auto lockCount = storage->lockIndexCalled;
+    size_t size = 0;
+    auto loaded = storage->load(getHash(0), size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loaded.get(), size));
+    EXPECT_EQ(lockCount, storage->lockIndexCalled);
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenBinaryAlreadyStoredWhenStoringAgainThenNothingIsWritten) {
+    const char binary[] = "12345678";
+    EXPECT_TRUE(storage->store(getHash(0), binary, sizeof(binary)));
+    const auto writeCount = storage->writeSegmentCalled;
+
+    EXPECT_TRUE(storage->store(getHash(0), binary, sizeof(binary)));
+    EXPECT_EQ(writeCount, storage->writeSegmentCalled);
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenInvalidInputOrTooBigBinaryWhenStoringThenFalseIsReturned) {
+    const char binary[] = "12345678";
+    EXPECT_FALSE(storage->store(getHash(0), nullptr, sizeof(binary)));
+    EXPECT_FALSE(storage->store(getHash(0), binary, 0));
+
+    auto bigBinary = std::make_unique<char[]>(segmentSize);
+    EXPECT_FALSE(storage->store(getHash(0), bigBinary.get(), segmentSize));
+    EXPECT_EQ(0u, storage->writeSegmentCalled);
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenIndexLockFailsOrSegmentWriteFailsWhenStoringThenFalseIsReturnedAndBinaryIsNotVisible) {
+    const char binary[] = "12345678";
+    storage->failLockIndex = true;
+    EXPECT_FALSE(storage->store(getHash(0), binary, sizeof(binary)));
+
+    storage->failLockIndex = false;
+    storage->failWriteSegment = true;
+    EXPECT_FALSE(storage->store(getHash(0), binary, sizeof(binary)));
+    EXPECT_EQ(storage->lockIndexCalled, storage->unlockIndexCalled + 1);
+
+    size_t size = 0;
+    EXPECT_EQ(nullptr, storage->load(getHash(0), size));
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenEntryBeingPublishedWhenLoadingThenBinaryIsNotReturned) {
+    const char binary[] = "12345678";
+    EXPECT_TRUE(storage->store(getHash(0), binary, sizeof(binary)));
+
+    const auto key = CompilerCachePackedStorage::getKey(getHash(0));
+    auto &entry = storage->index->entries[key % CompilerCachePackedStorage::numIndexEntries];
+    EXPECT_EQ(key, entry.key.load());
+    entry.sequence.fetch_add(1);
+
+    size_t size = 0;
+    EXPECT_EQ(nullptr, storage->load(getHash(0), size));
+
+    entry.sequence.fetch_add(1);
+    EXPECT_NE(nullptr, storage->load(getHash(0), size));
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenSegmentRingWrappedWhenStoringThenOnlyOldestSegmentIsEvicted) {
+    char binary[100] = {};
+    for (uint32_t i = 0; i < 2 * CompilerCachePackedStorage::numSegments; i++) {
+        binary[0] = static_cast<char>(i);
+        EXPECT_TRUE(storage->store(getHash(i), binary, sizeof(binary)));
+    }
+    EXPECT_EQ(CompilerCachePackedStorage::numSegments - 1, storage->index->header.currentGeneration);
+    EXPECT_EQ(0u, storage->index->header.oldestGeneration.load());
+
+    binary[0] = static_cast<char>(2 * CompilerCachePackedStorage::numSegments);
+    EXPECT_TRUE(storage->store(getHash(2 * CompilerCachePackedStorage::numSegments), binary, sizeof(binary)));
+    EXPECT_EQ(1u, storage->index->header.oldestGeneration.load());
+
+    size_t size = 0;
+    EXPECT_EQ(nullptr, storage->load(getHash(0), size));
+    EXPECT_EQ(nullptr, storage->load(getHash(1), size));
+    for (uint32_t i = 2; i <= 2 * CompilerCachePackedStorage::numSegments; i++) {
+        auto loaded = storage->load(getHash(i), size);
+        ASSERT_NE(nullptr, loaded);
+        EXPECT_EQ(static_cast<char>(i), loaded[0]);
+    }
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenRecentlyUsedBinaryInOldestSegmentWhenSegmentIsRecycledThenBinaryIsCarriedOver) {
+    char binary[100] = {};
+    for (uint32_t i = 0; i < 2 * CompilerCachePackedStorage::numSegments; i++) {
+        binary[0] = static_cast<char>(i);
+        EXPECT_TRUE(storage->store(getHash(i), binary, sizeof(binary)));
+    }
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, storage->load(getHash(1), size));
+
+    EXPECT_TRUE(storage->store(getHash(2 * CompilerCachePackedStorage::numSegments), binary, sizeof(binary)));
+
+    EXPECT_EQ(nullptr, storage->load(getHash(0), size));
+    auto loaded = storage->load(getHash(1), size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(1, loaded[0]);
+    EXPECT_EQ(sizeof(binary), size);
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenRecentlyUsedBinaryInOldestSegmentAndLargeBinaryWhenSegmentIsRecycledThenCarryOverLeavesSpaceForLargeBinary) {
+    char binary[100] = {};
+    for (uint32_t i = 0; i < 2 * CompilerCachePackedStorage::numSegments; i++) {
+        EXPECT_TRUE(storage->store(getHash(i), binary, sizeof(binary)));
+    }
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, storage->load(getHash(1), size));
+
+    char largeBinary[segmentSize - sizeof(CompilerCachePackedStorage::RecordHeader)] = {};
+    largeBinary[0] = 7;
+    EXPECT_TRUE(storage->store(getHash(2 * CompilerCachePackedStorage::numSegments), largeBinary, sizeof(largeBinary)));
+    EXPECT_EQ(segmentSize, storage->index->header.currentSegmentUsedSize);
+    EXPECT_EQ(segmentSize, storage->segments[MockCompilerCachePackedStorage::getSegment(storage->index->header.currentGeneration)].size());
+
+    EXPECT_EQ(nullptr, storage->load(getHash(1), size));
+    auto loaded = storage->load(getHash(2 * CompilerCachePackedStorage::numSegments), size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(7, loaded[0]);
+    EXPECT_EQ(sizeof(largeBinary), size);
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenEvictedBinaryWhenStoringItAgainThenItIsLoadable) {
+    char binary[100] = {};
+    for (uint32_t i = 0; i <= 2 * CompilerCachePackedStorage::numSegments; i++) {
+        EXPECT_TRUE(storage->store(getHash(i), binary, sizeof(binary)));
+    }
+
+    size_t size = 0;
+    EXPECT_EQ(nullptr, storage->load(getHash(0), size));
+    EXPECT_TRUE(storage->store(getHash(0), binary, sizeof(binary)));
+    EXPECT_NE(nullptr, storage->load(getHash(0), size));
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenIndexWithDifferentLayoutWhenInitializingThenIndexIsReset) {
+    const char binary[] = "12345678";
+    EXPECT_TRUE(storage->store(getHash(0), binary, sizeof(binary)));
+
+    auto otherStorage = std::make_unique<MockCompilerCachePackedStorage>(2 * segmentSize);
+    otherStorage->indexFile = std::move(storage->indexFile);
+    otherStorage->segments = storage->segments;
+    EXPECT_TRUE(otherStorage->initialize());
+    EXPECT_EQ(2 * segmentSize, otherStorage->index->header.segmentSize);
+
+    size_t size = 0;
+    EXPECT_EQ(nullptr, otherStorage->load(getHash(0), size));
+}
+
+TEST_F(CompilerCachePackedStorageTest, givenIndexWithSameLayoutWhenInitializingThenStoredBinariesAreShared) {
+    const char binary[] = "12345678";
+    EXPECT_TRUE(storage->store(getHash(0), binary, sizeof(binary)));
+
+    auto otherStorage = std::make_unique<MockCompilerCachePackedStorage>(segmentSize);
+    otherStorage->indexFile = std::move(storage->indexFile);
+    otherStorage->segments = storage->segments;
+    EXPECT_TRUE(otherStorage->initialize());
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, otherStorage->load(getHash(0), size));
+    EXPECT_EQ(sizeof(binary), size);
+}
+
+TEST(CompilerCachePackedStorageInitTest, givenMapOrLockFailureWhenInitializingThenFalseIsReturnedAndStorageIsUnusable) {
+    MockCompilerCachePackedStorage storage(256u);
+    storage.failMapIndex = true;
+    EXPECT_FALSE(storage.initialize());
+
+    storage.failMapIndex = false;
+    storage.failLockIndex = true;
+    EXPECT_FALSE(storage.initialize());
+
+    const char binary[] = "12345678";
+    EXPECT_FALSE(storage.store("0123456789abcdef", binary, sizeof(binary)));
+    size_t size = 0;
+    EXPECT_EQ(nullptr, storage.load("0123456789abcdef", size));
+}
+
+TEST(CompilerCachePackedStorageKeyTest, givenHexHashWhenGettingKeyThenHashValueIsUsedOtherwiseStringIsHashed) {
+    EXPECT_EQ(0x0123456789abcdefu, CompilerCachePackedStorage::getKey("0123456789abcdef"));
+
+    auto key = CompilerCachePackedStorage::getKey("not a hex hash");
+    EXPECT_NE(CompilerCachePackedStorage::emptyKey, key);
+    EXPECT_NE(CompilerCachePackedStorage::tombstoneKey, key);
+    EXPECT_NE(CompilerCachePackedStorage::emptyKey, CompilerCachePackedStorage::getKey("0000000000000000"));
+    EXPECT_NE(CompilerCachePackedStorage::tombstoneKey, CompilerCachePackedStorage::getKey("ffffffffffffffff"));
+}
@@ -2349,6 +2349,66 @@ TEST_F(LinkerTests, givenMultipleImplicitArgsRelocationsWithinSingleKernelWhenLi
     }
 }
 
+TEST_F(LinkerTests, givenMultipleWorkerThreadsWhenPatchingManyInstructionSegmentsThenAllSegmentsArePatchedAndUnresolvedExternalsAreKeptInSegmentOrder) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ModuleLoadWorkerThreads.set(4);
+
+    constexpr uint32_t numSegments = 16;
+    NEO::LinkerInput linkerInput;
+
+    vISA::GenRelocEntry implicitArgsReloc = {};
+    std::string relocationName = implicitArgsRelocationSymbolName;
+    memcpy_s(implicitArgsReloc.r_symbol, 1024, relocationName.c_str(), relocationName.size());
+    implicitArgsReloc.r_offset = 8;
+    implicitArgsReloc.r_type = vISA::GenRelocType::R_SYM_ADDR_32;
+
+    vISA::GenRelocEntry unresolvedReloc = {};
+    std::string unresolvedName = "unresolved";
+    memcpy_s(unresolvedReloc.r_symbol, 1024, unresolvedName.c_str(), unresolvedName.size());
+    unresolvedReloc.r_offset = 16;
+    unresolvedReloc.r_type = vISA::GenRelocType::R_SYM_ADDR;
+
+    vISA::GenRelocEntry relocs[] = {implicitArgsReloc, unresolvedReloc};
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        EXPECT_TRUE(linkerInput.decodeRelocationTable(&relocs, 2, segId));
+    }
+
+    NEO::Linker linker(linkerInput);
+    NEO::Linker::SegmentInfo globalVarSegment, globalConstSegment, exportedFuncSegment;
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::ExternalFunctionsT externalFunctions;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    std::vector<KernelDescriptor> descriptors(numSegments);
+    std::vector<std::vector<char>> instructionSegments(numSegments);
+    NEO::Linker::PatchableSegments patchableInstructionSegments;
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        descriptors[segId].kernelAttributes.flags.useStackCalls = true;
+        kernelDescriptors.push_back(&descriptors[segId]);
+        instructionSegments[segId].resize(32, 0x77);
+        NEO::Linker::PatchableSegment segment;
+        segment.hostPointer = instructionSegments[segId].data();
+        segment.segmentSize = instructionSegments[segId].size();
+        patchableInstructionSegments.push_back(segment);
+    }
+
+    UltDeviceFactory deviceFactory{1, 0};
+
+    auto linkResult = linker.link(globalVarSegment, globalConstSegment, exportedFuncSegment, {},
+                                  nullptr, nullptr, patchableInstructionSegments, unresolvedExternals,
+                                  deviceFactory.rootDevices[0], nullptr, 0, nullptr, 0, kernelDescriptors, externalFunctions);
+    EXPECT_EQ(NEO::LinkingStatus::linkedPartially, linkResult);
+
+    ASSERT_EQ(numSegments, unresolvedExternals.size());
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        EXPECT_EQ(segId, unresolvedExternals[segId].instructionsSegmentId);
+        EXPECT_EQ(unresolvedName, unresolvedExternals[segId].unresolvedRelocation.symbolName);
+
+        auto addressToPatch = reinterpret_cast<const uint32_t *>(instructionSegments[segId].data() + implicitArgsReloc.r_offset);
+        EXPECT_EQ(ImplicitArgs::getSize(), *addressToPatch);
+        EXPECT_TRUE(descriptors[segId].kernelAttributes.flags.requiresImplicitArgs);
+    }
+}
+
 HWTEST_F(LinkerTests, givenDependencyOnMissingExternalFunctionWhenLinkingThenFail) {
     WhiteBox<NEO::LinkerInput> linkerInput;
     linkerInput.extFunDependencies.push_back({"fun0", "fun1"});
@@ -28,7 +28,9 @@
 
 #include <array>
 #include <list>
+#include <map>
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -36,6 +38,7 @@ class CompilerCacheMockLinux : public CompilerCache {
   public:
     CompilerCacheMockLinux(const CompilerCacheConfig &config) : CompilerCache(config) {}
     using CompilerCache::createUniqueTempFileAndWriteData;
+    using CompilerCache::packedStorage;
     using CompilerCache::evictCache;
     using CompilerCache::lockConfigFileAndReadSize;
     using CompilerCache::renameTempFileBinaryToProperName;
@@ -1061,3 +1064,69 @@ TEST(CompilerCacheHelper, GivenNotExistingPathWhenGettingFileSizeThenZeroIsRetur
 
     EXPECT_EQ(getFileSize("/tmp/file1"), 0u);
 }
+
+namespace PackedCacheFiles {
+int nextFileDescriptor = 200;
+std::map<int, std::vector<char>> files;
+
+decltype(NEO::SysCalls::sysCallsOpenWithMode) mockOpenWithMode = [](const char *pathname, int flags, int mode) -> int {
+    return nextFileDescriptor++;
+};
+decltype(NEO::SysCalls::sysCallsPwrite) mockPwrite = [](int fd, const void *buf, size_t count, off_t offset) -> ssize_t {
+    auto &file = files[fd];
+    if (file.size() < static_cast<size_t>(offset) + count) {
+        file.resize(static_cast<size_t>(offset) + count);
+    }
+    memcpy(file.data() + offset, buf, count);
+    return static_cast<ssize_t>(count);
+};
+decltype(NEO::SysCalls::sysCallsPread) mockPread = [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+    auto &file = files[fd];
+    if (file.size() < static_cast<size_t>(offset) + count) {
+        return 0;
+    }
+    memcpy(buf, file.data() + offset, count);
+    return static_cast<ssize_t>(count);
+};
+} // namespace PackedCacheFiles
+
+TEST(CompilerCacheLinuxPackedFormatTest, givenPackedFormatEnabledWhenCachingBinaryThenBinaryIsStoredInPackedSegmentsAndLoaded) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.BinaryCachePackedFormat.set(1);
+    PackedCacheFiles::files.clear();
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, PackedCacheFiles::mockOpenWithMode);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPwrite)> pwriteBackup(&NEO::SysCalls::sysCallsPwrite, PackedCacheFiles::mockPwrite);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup(&NEO::SysCalls::sysCallsPread, PackedCacheFiles::mockPread);
+    VariableBackup<decltype(NEO::SysCalls::mkstempCalled)> mkstempCalledBackup(&NEO::SysCalls::mkstempCalled, 0);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    ASSERT_NE(nullptr, cache.packedStorage);
+
+    const char binary[] = "12345678";
+    EXPECT_TRUE(cache.cacheBinary("0123456789abcdef", binary, sizeof(binary)));
+    EXPECT_EQ(0, NEO::SysCalls::mkstempCalled);
+
+    size_t size = 0;
+    auto loaded = cache.loadCachedBinary("0123456789abcdef", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loaded.get(), size));
+
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("fedcba9876543210", size));
+}
+
+TEST(CompilerCacheLinuxPackedFormatTest, givenPackedFormatEnabledAndIndexCannotBeOpenedWhenCreatingCacheThenPerFileCacheIsUsed) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.BinaryCachePackedFormat.set(1);
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int { return -1; });
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_EQ(nullptr, cache.packedStorage);
+}
+
+TEST(CompilerCacheLinuxPackedFormatTest, givenPackedFormatNotEnabledWhenCreatingCacheThenPerFileCacheIsUsed) {
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_EQ(nullptr, cache.packedStorage);
+}
@@ -255,6 +255,27 @@ TEST(YamlConsumeStringLiteral, GivenQuotedStringThenConsumeUntilEndingMarkIsMet)
     EXPECT_EQ(unterminatedDoubleQuote.begin(), NEO::Yaml::consumeStringLiteral(unterminatedDoubleQuote, unterminatedDoubleQuote.begin())) << unterminatedDoubleQuote.data();
 }
 
+TEST(YamlConsumeSpaces, GivenRunOfSpacesThenConsumeWholeRun) {
+    ConstStringRef noSpaces = "a  ";
+    ConstStringRef shortRun = "   a";
+    ConstStringRef longRun = "                   \t ";
+    ConstStringRef onlySpaces = "          ";
+
+    EXPECT_EQ(noSpaces.begin(), NEO::Yaml::consumeSpaces(noSpaces.begin(), noSpaces.end()));
+    EXPECT_EQ(shortRun.begin() + 3, NEO::Yaml::consumeSpaces(shortRun.begin(), shortRun.end()));
+    EXPECT_EQ(longRun.begin() + 19, NEO::Yaml::consumeSpaces(longRun.begin(), longRun.end()));
+    EXPECT_EQ(onlySpaces.end(), NEO::Yaml::consumeSpaces(onlySpaces.begin(), onlySpaces.end()));
+    EXPECT_EQ(onlySpaces.begin() + 9, NEO::Yaml::consumeSpaces(onlySpaces.begin(), onlySpaces.begin() + 9));
+}
+
+TEST(YamlFindLineEnd, GivenTextThenReturnPositionOfNewlineOrEndOfText) {
+    ConstStringRef text = "# comment\nnext line";
+
+    EXPECT_EQ(text.begin() + 9, NEO::Yaml::findLineEnd(text.begin(), text.end()));
+    EXPECT_EQ(text.end(), NEO::Yaml::findLineEnd(text.begin() + 10, text.end()));
+    EXPECT_EQ(text.end(), NEO::Yaml::findLineEnd(text.end(), text.end()));
+}
+
 TEST(YamlToken, WhenConstructedThenSetsUpProperDefaults) {
     ConstStringRef str = "\"some string\"";
     ConstStringRef identifier = "someIdentifier";
@@ -385,6 +406,29 @@ TEST(YamlTokenize, GivenTabsAsIndentThenEmitsWarning) {
     EXPECT_STREQ("NEO::Yaml : Tabs used as indent at line : 0\nNEO::Yaml : text tokenized to 0 tokens\n", warnings.c_str());
 }
 
+TEST(YamlTokenize, GivenLongIndentAndCommentsThenIndentIsCountedPerSpaceAndCommentsEndAtNewline) {
+    ConstStringRef yaml = "a:\n                      b: 1 # trailing comment\n           # full line comment\nc: 2\n";
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_TRUE(warnings.empty()) << warnings;
+    ASSERT_EQ(4U, lines.size());
+    EXPECT_EQ(0U, lines[0].indent);
+    EXPECT_EQ(22U, lines[1].indent);
+    EXPECT_EQ(NEO::Yaml::Line::LineType::dictionaryEntry, lines[1].lineType);
+    EXPECT_EQ(11U, lines[2].indent);
+    EXPECT_EQ(NEO::Yaml::Line::LineType::comment, lines[2].lineType);
+    EXPECT_EQ(0U, lines[3].indent);
+
+    EXPECT_TRUE(tokens[lines[1].first + 3] == '#');
+    EXPECT_TRUE(tokens[lines[1].first + 4] == " trailing comment");
+    EXPECT_TRUE(tokens[lines[1].first + 5] == '\n');
+}
+
 TEST(YamlTokenize, WhenTextDoesNotEndWithNewlineThenEmitsWarning) {
     NEO::Yaml::LinesCache lines;
     NEO::Yaml::TokensCache tokens;
@@ -4329,6 +4329,35 @@ TEST(DecodeZebinTest, givenGtpinInfoSectionsWhenDecodingZebinThenProperlySetIgcI
     EXPECT_EQ(0, memcmp(reinterpret_cast<const uint8_t *>(kernelInfo2->igcInfoForGtpin), mockGtpinData2.data(), mockGtpinData2.size()));
 }
 
+TEST(DecodeZebinTest, givenKernelSectionsWhenBuildingKernelSectionsIndexThenKernelNamesMapToTheirSectionsData) {
+    const uint8_t kernelData[0x10]{1u};
+    const uint8_t otherKernelData[0x20]{2u};
+    NEO::Elf::ElfEncoder<> elfEncoder;
+    elfEncoder.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Zebin::Elf::SectionNames::textPrefix.str() + "someKernel", ArrayRef<const uint8_t>::fromAny(kernelData, sizeof(kernelData)));
+    elfEncoder.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Zebin::Elf::SectionNames::textPrefix.str() + "someOtherKernel", ArrayRef<const uint8_t>::fromAny(otherKernelData, sizeof(otherKernelData)));
+    elfEncoder.appendSection(NEO::Zebin::Elf::SHT_ZEBIN_GTPIN_INFO, NEO::Zebin::Elf::SectionNames::gtpinInfo.str() + "someOtherKernel", ArrayRef<const uint8_t>::fromAny(kernelData, sizeof(kernelData)));
+
+    auto encodedElf = elfEncoder.encode();
+    std::string errors;
+    std::string warnings;
+    auto decodedElf = NEO::Elf::decodeElf(encodedElf, errors, warnings);
+    ZebinSections sections;
+    auto decodeError = extractZebinSections(decodedElf, sections, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::success, decodeError);
+
+    auto textSectionsIndex = buildKernelSectionsIndex(NEO::Zebin::Elf::SectionNames::textPrefix, decodedElf, sections.textKernelSections);
+    ASSERT_EQ(2U, textSectionsIndex.size());
+    EXPECT_EQ(sections.textKernelSections[0]->data.begin(), textSectionsIndex["someKernel"].begin());
+    EXPECT_EQ(sizeof(kernelData), textSectionsIndex["someKernel"].size());
+    EXPECT_EQ(sections.textKernelSections[1]->data.begin(), textSectionsIndex["someOtherKernel"].begin());
+    EXPECT_EQ(sizeof(otherKernelData), textSectionsIndex["someOtherKernel"].size());
+
+    auto gtpinInfoSectionsIndex = buildKernelSectionsIndex(NEO::Zebin::Elf::SectionNames::gtpinInfo, decodedElf, sections.gtpinInfoSections);
+    ASSERT_EQ(1U, gtpinInfoSectionsIndex.size());
+    EXPECT_EQ(gtpinInfoSectionsIndex.end(), gtpinInfoSectionsIndex.find("someKernel"));
+    EXPECT_EQ(sections.gtpinInfoSections[0]->data.begin(), gtpinInfoSectionsIndex["someOtherKernel"].begin());
+}
+
 TEST_F(decodeZeInfoKernelEntryTest, GivenValidExecutionEnvironmentThenPopulateKernelDescriptorProperly) {
     ConstStringRef zeinfo = R"===(
 kernels:
@@ -11,6 +11,8 @@
 
 namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
+    using DirectSubmissionController::adaptiveTimeout;
+    using DirectSubmissionController::adaptiveTimeoutPercentile;
     using DirectSubmissionController::adjustTimeoutOnThrottleAndAcLineStatus;
     using DirectSubmissionController::checkNewSubmissions;
     using DirectSubmissionController::condVarMutex;
@@ -631,4 +631,153 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenCheckTi
     EXPECT_FALSE(controller.timeoutElapsed());
 }
 
+TEST(SubmissionGapHistogramTests, givenSamplesWhenGettingGapForPercentileThenUpperBoundOfCoveringBucketIsReturned) {
+    SubmissionGapHistogram histogram;
+    for (uint32_t i = 0; i < 9; i++) {
+        histogram.addSample(std::chrono::microseconds(200));
+    }
+    histogram.addSample(std::chrono::microseconds(3'000));
+    histogram.addSample(std::chrono::microseconds(0));
+    EXPECT_EQ(11u, histogram.numSamples);
+    EXPECT_EQ(1u, histogram.buckets[0]);
+    EXPECT_EQ(9u, histogram.buckets[8]);
+    EXPECT_EQ(1u, histogram.buckets[12]);
+
+    EXPECT_EQ(256, histogram.getGapForPercentile(50).count());
+    EXPECT_EQ(256, histogram.getGapForPercentile(90).count());
+    EXPECT_EQ(4096, histogram.getGapForPercentile(100).count());
+
+    histogram.addSample(std::chrono::hours(1));
+    EXPECT_EQ(1u, histogram.buckets[SubmissionGapHistogram::numBuckets - 1]);
+}
+
+TEST(SubmissionGapHistogramTests, givenDecayThresholdReachedWhenAddingSampleThenOldSamplesAreHalved) {
+    SubmissionGapHistogram histogram;
+    for (uint32_t i = 0; i < SubmissionGapHistogram::decayThreshold - 1; i++) {
+        histogram.addSample(std::chrono::microseconds(200));
+    }
+    EXPECT_EQ(SubmissionGapHistogram::decayThreshold - 1, histogram.numSamples);
+
+    histogram.addSample(std::chrono::microseconds(200));
+    EXPECT_EQ(SubmissionGapHistogram::decayThreshold / 2, histogram.numSamples);
+    EXPECT_EQ(SubmissionGapHistogram::decayThreshold / 2, histogram.buckets[8]);
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveTimeoutDebugFlagsWhenCreateObjectThenAdaptivePolicyIsConfigured) {
+    DebugManagerStateRestore restorer;
+    {
+        DirectSubmissionControllerMock controller;
+        EXPECT_FALSE(controller.adaptiveTimeout);
+        EXPECT_EQ(DirectSubmissionController::defaultAdaptiveTimeoutPercentile, controller.adaptiveTimeoutPercentile);
+    }
+    debugManager.flags.DirectSubmissionControllerAdaptiveTimeout.set(1);
+    debugManager.flags.DirectSubmissionControllerAdaptiveTimeoutPercentile.set(150);
+    {
+        DirectSubmissionControllerMock controller;
+        EXPECT_TRUE(controller.adaptiveTimeout);
+        EXPECT_EQ(100u, controller.adaptiveTimeoutPercentile);
+    }
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveTimeoutWhenSubmissionGapsShorterThanMaxTimeoutAreRecordedThenTimeoutDropsAndRingIsStoppedAfterLearnedIdleTimeout) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerAdaptiveTimeout.set(1);
+    debugManager.flags.DirectSubmissionControllerMaxTimeout.set(5'000);
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.timeoutElapsedReturnValue.store(true);
+    controller.registerDirectSubmission(&csr);
+
+    auto submissionTimestamp = SteadyClock::now();
+    csr.directSubmissionGapRecorder.recordSubmission(submissionTimestamp);
+    csr.taskCount.store(1u);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(5'000, controller.timeout.count());
+
+    // submissions 200 us apart, controller checks them only once per its 5000 us timeout
+    constexpr uint32_t numSubmissions = DirectSubmissionController::adaptiveMinSamples + 2u;
+    for (uint32_t i = 0; i < numSubmissions; i++) {
+        submissionTimestamp += std::chrono::microseconds(200);
+        csr.directSubmissionGapRecorder.recordSubmission(submissionTimestamp);
+        csr.taskCount++;
+    }
+    controller.cpuTimestamp += std::chrono::microseconds(5'000);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(numSubmissions, controller.directSubmissions[&csr].idleState.gapHistogram.numSamples);
+    EXPECT_EQ(256, controller.directSubmissions[&csr].idleState.idleTimeout.count());
+    EXPECT_EQ(256, controller.timeout.count());
+
+    controller.cpuTimestamp += std::chrono::microseconds(200);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(0u, controller.getStatistics(&csr).stops);
+
+    controller.cpuTimestamp += std::chrono::microseconds(100);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    auto statistics = controller.getStatistics(&csr);
+    EXPECT_EQ(1u, statistics.stops);
+    EXPECT_EQ(0u, statistics.restarts);
+    EXPECT_EQ(5'300, statistics.timeRunning.count());
+    EXPECT_EQ(0, statistics.timeStopped.count());
+
+    controller.cpuTimestamp += std::chrono::microseconds(1'000);
+    csr.taskCount++;
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+
+    statistics = controller.getStatistics(&csr);
+    EXPECT_EQ(1u, statistics.stops);
+    EXPECT_EQ(1u, statistics.restarts);
+    EXPECT_EQ(1'000, statistics.timeStopped.count());
+
+    controller.unregisterDirectSubmission(&csr);
+    EXPECT_EQ(0u, controller.getStatistics(&csr).stops);
+}
+
+TEST(DirectSubmissionControllerTests, givenPrintStatisticsWhenUnregisterDirectSubmissionThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerPrintStatistics.set(true);
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.timeoutElapsedReturnValue.store(true);
+    controller.registerDirectSubmission(&csr);
+
+    csr.taskCount.store(1u);
+    controller.checkNewSubmissions();
+    controller.cpuTimestamp += std::chrono::microseconds(5'000);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    testing::internal::CaptureStdout();
+    controller.unregisterDirectSubmission(&csr);
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("Direct submission controller statistics"));
+    EXPECT_NE(std::string::npos, output.find("stops: 1, restarts: 0, time running: 5000 us"));
+}
+
 } // namespace NEO
\ No newline at end of file
@@ -180,6 +180,33 @@ HWTEST_F(DirectSubmissionTest, givenCsrWhenGetLastDirectSubmissionThrottleCalled
     csr.directSubmission.release();
 }
 
+HWTEST_F(DirectSubmissionTest, givenCsrWhenMovingDirectSubmissionGapSamplesThenSamplesRecordedByDirectSubmissionAreMoved) {
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.csrBaseCallDirectSubmissionAvailable = false;
+    ultHwConfig.csrBaseCallBlitterDirectSubmissionAvailable = false;
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.directSubmission.reset(&directSubmission);
+
+    auto submissionTimestamp = std::chrono::steady_clock::now();
+    directSubmission.getSubmissionGapRecorder().recordSubmission(submissionTimestamp);
+    directSubmission.getSubmissionGapRecorder().recordSubmission(submissionTimestamp + std::chrono::microseconds(200));
+
+    SubmissionGapHistogram histogram;
+    csr.directSubmissionAvailable = false;
+    csr.moveDirectSubmissionGapSamples(histogram);
+    EXPECT_EQ(0u, histogram.numSamples);
+
+    csr.directSubmissionAvailable = true;
+    csr.moveDirectSubmissionGapSamples(histogram);
+    EXPECT_EQ(1u, histogram.numSamples);
+    EXPECT_EQ(1u, histogram.buckets[8]);
+
+    csr.directSubmissionAvailable = false;
+    csr.directSubmission.release();
+}
+
 HWTEST_F(DirectSubmissionTest, givenBcsCsrWhenGetLastDirectSubmissionThrottleCalledThenDirectSubmissionLastSubmittedThrottleReturned) {
     VariableBackup<UltHwConfig> backup(&ultHwConfig);
     ultHwConfig.csrBaseCallDirectSubmissionAvailable = false;
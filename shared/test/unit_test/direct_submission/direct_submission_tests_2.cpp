@@ -283,6 +283,35 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, DirectSubmissionDispatchBufferTest,
     EXPECT_TRUE(foundFenceUpdate);
 }
 
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenAdaptiveControllerTimeoutWhenDispatchingCommandBuffersThenGapsBetweenDispatchesAreRecorded) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    FlushStampTracker flushStamp(true);
+    {
+        MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+        EXPECT_FALSE(directSubmission.recordSubmissionGaps);
+    }
+
+    debugManager.flags.DirectSubmissionControllerAdaptiveTimeout.set(1);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.recordSubmissionGaps);
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    SubmissionGapHistogram histogram;
+    directSubmission.getSubmissionGapRecorder().moveSamplesTo(histogram);
+    EXPECT_EQ(0u, histogram.numSamples);
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    directSubmission.getSubmissionGapRecorder().moveSamplesTo(histogram);
+    EXPECT_EQ(2u, histogram.numSamples);
+
+    directSubmission.getSubmissionGapRecorder().moveSamplesTo(histogram);
+    EXPECT_EQ(2u, histogram.numSamples);
+}
+
 HWTEST_F(DirectSubmissionDispatchBufferTest, givenCopyCommandBufferIntoRingWhenDispatchCommandBufferThenCopyTaskStream) {
     using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
     using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
@@ -787,6 +816,106 @@ HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionPrintBuffersWh
     EXPECT_TRUE(pos != std::string::npos);
 }
 
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionPreallocatedRingBuffersWhenInitializeThenAllRingBuffersAllocatedUpFrontAndNoneAllocatedOnSwitch) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionPreallocatedRingBuffers.set(4);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(4u, directSubmission.maxRingBufferCount);
+
+    bool ret = directSubmission.initialize(false, false);
+    EXPECT_TRUE(ret);
+    ASSERT_EQ(4u, directSubmission.ringBuffers.size());
+    for (auto &ringBufferUse : directSubmission.ringBuffers) {
+        EXPECT_NE(nullptr, ringBufferUse.ringBuffer);
+    }
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, directSubmission.ringCommandStream.getGraphicsAllocation());
+
+    directSubmission.isCompletedReturn = false;
+    for (uint32_t expectedRingBuffer : {1u, 2u, 3u, 0u, 1u}) {
+        auto nextRing = directSubmission.switchRingBuffersAllocations();
+        EXPECT_EQ(4u, directSubmission.ringBuffers.size());
+        EXPECT_EQ(directSubmission.ringBuffers[expectedRingBuffer].ringBuffer, nextRing);
+        EXPECT_EQ(expectedRingBuffer, directSubmission.currentRingBuffer);
+    }
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionPreallocatedRingBuffersBelowInitialCountWhenCreatingThenInitialRingBufferCountIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionPreallocatedRingBuffers.set(1);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(2u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(2u, directSubmission.maxRingBufferCount);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionPreallocatedRingBuffersAboveMaxRingBuffersWhenCreatingThenPreallocatedCountIsClampedToMaxRingBuffers) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionMaxRingBuffers.set(3);
+    debugManager.flags.DirectSubmissionPreallocatedRingBuffers.set(8);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(3u, directSubmission.maxRingBufferCount);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenCopyCommandBufferIntoRingWhenDispatchCommandBufferThenCopiedBytesAndSemaphoreWaitsAreCounted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionFlatRingBuffer.set(-1);
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.copyCommandBufferIntoRing(batchBuffer));
+
+    bool ret = directSubmission.initialize(true, false);
+    EXPECT_TRUE(ret);
+    auto semaphoreWaitsAfterInitialize = directSubmission.semaphoreWaits;
+    EXPECT_EQ(0u, directSubmission.bytesCopiedIntoRing);
+
+    batchBuffer.endCmdPtr = ptrOffset(batchBuffer.stream->getCpuBase(), 0x20);
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+
+    EXPECT_EQ(0x20u, directSubmission.bytesCopiedIntoRing);
+    EXPECT_LT(semaphoreWaitsAfterInitialize, directSubmission.semaphoreWaits);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenChainedCommandBufferWhenDispatchCommandBufferThenNoBytesAreCopiedIntoRing) {
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_FALSE(directSubmission.copyCommandBufferIntoRing(batchBuffer));
+
+    bool ret = directSubmission.initialize(true, false);
+    EXPECT_TRUE(ret);
+
+    ret = directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    EXPECT_TRUE(ret);
+
+    EXPECT_EQ(0u, directSubmission.bytesCopiedIntoRing);
+    EXPECT_NE(0u, directSubmission.semaphoreWaits);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionPrintStatisticsWhenDeallocatingResourcesThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionPrintStatistics.set(true);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+
+    bool ret = directSubmission.initialize(false, false);
+    EXPECT_TRUE(ret);
+    directSubmission.switchRingBuffers(nullptr);
+    EXPECT_EQ(1u, directSubmission.ringBufferSwitches);
+
+    testing::internal::CaptureStdout();
+    directSubmission.deallocateResources();
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("Direct submission statistics"));
+    EXPECT_NE(std::string::npos, output.find("ring buffers: 2, ring buffer switches: 1"));
+
+    debugManager.flags.DirectSubmissionPrintStatistics.set(false);
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, DirectSubmissionDispatchBufferTest,
             givenDirectSubmissionRingStartWhenMultiTileSupportedThenExpectMultiTileConfigSetAndWorkPartitionResident) {
     using MI_LOAD_REGISTER_IMM = typename FamilyType::MI_LOAD_REGISTER_IMM;
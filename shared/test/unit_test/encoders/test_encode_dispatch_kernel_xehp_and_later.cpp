@@ -627,6 +627,31 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInlineDataRequiredIsF
     EXPECT_EQ(expectedSizeIOH, heap->getUsed());
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInlineDataRequiredWhenEncodingWalkerThenOutCrossThreadDataPtrPointsToRemainderCopiedToIndirectHeap) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    dispatchInterface->kernelDescriptor.kernelAttributes.flags.passInlineData = true;
+    for (uint32_t i = 0; i < MockDispatchKernelEncoder::crossThreadSize; i++) {
+        dispatchInterface->dataCrossThread[i] = static_cast<uint8_t>(i + 1);
+    }
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+
+    ASSERT_NE(nullptr, dispatchArgs.outCrossThreadDataPtr);
+    auto heap = cmdContainer->getIndirectHeap(HeapType::indirectObject);
+    EXPECT_TRUE(dispatchArgs.outCrossThreadDataPtr >= heap->getCpuBase());
+    EXPECT_TRUE(dispatchArgs.outCrossThreadDataPtr < ptrOffset(heap->getCpuBase(), heap->getUsed()));
+
+    constexpr uint32_t inlineDataSize = DefaultWalkerType::getInlineDataSize();
+    if (inlineDataSize < MockDispatchKernelEncoder::crossThreadSize) {
+        EXPECT_EQ(0, memcmp(dispatchArgs.outCrossThreadDataPtr, &dispatchInterface->dataCrossThread[inlineDataSize], MockDispatchKernelEncoder::crossThreadSize - inlineDataSize));
+    }
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInlineDataRequiredAndZeroCrossThreadDataSizeWhenEncodingWalkerThenEmitInlineParameterIsNotSet) {
     using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
     uint32_t dims[] = {1, 1, 1};
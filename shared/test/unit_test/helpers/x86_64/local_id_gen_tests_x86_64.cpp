@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <vector>
+
+namespace NEO {
+struct uint16x8_t;
+struct uint16x16_t;
+struct uint16x32_t;
+} // namespace NEO
+
+using namespace NEO;
+
+using GenerateLocalIdsFunctionT = void (*)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
+
+struct LocalIdsSimdVariantsTest : public ::testing::Test {
+    void verifyVariantsMatch(GenerateLocalIdsFunctionT reference, GenerateLocalIdsFunctionT tested, uint16_t simd) {
+        const std::array<uint8_t, 3> dimensionsOrders[] = {{0, 1, 2}, {1, 0, 2}, {2, 1, 0}};
+        const std::array<uint16_t, 3> localWorkgroupSizes[] = {{1, 1, 1}, {7, 3, 1}, {16, 1, 1}, {31, 2, 3}, {32, 1, 1}, {33, 5, 1}, {100, 2, 2}, {1024, 1, 1}};
+
+        for (const auto &localWorkgroupSize : localWorkgroupSizes) {
+            const auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(simd, localWorkgroupSize[0] * localWorkgroupSize[1] * localWorkgroupSize[2]));
+            const size_t bufferSize = threadsPerWorkGroup * 3 * 32 * sizeof(uint16_t);
+            auto referenceBuffer = static_cast<uint8_t *>(alignedMalloc(bufferSize, 64));
+            auto testedBuffer = static_cast<uint8_t *>(alignedMalloc(bufferSize, 64));
+
+            for (const auto &dimensionsOrder : dimensionsOrders) {
+                for (const auto chooseMaxRowSize : {false, true}) {
+                    memset(referenceBuffer, 0, bufferSize);
+                    memset(testedBuffer, 0, bufferSize);
+                    reference(referenceBuffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, chooseMaxRowSize);
+                    tested(testedBuffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, chooseMaxRowSize);
+                    EXPECT_EQ(0, memcmp(referenceBuffer, testedBuffer, bufferSize));
+                }
+            }
+
+            alignedFree(referenceBuffer);
+            alignedFree(testedBuffer);
+        }
+    }
+};
+
+TEST_F(LocalIdsSimdVariantsTest, givenAvx2SupportedWhenGeneratingLocalIdsThenResultsMatchSse4Variant) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        GTEST_SKIP();
+    }
+    verifyVariantsMatch(generateLocalIDsSimd<uint16x8_t, 16>, generateLocalIDsSimd<uint16x16_t, 16>, 16);
+    verifyVariantsMatch(generateLocalIDsSimd<uint16x8_t, 32>, generateLocalIDsSimd<uint16x16_t, 32>, 32);
+}
+
+TEST_F(LocalIdsSimdVariantsTest, givenAvx512SupportedWhenGeneratingLocalIdsThenResultsMatchSse4Variant) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvx512)) {
+        GTEST_SKIP();
+    }
+    verifyVariantsMatch(generateLocalIDsSimd<uint16x8_t, 32>, generateLocalIDsSimd<uint16x32_t, 32>, 32);
+}
+
+TEST_F(LocalIdsSimdVariantsTest, givenAvx512SupportedWhenLocalIdHelperIsInitializedThenAvx512VariantIsUsedForSimd32) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvx512)) {
+        GTEST_SKIP();
+    }
+    EXPECT_EQ(static_cast<GenerateLocalIdsFunctionT>(generateLocalIDsSimd<uint16x32_t, 32>), LocalIDHelper::generateSimd32);
+}
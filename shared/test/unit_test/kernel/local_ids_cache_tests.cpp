@@ -21,9 +21,28 @@ class MockLocalIdsCache : public NEO::LocalIdsCache {
   public:
     using Base = NEO::LocalIdsCache;
     using Base::Base;
+    using Base::accessClock;
+    using Base::activeReaders;
     using Base::cache;
+    using Base::retiredEntries;
     MockLocalIdsCache(size_t cacheSize) : MockLocalIdsCache(cacheSize, 32u){};
     MockLocalIdsCache(size_t cacheSize, uint8_t simd) : Base(cacheSize, {0, 1, 2}, GrfConfig::defaultGrfNumber, simd, 32, false){};
+
+    LocalIdsCacheEntry *setEntry(size_t slotIndex, const Vec3<uint16_t> &groupSize, size_t localIdsSize, uint64_t lastAccess) {
+        auto entry = new LocalIdsCacheEntry;
+        entry->groupSize = groupSize;
+        entry->localIdsData = static_cast<uint8_t *>(alignedMalloc(localIdsSize, 32));
+        entry->localIdsSize = localIdsSize;
+        entry->localIdsSizeAllocated = localIdsSize;
+        delete cache[slotIndex].entry.exchange(entry);
+        cache[slotIndex].lastAccess = lastAccess;
+        accessClock = std::max(accessClock.load(), lastAccess);
+        return entry;
+    }
+
+    LocalIdsCacheEntry *getEntry(size_t slotIndex) {
+        return cache[slotIndex].entry.load();
+    }
 };
 struct LocalIdsCacheFixture {
     void setUp() {
@@ -37,48 +56,120 @@ struct LocalIdsCacheFixture {
 };
 
 using LocalIdsCacheTests = Test<LocalIdsCacheFixture>;
-TEST_F(LocalIdsCacheTests, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoLeastUsedEntry) {
-    localIdsCache->cache.resize(2);
-    localIdsCache->cache[0].accessCounter = 2U;
+TEST_F(LocalIdsCacheTests, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoLeastRecentlyUsedSlot) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
+    localIdsCache->setEntry(0, {4, 1, 1}, 512U, 2U);
+    localIdsCache->setEntry(1, {2, 1, 1}, 512U, 1U);
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
 
-    EXPECT_EQ(groupSize, localIdsCache->cache[1].groupSize);
-    EXPECT_NE(nullptr, localIdsCache->cache[1].localIdsData);
-    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSize);
-    EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSizeAllocated);
-    EXPECT_EQ(1U, localIdsCache->cache[1].accessCounter);
+    auto entry = localIdsCache->getEntry(1);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(groupSize, entry->groupSize);
+    EXPECT_NE(nullptr, entry->localIdsData);
+    EXPECT_EQ(1536U, entry->localIdsSize);
+    EXPECT_EQ(1536U, entry->localIdsSizeAllocated);
+    EXPECT_LT(2U, localIdsCache->cache[1].lastAccess.load());
+    EXPECT_EQ(Vec3<uint16_t>(4, 1, 1), localIdsCache->getEntry(0)->groupSize);
 }
 
-TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFromCacheIsUsed) {
-    localIdsCache->cache[0].groupSize = groupSize;
-    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
-    localIdsCache->cache[0].localIdsSize = 512U;
-    localIdsCache->cache[0].localIdsSizeAllocated = 512U;
-    localIdsCache->cache[0].accessCounter = 1U;
+TEST_F(LocalIdsCacheTests, GivenEmptySlotWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoEmptySlot) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
+    localIdsCache->setEntry(1, {4, 1, 1}, 512U, 1U);
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
-    EXPECT_EQ(2U, localIdsCache->cache[0].accessCounter);
+
+    ASSERT_NE(nullptr, localIdsCache->getEntry(0));
+    EXPECT_EQ(groupSize, localIdsCache->getEntry(0)->groupSize);
+    EXPECT_EQ(Vec3<uint16_t>(4, 1, 1), localIdsCache->getEntry(1)->groupSize);
+}
+
+TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFromCacheIsUsedAndMarkedAsRecentlyUsed) {
+    auto entry = localIdsCache->setEntry(0, groupSize, 512U, 1U);
+    memset(entry->localIdsData, 0xab, 512U);
+
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_EQ(entry, localIdsCache->getEntry(0));
+    EXPECT_EQ(0xab, perThreadData[0]);
+    EXPECT_EQ(0xab, perThreadData[511]);
+    EXPECT_EQ(0, perThreadData[512]);
+    auto lastAccess = localIdsCache->cache[0].lastAccess.load();
+
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_EQ(entry, localIdsCache->getEntry(0));
+    EXPECT_LT(lastAccess, localIdsCache->cache[0].lastAccess.load());
 }
 
 TEST_F(LocalIdsCacheTests, GivenEntryWithBiggerBufferAllocatedWhenGetLocalIdsForGroupThenBufferIsReused) {
-    localIdsCache->cache[0].groupSize = {4, 1, 1};
-    localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
-    localIdsCache->cache[0].localIdsSize = 512U;
-    localIdsCache->cache[0].localIdsSizeAllocated = 512U;
-    localIdsCache->cache[0].accessCounter = 2U;
-    const auto localIdsData = localIdsCache->cache[0].localIdsData;
+    auto entry = localIdsCache->setEntry(0, {4, 1, 1}, 512U, 2U);
+    const auto localIdsData = entry->localIdsData;
 
     groupSize = {2, 1, 1};
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
-    EXPECT_EQ(1U, localIdsCache->cache[0].accessCounter);
-    EXPECT_EQ(192U, localIdsCache->cache[0].localIdsSize);
-    EXPECT_EQ(512U, localIdsCache->cache[0].localIdsSizeAllocated);
-    EXPECT_EQ(localIdsData, localIdsCache->cache[0].localIdsData);
+    entry = localIdsCache->getEntry(0);
+    EXPECT_EQ(groupSize, entry->groupSize);
+    EXPECT_EQ(192U, entry->localIdsSize);
+    EXPECT_EQ(512U, entry->localIdsSizeAllocated);
+    EXPECT_EQ(localIdsData, entry->localIdsData);
+    EXPECT_TRUE(localIdsCache->retiredEntries.empty());
+}
+
+TEST_F(LocalIdsCacheTests, GivenActiveReaderWhenEntryIsEvictedThenEvictedEntryIsRetiredUntilNoReaderIsActive) {
+    auto evictedEntry = localIdsCache->setEntry(0, {4, 1, 1}, 512U, 2U);
+
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    localIdsCache->activeReaders = 1u;
+    localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_NE(evictedEntry, localIdsCache->getEntry(0));
+    EXPECT_EQ(groupSize, localIdsCache->getEntry(0)->groupSize);
+    ASSERT_EQ(1u, localIdsCache->retiredEntries.size());
+    EXPECT_EQ(evictedEntry, localIdsCache->retiredEntries[0].get());
+    EXPECT_EQ(1u, localIdsCache->activeReaders.load());
+
+    localIdsCache->activeReaders = 0u;
+    localIdsCache->setLocalIdsForGroup({2, 1, 1}, perThreadData.data(), rootDeviceEnvironment);
+    EXPECT_EQ(Vec3<uint16_t>(2, 1, 1), localIdsCache->getEntry(0)->groupSize);
+    EXPECT_TRUE(localIdsCache->retiredEntries.empty());
+}
+
+TEST_F(LocalIdsCacheTests, GivenMultipleGroupSizesWithinCacheSizeWhenSettingLocalIdsRepeatedlyThenEachGroupSizeIsGeneratedOnce) {
+    localIdsCache = std::make_unique<MockLocalIdsCache>(3);
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+
+    const Vec3<uint16_t> groupSizes[] = {{8, 1, 1}, {4, 4, 1}, {2, 2, 2}};
+    for (const auto &group : groupSizes) {
+        localIdsCache->setLocalIdsForGroup(group, perThreadData.data(), rootDeviceEnvironment);
+    }
+    MockLocalIdsCache::LocalIdsCacheEntry *entries[] = {localIdsCache->getEntry(0), localIdsCache->getEntry(1), localIdsCache->getEntry(2)};
+
+    for (uint32_t i = 0; i < 4; i++) {
+        for (const auto &group : groupSizes) {
+            localIdsCache->setLocalIdsForGroup(group, perThreadData.data(), rootDeviceEnvironment);
+        }
+    }
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_EQ(entries[i], localIdsCache->getEntry(i));
+        EXPECT_EQ(groupSizes[i], entries[i]->groupSize);
+    }
+}
+
+TEST(LocalIdsCacheTest, givenCacheSizeWhenCreatingCacheThenRequestedNumberOfEmptySlotsIsCreated) {
+    auto localIdsCache = std::make_unique<MockLocalIdsCache>(MockLocalIdsCache::defaultCacheSize);
+    EXPECT_EQ(MockLocalIdsCache::defaultCacheSize, localIdsCache->getCacheSize());
+
+    localIdsCache = std::make_unique<MockLocalIdsCache>(64u);
+    EXPECT_EQ(64u, localIdsCache->getCacheSize());
+    for (size_t i = 0; i < 64u; i++) {
+        EXPECT_EQ(nullptr, localIdsCache->getEntry(i));
+    }
 }
 
 TEST_F(LocalIdsCacheTests, GivenValidLocalIdsCacheWhenGettingLocalIdsSizePerThreadThenCorrectValueIsReturned) {
@@ -10,6 +10,8 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_gfx_partition.h"
 
@@ -428,6 +430,38 @@ TEST(GfxPartitionTest, givenInternalHeapWhenAllocatingSmallOrBigChunkThenAddress
     }
 }
 
+TEST(GfxPartitionTest, givenSegregatedFitHeapsMaskSetWhenGfxPartitionIsCreatedThenOnlySelectedHeapsUseSegregatedFitAllocator) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SegregatedFitHeapAllocatorHeapsMask.set((1 << static_cast<uint32_t>(HeapIndex::heapStandard)) |
+                                                               (1 << static_cast<uint32_t>(HeapIndex::heapInternalFrontWindow)));
+
+    MockGfxPartition gfxPartition;
+    for (auto heapIndex : MockGfxPartition::allHeapNames) {
+        auto expectedMode = (heapIndex == HeapIndex::heapStandard || heapIndex == HeapIndex::heapInternalFrontWindow) ? HeapAllocatorMode::segregatedFit : HeapAllocatorMode::linearFreeLists;
+        EXPECT_EQ(expectedMode, gfxPartition.getHeapAllocatorMode(heapIndex));
+    }
+
+    uint64_t gfxTop = maxNBitValue(48) + 1;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u, gfxTop);
+
+    size_t sizeToAlloc = MemoryConstants::pageSize64k;
+    auto address = gfxPartition.heapAllocate(HeapIndex::heapInternalFrontWindow, sizeToAlloc);
+    EXPECT_EQ(gfxPartition.getHeapBase(HeapIndex::heapInternalFrontWindow), address);
+    gfxPartition.heapFree(HeapIndex::heapInternalFrontWindow, address, sizeToAlloc);
+
+    sizeToAlloc = MemoryConstants::pageSize64k;
+    address = gfxPartition.heapAllocate(HeapIndex::heapStandard, sizeToAlloc);
+    EXPECT_EQ(gfxPartition.getHeapLimit(HeapIndex::heapStandard) + 1 - sizeToAlloc - GfxPartition::heapGranularity, address);
+    gfxPartition.heapFree(HeapIndex::heapStandard, address, sizeToAlloc);
+}
+
+TEST(GfxPartitionTest, givenDefaultSettingsWhenGfxPartitionIsCreatedThenAllHeapsUseLinearFreeListsAllocator) {
+    MockGfxPartition gfxPartition;
+    for (auto heapIndex : MockGfxPartition::allHeapNames) {
+        EXPECT_EQ(HeapAllocatorMode::linearFreeLists, gfxPartition.getHeapAllocatorMode(heapIndex));
+    }
+}
+
 using GfxPartitionTestForAllHeapTypes = ::testing::TestWithParam<HeapIndex>;
 
 TEST_P(GfxPartitionTestForAllHeapTypes, givenHeapIndexWhenFreeGpuAddressRangeIsCalledThenFreeMemory) {
@@ -550,6 +550,141 @@ TEST_F(SvmDeviceAllocationCacheTest, givenAllocationWithIsInternalAllocationSetW
     svmManager->trimUSMDeviceAllocCache();
 }
 
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenAllocatingAndFreeingThenHitsMissesAndBytesHeldAreReported) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    svmManager->usmDeviceAllocationsCache.maxSize = 1 * MemoryConstants::gigaByte;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, allocation);
+
+    auto stats = svmManager->getUSMDeviceAllocCacheStats();
+    EXPECT_EQ(0u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(0u, stats.evictions);
+    EXPECT_EQ(0u, stats.bytesHeld);
+    EXPECT_EQ(1 * MemoryConstants::gigaByte, stats.maxSize);
+
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(MemoryConstants::pageSize64k, svmManager->getUSMDeviceAllocCacheStats().bytesHeld);
+
+    auto allocationFromCache = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_EQ(allocation, allocationFromCache);
+    stats = svmManager->getUSMDeviceAllocCacheStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(0u, stats.bytesHeld);
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->trimUSMDeviceAllocCache();
+    stats = svmManager->getUSMDeviceAllocCacheStats();
+    EXPECT_EQ(1u, stats.evictions);
+    EXPECT_EQ(0u, stats.bytesHeld);
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheBudgetDebugFlagWhenInitializingCacheThenMaxSizeIsSetToBudget) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    debugManager.flags.ExperimentalDeviceAllocationCacheBudget.set(32);
+    debugManager.flags.ExperimentalHostAllocationCacheBudget.set(16);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    svmManager->initUsmAllocationsCaches(*device);
+
+    EXPECT_EQ(32 * MemoryConstants::megaByte, svmManager->usmDeviceAllocationsCache.maxSize);
+    EXPECT_EQ(16 * MemoryConstants::megaByte, svmManager->usmHostAllocationsCache.maxSize);
+    EXPECT_EQ(svmManager.get(), svmManager->usmDeviceAllocationsCache.svmAllocsManager);
+    EXPECT_EQ(svmManager.get(), svmManager->usmHostAllocationsCache.svmAllocsManager);
+}
+
+TEST(SvmAllocationCacheSizeClassTest, whenGettingSizeClassEndThenNextPowerOfTwoNotSmallerThan64KBIsReturned) {
+    EXPECT_EQ(MemoryConstants::pageSize64k, SVMAllocsManager::SvmAllocationCache::getSizeClassEnd(1u));
+    EXPECT_EQ(MemoryConstants::pageSize64k, SVMAllocsManager::SvmAllocationCache::getSizeClassEnd(MemoryConstants::pageSize64k));
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, SVMAllocsManager::SvmAllocationCache::getSizeClassEnd(MemoryConstants::pageSize64k + 1));
+    EXPECT_EQ(MemoryConstants::pageSize2M, SVMAllocsManager::SvmAllocationCache::getSizeClassEnd(MemoryConstants::pageSize2M - 1));
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenSizeClassesEnabledWhenAllocatingAfterFreeThenOnlyAllocationFromSameSizeClassIsReused) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalUsmAllocationCacheSizeClasses.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.sizeClassesEnabled);
+    svmManager->usmDeviceAllocationsCache.maxSize = 1 * MemoryConstants::gigaByte;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto bigAllocation = svmManager->createUnifiedMemoryAllocation(4 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, bigAllocation);
+    svmManager->freeSVMAlloc(bigAllocation);
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
+
+    auto smallAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_NE(bigAllocation, smallAllocation);
+    EXPECT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
+
+    auto sameClassAllocation = svmManager->createUnifiedMemoryAllocation(3 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_EQ(bigAllocation, sameClassAllocation);
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.allocations.size());
+
+    svmManager->freeSVMAlloc(smallAllocation);
+    svmManager->freeSVMAlloc(sameClassAllocation);
+    svmManager->trimUSMDeviceAllocCache();
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationsSavedAtDifferentTimesWhenTrimmingOldAllocationsThenOnlyExpiredAllocationsAreReleased) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    svmManager->usmDeviceAllocationsCache.maxSize = 1 * MemoryConstants::gigaByte;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto oldAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto newAllocation = svmManager->createUnifiedMemoryAllocation(2 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(oldAllocation);
+    svmManager->freeSVMAlloc(newAllocation);
+    ASSERT_EQ(2u, svmManager->usmDeviceAllocationsCache.allocations.size());
+
+    const auto now = std::chrono::steady_clock::now();
+    svmManager->usmDeviceAllocationsCache.allocations[0].saveTime = now - std::chrono::seconds(10);
+    svmManager->usmDeviceAllocationsCache.allocations[1].saveTime = now;
+
+    svmManager->usmDeviceAllocationsCache.trimOldAllocs(now - std::chrono::seconds(1));
+    ASSERT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
+    EXPECT_EQ(newAllocation, svmManager->usmDeviceAllocationsCache.allocations[0].allocation);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(oldAllocation));
+
+    auto stats = svmManager->getUSMDeviceAllocCacheStats();
+    EXPECT_EQ(1u, stats.evictions);
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, stats.bytesHeld);
+
+    svmManager->trimUSMDeviceAllocCache();
+}
+
 using SvmHostAllocationCacheTest = Test<SvmAllocationCacheTestFixture>;
 
 TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheDisabledWhenCheckingIfEnabledThenItIsDisabled) {
@@ -38,6 +38,101 @@ TEST(SvmDeviceAllocationTest, givenGivenSvmAllocsManagerWhenObtainOwnershipCalle
     th2.join();
 }
 
+TEST(SvmDeviceAllocationTest, givenLockFreeSvmAllocLookupDebugFlagWhenCreatingSvmAllocsManagerThenLockFreeLookupIsEnabledAccordingly) {
+    DebugManagerStateRestore restore;
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+
+    EXPECT_FALSE(std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false)->lockFreeLookupEnabled);
+
+    debugManager.flags.EnableLockFreeSvmAllocLookup.set(0);
+    EXPECT_FALSE(std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false)->lockFreeLookupEnabled);
+
+    debugManager.flags.EnableLockFreeSvmAllocLookup.set(1);
+    EXPECT_TRUE(std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false)->lockFreeLookupEnabled);
+}
+
+TEST(SvmDeviceAllocationTest, givenLockFreeSvmAllocLookupEnabledWhenAllocatingAndFreeingUsmThenLookupIndexIsKeptInSyncWithTracker) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableLockFreeSvmAllocLookup.set(1);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    RootDeviceIndicesContainer rootDeviceIndices = {device->getRootDeviceIndex()};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{device->getRootDeviceIndex(), device->getDeviceBitfield()}};
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+
+    auto ptr = svmManager->createHostUnifiedMemoryAllocation(4096u, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr);
+    auto ptr2 = svmManager->createHostUnifiedMemoryAllocation(4096u, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr2);
+    EXPECT_EQ(2u, svmManager->svmAllocsLookupIndex.getNumEntries());
+
+    auto svmData = svmManager->getSVMAlloc(ptrOffset(ptr, 100u));
+    ASSERT_NE(nullptr, svmData);
+    EXPECT_EQ(svmManager->svmAllocs.get(ptr), svmData);
+    EXPECT_EQ(svmManager->svmAllocs.get(ptr2), svmManager->getSVMAlloc(ptr2));
+
+    svmManager->freeSVMAlloc(ptr);
+    EXPECT_EQ(1u, svmManager->svmAllocsLookupIndex.getNumEntries());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr));
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr2));
+
+    svmManager->freeSVMAlloc(ptr2);
+    EXPECT_EQ(0u, svmManager->svmAllocsLookupIndex.getNumEntries());
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST(SvmDeviceAllocationTest, givenLockFreeSvmAllocLookupEnabledWhenManyThreadsLookUpAllocationsConcurrentlyWithAllocationsThenEveryLookupSucceeds) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableLockFreeSvmAllocLookup.set(1);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    RootDeviceIndicesContainer rootDeviceIndices = {device->getRootDeviceIndex()};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{device->getRootDeviceIndex(), device->getDeviceBitfield()}};
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+
+    constexpr size_t allocationSize = 4096u;
+    std::vector<void *> ptrs;
+    for (uint32_t i = 0; i < 64u; i++) {
+        ptrs.push_back(svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties));
+        ASSERT_NE(nullptr, ptrs.back());
+    }
+
+    std::atomic<uint32_t> failedLookups{0u};
+    std::vector<std::thread> readers;
+    for (uint32_t reader = 0; reader < 8u; reader++) {
+        readers.emplace_back([&, reader]() {
+            for (uint32_t i = 0; i < 10000u; i++) {
+                auto ptr = ptrs[(i + reader) % ptrs.size()];
+                auto svmData = svmManager->getSVMAlloc(ptrOffset(ptr, i % allocationSize));
+                if (svmData == nullptr || reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()) != ptr) {
+                    failedLookups++;
+                }
+            }
+        });
+    }
+
+    for (uint32_t i = 0; i < 32u; i++) {
+        auto transientPtr = svmManager->createHostUnifiedMemoryAllocation(allocationSize, unifiedMemoryProperties);
+        EXPECT_NE(nullptr, transientPtr);
+        svmManager->freeSVMAlloc(transientPtr);
+    }
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(0u, failedLookups);
+
+    for (auto ptr : ptrs) {
+        svmManager->freeSVMAlloc(ptr);
+    }
+    EXPECT_EQ(0u, svmManager->svmAllocsLookupIndex.getNumEntries());
+}
+
 using SVMLocalMemoryAllocatorTest = Test<SVMMemoryAllocatorFixture<true>>;
 TEST_F(SVMLocalMemoryAllocatorTest, whenFreeSharedAllocWithOffsetPointerThenResourceIsRemovedProperly) {
     DebugManagerStateRestore restore;
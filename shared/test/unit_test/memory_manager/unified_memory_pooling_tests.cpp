@@ -235,3 +235,256 @@ TEST_F(InitializationFailedUnifiedMemoryPoolingTest, givenNotInitializedPoolWhen
     EXPECT_EQ(nullptr, usmMemAllocPool.getPooledAllocationBasePtr(bogusPtr));
     EXPECT_EQ(0u, usmMemAllocPool.getOffsetInPool(bogusPtr));
 }
+
+TEST_F(InitializedHostUnifiedMemoryPoolingTest, givenPoolInitializedWithServicedSizeRangeWhenCallingCanBePooledThenOnlySizesInRangeArePooled) {
+    MockUsmMemAllocPool rangedPool;
+    ASSERT_TRUE(rangedPool.initialize(svmManager.get(), *poolMemoryProperties.get(), poolSize, 4 * MemoryConstants::kiloByte + 1, 64 * MemoryConstants::kiloByte));
+    EXPECT_EQ(HeapAllocatorMode::segregatedFit, rangedPool.chunkAllocator->getMode());
+    EXPECT_EQ(HeapAllocatorMode::linearFreeLists, usmMemAllocPool.chunkAllocator->getMode());
+
+    SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize64k, rootDeviceIndices, deviceBitfields);
+    EXPECT_FALSE(rangedPool.canBePooled(4 * MemoryConstants::kiloByte, memoryProperties));
+    EXPECT_TRUE(rangedPool.canBePooled(4 * MemoryConstants::kiloByte + 1, memoryProperties));
+    EXPECT_TRUE(rangedPool.canBePooled(64 * MemoryConstants::kiloByte, memoryProperties));
+    EXPECT_FALSE(rangedPool.canBePooled(64 * MemoryConstants::kiloByte + 1, memoryProperties));
+
+    EXPECT_TRUE(rangedPool.isEmpty());
+    auto allocFromPool = rangedPool.createUnifiedMemoryAllocation(64 * MemoryConstants::kiloByte, memoryProperties);
+    EXPECT_NE(nullptr, allocFromPool);
+    EXPECT_FALSE(rangedPool.isEmpty());
+    EXPECT_TRUE(rangedPool.freeSVMAlloc(allocFromPool, true));
+    EXPECT_TRUE(rangedPool.isEmpty());
+
+    rangedPool.cleanup();
+    EXPECT_EQ(0u, rangedPool.minServicedSize);
+    EXPECT_EQ(0u, rangedPool.maxServicedSize);
+}
+
+class UnifiedMemoryPoolsManagerTest : public UnifiedMemoryPoolingTest {
+  public:
+    void SetUp() override {
+        UnifiedMemoryPoolingTest::setUp();
+        deviceFactory = std::unique_ptr<UltDeviceFactory>(new UltDeviceFactory(1, 1));
+        device = deviceFactory->rootDevices[0];
+        svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+        poolMemoryProperties = std::make_unique<SVMAllocsManager::UnifiedMemoryProperties>(InternalMemoryType::deviceUnifiedMemory, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitfields);
+        poolMemoryProperties->device = device;
+        ASSERT_TRUE(poolsManager.initialize(svmManager.get(), *poolMemoryProperties.get(), maxPoolsSize));
+    }
+    void TearDown() override {
+        poolsManager.cleanup();
+        UnifiedMemoryPoolingTest::tearDown();
+    }
+
+    SVMAllocsManager::UnifiedMemoryProperties createMemoryProperties() {
+        SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::deviceUnifiedMemory, MemoryConstants::pageSize64k, rootDeviceIndices, deviceBitfields);
+        memoryProperties.device = device;
+        return memoryProperties;
+    }
+
+    const size_t maxPoolsSize = 32 * MemoryConstants::megaByte;
+    MockUsmMemAllocPoolsManager poolsManager;
+    std::unique_ptr<UltDeviceFactory> deviceFactory;
+    Device *device;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+    std::unique_ptr<SVMAllocsManager::UnifiedMemoryProperties> poolMemoryProperties;
+};
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenPoolsManagerWhenInitializingThenNoPoolIsCreatedUntilFirstAllocation) {
+    MockUsmMemAllocPoolsManager notInitializedPoolsManager;
+    EXPECT_FALSE(notInitializedPoolsManager.isInitialized());
+    EXPECT_FALSE(notInitializedPoolsManager.initialize(nullptr, *poolMemoryProperties.get(), maxPoolsSize));
+    EXPECT_FALSE(notInitializedPoolsManager.initialize(svmManager.get(), *poolMemoryProperties.get(), 0u));
+    auto memoryProperties = createMemoryProperties();
+    EXPECT_FALSE(notInitializedPoolsManager.canBePooled(1u, memoryProperties));
+    EXPECT_EQ(nullptr, notInitializedPoolsManager.createUnifiedMemoryAllocation(1u, memoryProperties));
+
+    EXPECT_TRUE(poolsManager.isInitialized());
+    EXPECT_EQ(maxPoolsSize, poolsManager.maxPoolsSize);
+    EXPECT_EQ(0u, poolsManager.getPoolsCount());
+    EXPECT_EQ(0u, poolsManager.getPoolsSize());
+
+    poolsManager.cleanup();
+    EXPECT_FALSE(poolsManager.isInitialized());
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenDifferentAllocationPropertiesWhenCallingCanBePooledThenCorrectValueIsReturned) {
+    auto memoryProperties = createMemoryProperties();
+    EXPECT_TRUE(poolsManager.canBePooled(1u, memoryProperties));
+    EXPECT_TRUE(poolsManager.canBePooled(UsmMemAllocPool::allocationThreshold, memoryProperties));
+    EXPECT_FALSE(poolsManager.canBePooled(UsmMemAllocPool::allocationThreshold + 1, memoryProperties));
+
+    memoryProperties.alignment = UsmMemAllocPool::chunkAlignment / 2;
+    EXPECT_FALSE(poolsManager.canBePooled(1u, memoryProperties));
+    memoryProperties.alignment = MemoryConstants::pageSize64k;
+
+    memoryProperties.memoryType = InternalMemoryType::hostUnifiedMemory;
+    EXPECT_FALSE(poolsManager.canBePooled(1u, memoryProperties));
+    memoryProperties.memoryType = InternalMemoryType::deviceUnifiedMemory;
+
+    memoryProperties.device = nullptr;
+    EXPECT_FALSE(poolsManager.canBePooled(1u, memoryProperties));
+    memoryProperties.device = device;
+
+    memoryProperties.allocationFlags.allFlags = 1u;
+    EXPECT_FALSE(poolsManager.canBePooled(1u, memoryProperties));
+    memoryProperties.allocationFlags.allFlags = 0u;
+    memoryProperties.allocationFlags.allAllocFlags = 1u;
+    EXPECT_FALSE(poolsManager.canBePooled(1u, memoryProperties));
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenAllocationSizesWhenGettingSizeClassIndexThenSmallestFittingClassIsReturned) {
+    EXPECT_EQ(0u, MockUsmMemAllocPoolsManager::getSizeClassIndex(1u));
+    EXPECT_EQ(0u, MockUsmMemAllocPoolsManager::getSizeClassIndex(4 * MemoryConstants::kiloByte));
+    EXPECT_EQ(1u, MockUsmMemAllocPoolsManager::getSizeClassIndex(4 * MemoryConstants::kiloByte + 1));
+    EXPECT_EQ(1u, MockUsmMemAllocPoolsManager::getSizeClassIndex(64 * MemoryConstants::kiloByte));
+    EXPECT_EQ(2u, MockUsmMemAllocPoolsManager::getSizeClassIndex(64 * MemoryConstants::kiloByte + 1));
+    EXPECT_EQ(2u, MockUsmMemAllocPoolsManager::getSizeClassIndex(UsmMemAllocPool::allocationThreshold));
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenAllocationsOfDifferentSizeClassesWhenAllocatingThenEachClassIsServedBySeparatePool) {
+    auto memoryProperties = createMemoryProperties();
+    std::array<size_t, 3> allocationSizes = {256u, 16 * MemoryConstants::kiloByte, 512 * MemoryConstants::kiloByte};
+
+    std::array<void *, 3> allocations = {};
+    for (auto i = 0u; i < allocationSizes.size(); i++) {
+        allocations[i] = poolsManager.createUnifiedMemoryAllocation(allocationSizes[i], memoryProperties);
+        ASSERT_NE(nullptr, allocations[i]);
+        ASSERT_EQ(1u, poolsManager.pools[i].size());
+        EXPECT_TRUE(poolsManager.pools[i][0]->isInPool(allocations[i]));
+        EXPECT_EQ(MockUsmMemAllocPoolsManager::sizeClasses[i].poolSize, poolsManager.pools[i][0]->getPoolSize());
+    }
+    EXPECT_EQ(3u, poolsManager.getPoolsCount());
+    EXPECT_EQ(2 * MemoryConstants::megaByte + 4 * MemoryConstants::megaByte + 16 * MemoryConstants::megaByte, poolsManager.getPoolsSize());
+
+    for (auto i = 0u; i < allocationSizes.size(); i++) {
+        EXPECT_TRUE(poolsManager.isInPool(allocations[i]));
+        EXPECT_EQ(allocationSizes[i], poolsManager.getPooledAllocationSize(allocations[i]));
+        EXPECT_EQ(allocations[i], poolsManager.getPooledAllocationBasePtr(ptrOffset(allocations[i], allocationSizes[i] - 1)));
+        EXPECT_EQ(poolsManager.pools[i][0]->getOffsetInPool(allocations[i]), poolsManager.getOffsetInPool(allocations[i]));
+        EXPECT_TRUE(poolsManager.freeSVMAlloc(allocations[i], true));
+        EXPECT_FALSE(poolsManager.freeSVMAlloc(allocations[i], true));
+    }
+
+    const auto bogusPtr = reinterpret_cast<void *>(0x1);
+    EXPECT_FALSE(poolsManager.isInPool(bogusPtr));
+    EXPECT_FALSE(poolsManager.freeSVMAlloc(bogusPtr, true));
+    EXPECT_EQ(0u, poolsManager.getPooledAllocationSize(bogusPtr));
+    EXPECT_EQ(nullptr, poolsManager.getPooledAllocationBasePtr(bogusPtr));
+    EXPECT_EQ(0u, poolsManager.getOffsetInPool(bogusPtr));
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenFullPoolWhenAllocatingThenNewPoolIsAddedUntilSizeLimitIsReached) {
+    auto memoryProperties = createMemoryProperties();
+    const auto allocationSize = UsmMemAllocPool::allocationThreshold;
+    const auto allocationsPerPool = MockUsmMemAllocPoolsManager::sizeClasses[2].poolSize / allocationSize;
+
+    std::vector<void *> allocations;
+    for (auto i = 0u; i < 2 * allocationsPerPool; i++) {
+        auto allocation = poolsManager.createUnifiedMemoryAllocation(allocationSize, memoryProperties);
+        ASSERT_NE(nullptr, allocation);
+        allocations.push_back(allocation);
+    }
+    EXPECT_EQ(2u, poolsManager.pools[2].size());
+    EXPECT_EQ(maxPoolsSize, poolsManager.getPoolsSize());
+
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(allocationSize, memoryProperties));
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(1u, memoryProperties));
+    EXPECT_EQ(2u, poolsManager.getPoolsCount());
+
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(allocations.back(), true));
+    allocations.pop_back();
+    EXPECT_NE(nullptr, poolsManager.createUnifiedMemoryAllocation(allocationSize, memoryProperties));
+    EXPECT_EQ(2u, poolsManager.getPoolsCount());
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenEmptyPoolsWhenTrimmingThenOnlyEmptyPoolsAreReleased) {
+    auto memoryProperties = createMemoryProperties();
+    auto smallAllocation = poolsManager.createUnifiedMemoryAllocation(256u, memoryProperties);
+    auto mediumAllocation = poolsManager.createUnifiedMemoryAllocation(16 * MemoryConstants::kiloByte, memoryProperties);
+    ASSERT_NE(nullptr, smallAllocation);
+    ASSERT_NE(nullptr, mediumAllocation);
+    EXPECT_EQ(2u, poolsManager.getPoolsCount());
+
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(smallAllocation, true));
+    poolsManager.trim();
+    EXPECT_EQ(1u, poolsManager.getPoolsCount());
+    EXPECT_EQ(0u, poolsManager.pools[0].size());
+    EXPECT_EQ(1u, poolsManager.pools[1].size());
+    EXPECT_EQ(MockUsmMemAllocPoolsManager::sizeClasses[1].poolSize, poolsManager.getPoolsSize());
+    EXPECT_EQ(16 * MemoryConstants::kiloByte, poolsManager.getPooledAllocationSize(mediumAllocation));
+
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(mediumAllocation, true));
+    poolsManager.trim();
+    EXPECT_EQ(0u, poolsManager.getPoolsCount());
+    EXPECT_EQ(0u, poolsManager.getPoolsSize());
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenPoolsOfDifferentSizeClassesWhenTrimmingThenPointersAreLookedUpOnlyInRemainingPools) {
+    auto memoryProperties = createMemoryProperties();
+    auto smallAllocation = poolsManager.createUnifiedMemoryAllocation(256u, memoryProperties);
+    auto mediumAllocation = poolsManager.createUnifiedMemoryAllocation(16 * MemoryConstants::kiloByte, memoryProperties);
+    auto largeAllocation = poolsManager.createUnifiedMemoryAllocation(512 * MemoryConstants::kiloByte, memoryProperties);
+    ASSERT_NE(nullptr, smallAllocation);
+    ASSERT_NE(nullptr, mediumAllocation);
+    ASSERT_NE(nullptr, largeAllocation);
+    EXPECT_EQ(3u, poolsManager.poolsByAddress.size());
+    for (auto &sizeClassPools : poolsManager.pools) {
+        for (auto &pool : sizeClassPools) {
+            EXPECT_EQ(pool.get(), poolsManager.poolsByAddress[pool->getPoolAddress()]);
+        }
+    }
+    auto mediumPoolAddress = poolsManager.pools[1][0]->getPoolAddress();
+
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(mediumAllocation, true));
+    poolsManager.trim();
+    EXPECT_EQ(2u, poolsManager.poolsByAddress.size());
+    EXPECT_FALSE(poolsManager.isInPool(mediumPoolAddress));
+    EXPECT_FALSE(poolsManager.isInPool(mediumAllocation));
+    EXPECT_TRUE(poolsManager.isInPool(smallAllocation));
+    EXPECT_TRUE(poolsManager.isInPool(largeAllocation));
+    EXPECT_EQ(256u, poolsManager.getPooledAllocationSize(smallAllocation));
+    EXPECT_EQ(512 * MemoryConstants::kiloByte, poolsManager.getPooledAllocationSize(largeAllocation));
+
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(smallAllocation, true));
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(largeAllocation, true));
+    poolsManager.cleanup();
+    EXPECT_TRUE(poolsManager.poolsByAddress.empty());
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenSizeLimitReachedWithEmptyPoolsWhenAllocatingFromOtherClassThenEmptyPoolsAreTrimmed) {
+    auto memoryProperties = createMemoryProperties();
+    poolsManager.maxPoolsSize = 16 * MemoryConstants::megaByte + 4 * MemoryConstants::megaByte;
+
+    auto largeAllocation = poolsManager.createUnifiedMemoryAllocation(512 * MemoryConstants::kiloByte, memoryProperties);
+    ASSERT_NE(nullptr, largeAllocation);
+    auto smallAllocation = poolsManager.createUnifiedMemoryAllocation(256u, memoryProperties);
+    ASSERT_NE(nullptr, smallAllocation);
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(smallAllocation, true));
+
+    EXPECT_NE(nullptr, poolsManager.createUnifiedMemoryAllocation(16 * MemoryConstants::kiloByte, memoryProperties));
+    EXPECT_EQ(0u, poolsManager.pools[0].size());
+    EXPECT_EQ(1u, poolsManager.pools[1].size());
+    EXPECT_EQ(1u, poolsManager.pools[2].size());
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenPoolCreationFailureWhenAllocatingThenEmptyPoolsAreTrimmedAndCreationIsRetriedOnce) {
+    auto memoryProperties = createMemoryProperties();
+    auto smallAllocation = poolsManager.createUnifiedMemoryAllocation(256u, memoryProperties);
+    ASSERT_NE(nullptr, smallAllocation);
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(smallAllocation, true));
+    EXPECT_EQ(1u, poolsManager.createPoolCalled);
+
+    poolsManager.createPoolFailures = 1u;
+    EXPECT_NE(nullptr, poolsManager.createUnifiedMemoryAllocation(16 * MemoryConstants::kiloByte, memoryProperties));
+    EXPECT_EQ(3u, poolsManager.createPoolCalled);
+    EXPECT_EQ(0u, poolsManager.pools[0].size());
+    EXPECT_EQ(1u, poolsManager.pools[1].size());
+
+    poolsManager.createPoolFailures = 2u;
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(512 * MemoryConstants::kiloByte, memoryProperties));
+    EXPECT_EQ(5u, poolsManager.createPoolCalled);
+    EXPECT_EQ(0u, poolsManager.pools[2].size());
+    EXPECT_EQ(1u, poolsManager.getPoolsCount());
+}
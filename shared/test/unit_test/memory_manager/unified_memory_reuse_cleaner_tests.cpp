@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/mocks/mock_usm_memory_reuse_cleaner.h"
+#include "shared/test/common/mocks/ult_device_factory.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+namespace NEO {
+
+TEST(UnifiedMemoryReuseCleanerTest, givenMaxHoldTimeWhenCreatingCleanerThenSleepTimeIsBoundedByMaxSleepTime) {
+    MockUnifiedMemoryReuseCleaner longHoldCleaner(std::chrono::milliseconds(10000));
+    EXPECT_EQ(std::chrono::milliseconds(10000), longHoldCleaner.getMaxHoldTime());
+    EXPECT_EQ(UnifiedMemoryReuseCleaner::maxSleepTime, longHoldCleaner.sleepTime);
+
+    MockUnifiedMemoryReuseCleaner shortHoldCleaner(std::chrono::milliseconds(8));
+    EXPECT_EQ(std::chrono::milliseconds(4), shortHoldCleaner.sleepTime);
+
+    MockUnifiedMemoryReuseCleaner minimalHoldCleaner(std::chrono::milliseconds(1));
+    EXPECT_EQ(std::chrono::milliseconds(1), minimalHoldCleaner.sleepTime);
+}
+
+TEST(UnifiedMemoryReuseCleanerTest, givenCleanerThreadStartedWhenStoppingThenThreadIsJoined) {
+    MockUnifiedMemoryReuseCleaner cleaner(std::chrono::milliseconds(10000));
+    cleaner.callBaseStartThread = true;
+    cleaner.startThread();
+    EXPECT_NE(nullptr, cleaner.unifiedMemoryReuseCleanerThread);
+
+    cleaner.stopThread();
+    EXPECT_FALSE(cleaner.keepCleaning);
+    EXPECT_EQ(nullptr, cleaner.unifiedMemoryReuseCleanerThread);
+}
+
+TEST(UnifiedMemoryReuseCleanerTest, givenCachesWhenRegisteringAndUnregisteringThenCachesListIsUpdated) {
+    MockUnifiedMemoryReuseCleaner cleaner(std::chrono::milliseconds(10000));
+    SVMAllocsManager::SvmAllocationCache cache1;
+    SVMAllocsManager::SvmAllocationCache cache2;
+
+    cleaner.registerSvmAllocationCache(&cache1);
+    cleaner.registerSvmAllocationCache(&cache2);
+    EXPECT_EQ(2u, cleaner.svmAllocationCaches.size());
+
+    cleaner.unregisterSvmAllocationCache(&cache1);
+    ASSERT_EQ(1u, cleaner.svmAllocationCaches.size());
+    EXPECT_EQ(&cache2, cleaner.svmAllocationCaches[0]);
+
+    cleaner.unregisterSvmAllocationCache(&cache2);
+    EXPECT_TRUE(cleaner.svmAllocationCaches.empty());
+}
+
+TEST(UnifiedMemoryReuseCleanerTest, givenMaxHoldTimeDebugFlagWhenInitializingCleanerInExecutionEnvironmentThenCleanerIsCreatedOnlyIfHoldTimeIsPositive) {
+    DebugManagerStateRestore restore;
+    MockExecutionEnvironment executionEnvironment;
+    EXPECT_EQ(nullptr, executionEnvironment.initializeUnifiedMemoryReuseCleaner());
+
+    debugManager.flags.ExperimentalUsmAllocationCacheMaxHoldTime.set(0);
+    EXPECT_EQ(nullptr, executionEnvironment.initializeUnifiedMemoryReuseCleaner());
+
+    debugManager.flags.ExperimentalUsmAllocationCacheMaxHoldTime.set(100);
+    auto cleaner = executionEnvironment.initializeUnifiedMemoryReuseCleaner();
+    ASSERT_NE(nullptr, cleaner);
+    EXPECT_EQ(std::chrono::milliseconds(100), cleaner->getMaxHoldTime());
+    EXPECT_EQ(cleaner, executionEnvironment.initializeUnifiedMemoryReuseCleaner());
+}
+
+TEST(UnifiedMemoryReuseCleanerTest, givenCleanerEnabledWhenInitializingUsmCachesThenCachesAreRegisteredUntilSvmManagerIsDestroyed) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    debugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto cleaner = new MockUnifiedMemoryReuseCleaner(std::chrono::milliseconds(10000));
+    device->getExecutionEnvironment()->unifiedMemoryReuseCleaner.reset(cleaner);
+
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    svmManager->initUsmAllocationsCaches(*device);
+    EXPECT_EQ(cleaner, svmManager->unifiedMemoryReuseCleaner);
+    ASSERT_EQ(2u, cleaner->svmAllocationCaches.size());
+    EXPECT_EQ(&svmManager->usmDeviceAllocationsCache, cleaner->svmAllocationCaches[0]);
+    EXPECT_EQ(&svmManager->usmHostAllocationsCache, cleaner->svmAllocationCaches[1]);
+
+    svmManager.reset();
+    EXPECT_TRUE(cleaner->svmAllocationCaches.empty());
+}
+
+TEST(UnifiedMemoryReuseCleanerTest, givenExpiredAllocationsInRegisteredCacheWhenTrimmingOldInCachesThenExpiredAllocationsAreReleased) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto cleaner = new MockUnifiedMemoryReuseCleaner(std::chrono::milliseconds(10000));
+    device->getExecutionEnvironment()->unifiedMemoryReuseCleaner.reset(cleaner);
+
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_TRUE(svmManager->usmHostAllocationsCacheEnabled);
+    svmManager->usmHostAllocationsCache.maxSize = 1 * MemoryConstants::gigaByte;
+
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto expiredAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto recentAllocation = svmManager->createHostUnifiedMemoryAllocation(2 * MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(expiredAllocation);
+    svmManager->freeSVMAlloc(recentAllocation);
+    ASSERT_EQ(2u, svmManager->usmHostAllocationsCache.allocations.size());
+    svmManager->usmHostAllocationsCache.allocations[0].saveTime = std::chrono::steady_clock::now() - std::chrono::seconds(20);
+
+    cleaner->trimOldInCaches();
+    ASSERT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(recentAllocation, svmManager->usmHostAllocationsCache.allocations[0].allocation);
+    EXPECT_EQ(1u, svmManager->getUSMHostAllocCacheStats().evictions);
+
+    svmManager->trimUSMHostAllocCache();
+}
+
+} // namespace NEO
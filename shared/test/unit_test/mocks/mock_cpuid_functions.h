@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <cstdint>
 
 void mockCpuidEnableAll(int *cpuInfo, int functionId);
 
@@ -14,3 +15,7 @@ void mockCpuidFunctionAvailableDisableAll(int *cpuInfo, int functionId);
 void mockCpuidFunctionNotAvailableDisableAll(int *cpuInfo, int functionId);
 
 void mockCpuidReport36BitVirtualAddressSize(int *cpuInfo, int functionId);
+
+uint64_t mockXgetbvEnableAll(uint32_t xcr);
+
+uint64_t mockXgetbvAvxStatesOnly(uint32_t xcr);
@@ -26,6 +26,7 @@
 #include <mutex>
 #include <sched.h>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -187,3 +188,55 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenMultipleProducerThreadsWhenPushingBufferObjectsThenAllAreClosedAndStatsAreUpdated) {
+    constexpr uint32_t numThreads = 4u;
+    constexpr uint32_t numObjectsPerThread = 64u;
+    this->drmMock->gemCloseExpected = numThreads * numObjectsPerThread;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+
+    std::vector<std::thread> producers;
+    for (uint32_t threadId = 0u; threadId < numThreads; threadId++) {
+        producers.emplace_back([&]() {
+            for (uint32_t i = 0u; i < numObjectsPerThread; i++) {
+                worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    worker->close(true);
+    EXPECT_TRUE(worker->isEmpty());
+
+    auto stats = worker->getStats();
+    EXPECT_EQ(numThreads * numObjectsPerThread, stats.closedObjects);
+    EXPECT_LE(1u, stats.drainedBatches);
+    EXPECT_GE(stats.maxDrainTimeNs, stats.lastDrainTimeNs);
+
+    delete worker;
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenClosedWorkerWhenBufferObjectsArePushedAndQueueIsProcessedThenTheyAreClosedInSingleBatch) {
+    this->drmMock->gemCloseExpected = 3;
+
+    struct MockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::processQueue;
+    };
+
+    auto worker = std::make_unique<MockDrmGemCloseWorker>(*mm);
+    worker->close(true);
+
+    for (auto i = 0; i < 3; i++) {
+        worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    }
+    EXPECT_EQ(0u, worker->getStats().drainedBatches);
+
+    worker->processQueue();
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(1u, worker->getStats().drainedBatches);
+    EXPECT_EQ(3u, worker->getStats().closedObjects);
+}
@@ -444,6 +444,51 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenRunningOutOfMemoryThenUnusedAlloc
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchingEnabledWhenMakingAllocationsResidentThenVmBindIoctlsAreCountedAndBatchIsClosed) {
+    debugManager.flags.EnableVmBindBatching.set(1);
+
+    constexpr size_t numAllocations = 3;
+    GraphicsAllocation *allocations[numAllocations];
+    for (auto &allocation : allocations) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    }
+
+    auto &engine = device->getDefaultEngine();
+    auto vmBindCalled = mock->context.vmBindCalled;
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(engine.osContext, ArrayRef<GraphicsAllocation *>(allocations, numAllocations), true));
+    EXPECT_FALSE(mock->isVmBindBatchActive());
+    EXPECT_NE(vmBindCalled, mock->context.vmBindCalled);
+    EXPECT_EQ(mock->context.vmBindCalled - vmBindCalled, operationHandler->getLastResidencyVmBindIoctlCount());
+
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->makeResidentWithinOsContext(engine.osContext, ArrayRef<GraphicsAllocation *>(allocations, numAllocations), true));
+    EXPECT_EQ(0u, operationHandler->getLastResidencyVmBindIoctlCount());
+
+    for (auto &allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchingEnabledWhenRunningOutOfMemoryThenUnusedAllocationsAreUnbound) {
+    debugManager.flags.EnableVmBindBatching.set(1);
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+
+    for (auto &engine : device->getAllEngines()) {
+        *engine.commandStreamReceiver->getTagAddress() = 10;
+        allocation->updateTaskCount(8u, engine.osContext->getContextId());
+        EXPECT_EQ(operationHandler->makeResidentWithinOsContext(engine.osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true), MemoryOperationsStatus::success);
+    }
+
+    EXPECT_EQ(mock->context.vmBindCalled, 2u);
+
+    operationHandler->evictUnusedAllocations(false, true);
+
+    EXPECT_FALSE(mock->isVmBindBatchActive());
+    EXPECT_EQ(mock->context.vmBindCalled, 2u);
+    EXPECT_EQ(mock->context.vmUnbindCalled, 2u);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, givenUsedAllocationInBothSubdevicesWhenEvictUnusedThenNothingIsUnbound) {
     auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
 
@@ -1574,6 +1574,161 @@ TEST_F(IoctlHelperXeFenceWaitTest, whenCallingVmBindThenWaitUserFenceIsCalled) {
     }
 }
 
+TEST_F(IoctlHelperXeFenceWaitTest, givenVmBindBatchWhenCallingVmBindThenBindsAreSubmittedAsSingleArrayBindWithSingleFenceWait) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    constexpr uint32_t numBinds = 3u;
+    uint64_t fenceAddress = 0x4321;
+    VmBindParams vmBindParams[numBinds]{};
+    VmBindExtUserFenceT vmBindExtUserFence[numBinds]{};
+    for (uint32_t i = 0; i < numBinds; i++) {
+        BindInfo mockBindInfo{};
+        mockBindInfo.handle = 0x1234 + i;
+        xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+        xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence[i], fenceAddress, 0x789 + i, 0u);
+        vmBindParams[i].handle = mockBindInfo.handle;
+        vmBindParams[i].start = 0x10000 * (i + 1);
+        xeIoctlHelper->setVmBindUserFence(vmBindParams[i], vmBindExtUserFence[i]);
+    }
+
+    drm->vmBindInputs.clear();
+    drm->syncInputs.clear();
+    drm->waitUserFenceInputs.clear();
+    auto vmBindIoctlCount = xeIoctlHelper->getVmBindIoctlCount();
+
+    drm->beginVmBindBatch();
+    EXPECT_TRUE(drm->isVmBindBatchActive());
+    for (uint32_t i = 0; i < numBinds; i++) {
+        EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[i]));
+    }
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+    EXPECT_EQ(0u, drm->waitUserFenceInputs.size());
+
+    EXPECT_EQ(0, drm->endVmBindBatch());
+    EXPECT_FALSE(drm->isVmBindBatchActive());
+
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(numBinds, drm->vmBindInputs[0].num_binds);
+    ASSERT_EQ(numBinds, drm->vmBindArrayInputs.size());
+    for (uint32_t i = 0; i < numBinds; i++) {
+        EXPECT_EQ(vmBindParams[i].handle, drm->vmBindArrayInputs[i].obj);
+        EXPECT_EQ(static_cast<uint32_t>(DRM_XE_VM_BIND_OP_MAP), drm->vmBindArrayInputs[i].op);
+    }
+    ASSERT_EQ(1u, drm->syncInputs.size());
+    EXPECT_EQ(fenceAddress, drm->syncInputs[0].addr);
+    EXPECT_EQ(0x789u + numBinds - 1, drm->syncInputs[0].timeline_value);
+    ASSERT_EQ(1u, drm->waitUserFenceInputs.size());
+    EXPECT_EQ(0x789u + numBinds - 1, drm->waitUserFenceInputs[0].value);
+    EXPECT_EQ(vmBindIoctlCount + 1, xeIoctlHelper->getVmBindIoctlCount());
+}
+
+TEST_F(IoctlHelperXeFenceWaitTest, givenVmBindBatchWithSingleBindWhenBatchEndsThenRegularBindIsSubmitted) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    BindInfo mockBindInfo{};
+    mockBindInfo.handle = 0x1234;
+    xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = mockBindInfo.handle;
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    drm->vmBindInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    drm->beginVmBindBatch();
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(0, drm->endVmBindBatch());
+
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(1u, drm->vmBindInputs[0].num_binds);
+    EXPECT_EQ(mockBindInfo.handle, drm->vmBindInputs[0].bind.obj);
+    EXPECT_EQ(0u, drm->vmBindArrayInputs.size());
+    EXPECT_EQ(1u, drm->waitUserFenceInputs.size());
+}
+
+TEST_F(IoctlHelperXeFenceWaitTest, givenVmBindBatchWhenBindHasExtensionsThenQueuedBindsAreSubmittedAndBindWithExtensionsIsNotQueued) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    constexpr uint32_t numBinds = 3u;
+    VmBindParams vmBindParams[numBinds]{};
+    VmBindExtUserFenceT vmBindExtUserFence[numBinds]{};
+    for (uint32_t i = 0; i < numBinds; i++) {
+        BindInfo mockBindInfo{};
+        mockBindInfo.handle = 0x1234 + i;
+        xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+        xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence[i], 0x4321, 0x789 + i, 0u);
+        vmBindParams[i].handle = mockBindInfo.handle;
+        xeIoctlHelper->setVmBindUserFence(vmBindParams[i], vmBindExtUserFence[i]);
+    }
+    uint64_t extension = 0u;
+    vmBindParams[1].extensions = castToUint64(&extension);
+
+    drm->vmBindInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    drm->beginVmBindBatch();
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[0]));
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[1]));
+    ASSERT_EQ(2u, drm->vmBindInputs.size());
+    EXPECT_EQ(vmBindParams[0].handle, drm->vmBindInputs[0].bind.obj);
+    EXPECT_EQ(vmBindParams[1].handle, drm->vmBindInputs[1].bind.obj);
+    EXPECT_EQ(vmBindParams[1].extensions, drm->vmBindInputs[1].bind.extensions);
+    EXPECT_EQ(2u, drm->waitUserFenceInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[2]));
+    EXPECT_EQ(2u, drm->vmBindInputs.size());
+    EXPECT_EQ(0, drm->endVmBindBatch());
+    ASSERT_EQ(3u, drm->vmBindInputs.size());
+    EXPECT_EQ(vmBindParams[2].handle, drm->vmBindInputs[2].bind.obj);
+}
+
+TEST_F(IoctlHelperXeFenceWaitTest, givenVmBindBatchWhenArrayBindFailsThenErrorIsReturnedAtBatchEndAndFenceIsNotWaited) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    VmBindParams vmBindParams[2]{};
+    VmBindExtUserFenceT vmBindExtUserFence[2]{};
+    for (uint32_t i = 0; i < 2; i++) {
+        BindInfo mockBindInfo{};
+        mockBindInfo.handle = 0x1234 + i;
+        xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+        xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence[i], 0x4321, 0x789 + i, 0u);
+        vmBindParams[i].handle = mockBindInfo.handle;
+        xeIoctlHelper->setVmBindUserFence(vmBindParams[i], vmBindExtUserFence[i]);
+    }
+
+    drm->waitUserFenceInputs.clear();
+    drm->gemVmBindReturn = -1;
+
+    drm->beginVmBindBatch();
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[0]));
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[1]));
+    EXPECT_EQ(-1, drm->endVmBindBatch());
+    EXPECT_EQ(0u, drm->waitUserFenceInputs.size());
+
+    drm->gemVmBindReturn = 0;
+    drm->beginVmBindBatch();
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams[0]));
+    EXPECT_EQ(0, drm->endVmBindBatch());
+}
+
 TEST(IoctlHelperXeTest, givenVmBindWaitUserFenceTimeoutWhenCallingVmBindThenWaitUserFenceIsCalledWithSpecificTimeout) {
     DebugManagerStateRestore restorer;
     debugManager.flags.VmBindWaitUserFenceTimeout.set(5000000000ll);
@@ -12,6 +12,7 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <map>
 #include <random>
 
 using namespace NEO;
@@ -21,6 +22,7 @@ const size_t allocationAlignment = MemoryConstants::pageSize;
 
 class HeapAllocatorUnderTest : public HeapAllocator {
   public:
+    HeapAllocatorUnderTest(uint64_t address, uint64_t size, size_t alignment, size_t threshold, HeapAllocatorMode mode) : HeapAllocator(address, size, alignment, threshold, mode) {}
     HeapAllocatorUnderTest(uint64_t address, uint64_t size, size_t alignment, size_t threshold) : HeapAllocator(address, size, alignment, threshold) {}
     HeapAllocatorUnderTest(uint64_t address, uint64_t size, size_t alignment) : HeapAllocator(address, size, alignment) {}
     HeapAllocatorUnderTest(uint64_t address, uint64_t size) : HeapAllocator(address, size) {}
@@ -38,6 +40,7 @@ class HeapAllocatorUnderTest : public HeapAllocator {
 
     std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
     std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    std::map<uint64_t, size_t> &getFreeRangesByAddress() { return this->freeRangesByAddress; };
 
     using HeapAllocator::allocationAlignment;
     size_t sizeOfFreedChunk = 0;
@@ -1472,3 +1475,223 @@ TEST(HeapAllocatorTest, givenZeroAlignmentPassedWhenAllocatingMemoryWithCustomAl
     uint64_t ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, 0u);
     EXPECT_EQ(alignUp(heapBase, allocationAlignment), ptr);
 }
+
+TEST(HeapAllocatorTest, givenDefaultConstructedHeapAllocatorThenLinearFreeListsModeIsUsed) {
+    HeapAllocatorUnderTest heapAllocator(0x100000llu, 1024u * 4096u, allocationAlignment, sizeThreshold);
+    EXPECT_EQ(HeapAllocatorMode::linearFreeLists, heapAllocator.getMode());
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenSmallAndBigAllocationsWhenAllocatingThenSmallAreTakenFromRightAndBigFromLeftBound) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, HeapAllocatorMode::segregatedFit);
+    EXPECT_EQ(HeapAllocatorMode::segregatedFit, heapAllocator.getMode());
+
+    size_t smallSize = 4096;
+    auto smallPtr = heapAllocator.allocate(smallSize);
+    EXPECT_EQ(heapBase + heapSize - 4096, smallPtr);
+    EXPECT_EQ(smallPtr, heapAllocator.getRightBound());
+
+    size_t bigSize = sizeThreshold + 4096;
+    auto bigPtr = heapAllocator.allocate(bigSize);
+    EXPECT_EQ(heapBase, bigPtr);
+    EXPECT_EQ(heapBase + bigSize, heapAllocator.getLeftBound());
+    EXPECT_EQ(heapSize - smallSize - bigSize, heapAllocator.getLeftSize());
+
+    heapAllocator.free(smallPtr, smallSize);
+    heapAllocator.free(bigPtr, bigSize);
+    EXPECT_EQ(heapBase, heapAllocator.getLeftBound());
+    EXPECT_EQ(heapBase + heapSize, heapAllocator.getRightBound());
+    EXPECT_TRUE(heapAllocator.getFreeRangesByAddress().empty());
+    EXPECT_EQ(heapSize, heapAllocator.getLeftSize());
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenFreedNeighbouringRangesWhenFreeingThenRangesAreCoalescedAndMergedWithBound) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, HeapAllocatorMode::segregatedFit);
+
+    uint64_t ptrs[4] = {};
+    for (auto &ptr : ptrs) {
+        size_t ptrSize = 4096;
+        ptr = heapAllocator.allocate(ptrSize);
+    }
+
+    heapAllocator.free(ptrs[1], 4096);
+    EXPECT_EQ(1u, heapAllocator.getFreeRangesByAddress().size());
+    heapAllocator.free(ptrs[2], 4096);
+    ASSERT_EQ(1u, heapAllocator.getFreeRangesByAddress().size());
+    EXPECT_EQ(ptrs[2], heapAllocator.getFreeRangesByAddress().begin()->first);
+    EXPECT_EQ(2u * 4096u, heapAllocator.getFreeRangesByAddress().begin()->second);
+
+    heapAllocator.free(ptrs[3], 4096);
+    EXPECT_TRUE(heapAllocator.getFreeRangesByAddress().empty());
+    EXPECT_EQ(ptrs[0], heapAllocator.getRightBound());
+
+    heapAllocator.free(ptrs[0], 4096);
+    EXPECT_EQ(heapBase + heapSize, heapAllocator.getRightBound());
+    EXPECT_EQ(heapSize, heapAllocator.getLeftSize());
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenFreedRangesOfDifferentSizesWhenAllocatingThenBestFitRangeIsUsedAndSplit) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, HeapAllocatorMode::segregatedFit);
+
+    size_t bigRangeSize = 8 * 4096;
+    size_t smallRangeSize = 2 * 4096;
+    size_t separatorSize = 4096;
+    auto bigRange = heapAllocator.allocate(bigRangeSize);
+    heapAllocator.allocate(separatorSize);
+    auto smallRange = heapAllocator.allocate(smallRangeSize);
+    separatorSize = 4096;
+    heapAllocator.allocate(separatorSize);
+
+    heapAllocator.free(bigRange, bigRangeSize);
+    heapAllocator.free(smallRange, smallRangeSize);
+    EXPECT_EQ(2u, heapAllocator.getFreeRangesByAddress().size());
+
+    size_t ptrSize = 4096;
+    auto ptr = heapAllocator.allocate(ptrSize);
+    EXPECT_EQ(smallRange + 4096, ptr);
+    EXPECT_EQ(4096u, ptrSize);
+    EXPECT_EQ(2u, heapAllocator.getFreeRangesByAddress().size());
+    EXPECT_EQ(4096u, heapAllocator.getFreeRangesByAddress()[smallRange]);
+
+    ptrSize = 6 * 4096;
+    ptr = heapAllocator.allocate(ptrSize);
+    EXPECT_EQ(bigRange + 2 * 4096, ptr);
+    EXPECT_EQ(2u * 4096u, heapAllocator.getFreeRangesByAddress()[bigRange]);
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenCustomAlignmentWhenAllocatingFromFreedRangeThenPointerIsAlignedAndRemaindersAreKept) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, 0, HeapAllocatorMode::segregatedFit);
+
+    size_t ptrSize = 4096;
+    heapAllocator.allocate(ptrSize);
+    ptrSize = 64 * 4096;
+    auto freedRange = heapAllocator.allocate(ptrSize);
+    size_t separatorSize = 4096;
+    heapAllocator.allocate(separatorSize);
+    heapAllocator.free(freedRange, ptrSize);
+
+    const size_t customAlignment = 32 * 4096;
+    size_t alignedSize = 16 * 4096;
+    auto ptr = heapAllocator.allocateWithCustomAlignment(alignedSize, customAlignment);
+    EXPECT_TRUE(isAligned(ptr, customAlignment));
+    EXPECT_GE(ptr, freedRange);
+    EXPECT_LE(ptr + alignedSize, freedRange + 64 * 4096);
+    EXPECT_EQ(2u, heapAllocator.getFreeRangesByAddress().size());
+    EXPECT_EQ(heapSize - 2 * 4096 - alignedSize, heapAllocator.getLeftSize());
+
+    heapAllocator.free(ptr, alignedSize);
+    ASSERT_EQ(1u, heapAllocator.getFreeRangesByAddress().size());
+    EXPECT_EQ(64u * 4096u, heapAllocator.getFreeRangesByAddress()[freedRange]);
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenMisalignedBoundWhenAllocatingWithCustomAlignmentThenMisalignmentIsReusedAfterFree) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, 0, HeapAllocatorMode::segregatedFit);
+
+    size_t ptrSize = 4096;
+    heapAllocator.allocate(ptrSize);
+
+    const size_t customAlignment = 64 * 4096;
+    size_t alignedSize = 4096;
+    auto ptr = heapAllocator.allocateWithCustomAlignment(alignedSize, customAlignment);
+    EXPECT_TRUE(isAligned(ptr, customAlignment));
+    EXPECT_EQ(1u, heapAllocator.getFreeRangesByAddress().size());
+
+    heapAllocator.free(ptr, alignedSize);
+    EXPECT_TRUE(heapAllocator.getFreeRangesByAddress().empty());
+    EXPECT_EQ(heapBase + 4096, heapAllocator.getLeftBound());
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenHeapExhaustedWhenAllocatingThenZeroIsReturned) {
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 16u * 4096u;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, HeapAllocatorMode::segregatedFit);
+
+    size_t ptrSize = 8 * 4096;
+    auto ptr1 = heapAllocator.allocate(ptrSize);
+    ptrSize = 4 * 4096;
+    auto ptr2 = heapAllocator.allocate(ptrSize);
+    ptrSize = 4 * 4096;
+    heapAllocator.allocate(ptrSize);
+    EXPECT_NE(0u, ptr1);
+    EXPECT_NE(0u, ptr2);
+    EXPECT_EQ(0u, heapAllocator.getLeftSize());
+
+    heapAllocator.free(ptr2, 4 * 4096);
+    ptrSize = 8 * 4096;
+    EXPECT_EQ(0u, heapAllocator.allocate(ptrSize));
+    ptrSize = 4 * 4096;
+    EXPECT_EQ(ptr2, heapAllocator.allocate(ptrSize));
+}
+
+TEST(HeapAllocatorSegregatedFitTest, givenRecordedAllocationTraceWhenReplayedInBothModesThenAllocationsDoNotOverlapAndWholeHeapIsRecovered) {
+    std::ranlux24 generator(1);
+    const uint64_t heapBase = 0x100000000llu;
+    const size_t heapSize = 256 * MemoryConstants::megaByte;
+
+    struct TraceEntry {
+        bool isAllocation;
+        size_t sizeOrIndex;
+        size_t alignment;
+    };
+    std::vector<TraceEntry> trace;
+    size_t liveAllocations = 0;
+    for (uint32_t i = 0; i < 4000; i++) {
+        if (liveAllocations > 0 && generator() % 2 == 0) {
+            trace.push_back({false, generator() % liveAllocations, 0});
+            liveAllocations--;
+        } else {
+            const size_t size = (1 + generator() % 32) * MemoryConstants::pageSize * ((generator() % 8 == 0) ? 32 : 1);
+            const size_t alignment = (generator() % 4 == 0) ? MemoryConstants::pageSize64k : 0;
+            trace.push_back({true, size, alignment});
+            liveAllocations++;
+        }
+    }
+
+    for (auto mode : {HeapAllocatorMode::linearFreeLists, HeapAllocatorMode::segregatedFit}) {
+        HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold, mode);
+        std::vector<std::pair<uint64_t, size_t>> allocations;
+        std::map<uint64_t, size_t> liveRanges;
+
+        for (auto &entry : trace) {
+            if (entry.isAllocation) {
+                size_t size = entry.sizeOrIndex;
+                auto ptr = heapAllocator.allocateWithCustomAlignment(size, entry.alignment);
+                ASSERT_NE(0u, ptr);
+                EXPECT_TRUE(isAligned(ptr, std::max(entry.alignment, allocationAlignment)));
+
+                auto next = liveRanges.lower_bound(ptr);
+                if (next != liveRanges.end()) {
+                    EXPECT_LE(ptr + size, next->first);
+                }
+                if (next != liveRanges.begin()) {
+                    auto prev = std::prev(next);
+                    EXPECT_LE(prev->first + prev->second, ptr);
+                }
+                liveRanges.emplace(ptr, size);
+                allocations.emplace_back(ptr, size);
+            } else {
+                auto allocation = allocations[entry.sizeOrIndex];
+                allocations.erase(allocations.begin() + entry.sizeOrIndex);
+                liveRanges.erase(allocation.first);
+                heapAllocator.free(allocation.first, allocation.second);
+            }
+        }
+
+        for (auto &allocation : allocations) {
+            heapAllocator.free(allocation.first, allocation.second);
+        }
+        EXPECT_EQ(heapSize, heapAllocator.getLeftSize());
+
+        size_t wholeHeapSize = heapSize;
+        EXPECT_EQ(heapBase, heapAllocator.allocateWithCustomAlignment(wholeHeapSize, 0u));
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/mapped_file.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <sys/stat.h>
+
+namespace NEO {
+namespace SysCalls {
+extern bool failMmap;
+}
+} // namespace NEO
+
+using namespace NEO;
+
+TEST(MappedFileLinuxTest, givenFileWithContentsWhenCreatingMappedFileThenWholeFileIsMappedAndUnmappedOnDestruction) {
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return SysCalls::fakeFileDescriptor;
+    });
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> mockFstat(&SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+        buf->st_size = 4096;
+        return 0;
+    });
+    VariableBackup<uint32_t> mmapCalledBackup(&SysCalls::mmapFuncCalled, 0u);
+    VariableBackup<uint32_t> munmapCalledBackup(&SysCalls::munmapFuncCalled, 0u);
+    VariableBackup<uint32_t> closeCalledBackup(&SysCalls::closeFuncCalled, 0u);
+
+    auto mappedFile = MappedFile::create("binary.bin");
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_NE(nullptr, mappedFile->getData().begin());
+    EXPECT_EQ(4096u, mappedFile->getData().size());
+    EXPECT_EQ(1u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+
+    mappedFile.reset();
+    EXPECT_EQ(1u, SysCalls::munmapFuncCalled);
+}
+
+TEST(MappedFileLinuxTest, givenFileWhichCannotBeOpenedOrIsEmptyOrCannotBeMappedWhenCreatingMappedFileThenNullptrIsReturned) {
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return -1;
+    });
+    EXPECT_EQ(nullptr, MappedFile::create("binary.bin"));
+    EXPECT_EQ(nullptr, MappedFile::create(nullptr));
+
+    mockOpen = [](const char *pathname, int flags) -> int {
+        return SysCalls::fakeFileDescriptor;
+    };
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> mockFstat(&SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+        buf->st_size = 0;
+        return 0;
+    });
+    EXPECT_EQ(nullptr, MappedFile::create("binary.bin"));
+
+    mockFstat = [](int fd, struct stat *buf) -> int {
+        buf->st_size = 4096;
+        return 0;
+    };
+    VariableBackup<bool> failMmapBackup(&SysCalls::failMmap, true);
+    VariableBackup<uint32_t> closeCalledBackup(&SysCalls::closeFuncCalled, 0u);
+    EXPECT_EQ(nullptr, MappedFile::create("binary.bin"));
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+}
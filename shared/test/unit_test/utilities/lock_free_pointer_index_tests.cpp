@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/lock_free_pointer_index.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using namespace NEO;
+
+struct IndexedData {
+    size_t size;
+};
+
+class MockLockFreePointerIndex : public LockFreePointerIndex<IndexedData> {
+  public:
+    using LockFreePointerIndex<IndexedData>::readerEpoch;
+    using LockFreePointerIndex<IndexedData>::readerShards;
+    using LockFreePointerIndex<IndexedData>::retiredSnapshots;
+};
+
+TEST(LockFreePointerIndexTest, givenEmptyIndexWhenGettingPointerThenNullptrIsReturned) {
+    LockFreePointerIndex<IndexedData> index;
+    EXPECT_EQ(nullptr, index.get(nullptr));
+    EXPECT_EQ(nullptr, index.get(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(0u, index.getNumEntries());
+}
+
+TEST(LockFreePointerIndexTest, givenEntriesInsertedInAnyOrderWhenGettingPointersWithinRangesThenOwningEntryIsReturned) {
+    LockFreePointerIndex<IndexedData> index;
+    IndexedData data[] = {{0x100}, {0x100}, {0x100}};
+
+    index.insert(reinterpret_cast<void *>(0x3000), data[2].size, &data[2]);
+    index.insert(reinterpret_cast<void *>(0x1000), data[0].size, &data[0]);
+    index.insert(reinterpret_cast<void *>(0x2000), data[1].size, &data[1]);
+    EXPECT_EQ(3u, index.getNumEntries());
+
+    EXPECT_EQ(nullptr, index.get(reinterpret_cast<void *>(0xfff)));
+    EXPECT_EQ(&data[0], index.get(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(&data[0], index.get(reinterpret_cast<void *>(0x10ff)));
+    EXPECT_EQ(nullptr, index.get(reinterpret_cast<void *>(0x1100)));
+    EXPECT_EQ(&data[1], index.get(reinterpret_cast<void *>(0x2080)));
+    EXPECT_EQ(&data[2], index.get(reinterpret_cast<void *>(0x3000)));
+    EXPECT_EQ(nullptr, index.get(reinterpret_cast<void *>(0x3100)));
+}
+
+TEST(LockFreePointerIndexTest, givenZeroSizedEntryWhenGettingPointerThenOnlyExactMatchIsReturned) {
+    LockFreePointerIndex<IndexedData> index;
+    IndexedData data = {0u};
+
+    index.insert(reinterpret_cast<void *>(0x1000), data.size, &data);
+    EXPECT_EQ(&data, index.get(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(nullptr, index.get(reinterpret_cast<void *>(0x1001)));
+}
+
+TEST(LockFreePointerIndexTest, givenEntryWhenRemovingThenItIsNoLongerFoundAndOtherEntriesRemain) {
+    LockFreePointerIndex<IndexedData> index;
+    IndexedData data[] = {{0x100}, {0x100}};
+
+    index.insert(reinterpret_cast<void *>(0x1000), data[0].size, &data[0]);
+    index.insert(reinterpret_cast<void *>(0x2000), data[1].size, &data[1]);
+
+    EXPECT_FALSE(index.remove(reinterpret_cast<void *>(0x1080)));
+    EXPECT_TRUE(index.remove(reinterpret_cast<void *>(0x1000)));
+    EXPECT_FALSE(index.remove(reinterpret_cast<void *>(0x1000)));
+
+    EXPECT_EQ(1u, index.getNumEntries());
+    EXPECT_EQ(nullptr, index.get(reinterpret_cast<void *>(0x1000)));
+    EXPECT_EQ(&data[1], index.get(reinterpret_cast<void *>(0x2000)));
+
+    index.clear();
+    EXPECT_EQ(0u, index.getNumEntries());
+    EXPECT_EQ(nullptr, index.get(reinterpret_cast<void *>(0x2000)));
+}
+
+TEST(LockFreePointerIndexTest, givenNoActiveReadersWhenSnapshotIsReplacedThenRetiredSnapshotIsReclaimed) {
+    MockLockFreePointerIndex index;
+    IndexedData data = {0x100};
+
+    index.insert(reinterpret_cast<void *>(0x1000), data.size, &data);
+    index.insert(reinterpret_cast<void *>(0x2000), data.size, &data);
+    EXPECT_EQ(0u, index.getNumRetiredSnapshots());
+}
+
+TEST(LockFreePointerIndexTest, givenActiveReaderWhenSnapshotIsReplacedThenRetiredSnapshotIsKeptUntilReaderLeaves) {
+    MockLockFreePointerIndex index;
+    IndexedData data = {0x100};
+
+    index.insert(reinterpret_cast<void *>(0x1000), data.size, &data);
+
+    auto &activeReaders = index.readerShards[MockLockFreePointerIndex::numReaderShards - 1].activeReaders[index.readerEpoch % 2];
+    activeReaders++;
+    index.insert(reinterpret_cast<void *>(0x2000), data.size, &data);
+    index.insert(reinterpret_cast<void *>(0x3000), data.size, &data);
+    EXPECT_EQ(2u, index.getNumRetiredSnapshots());
+
+    activeReaders--;
+    index.remove(reinterpret_cast<void *>(0x3000));
+    EXPECT_EQ(0u, index.getNumRetiredSnapshots());
+    EXPECT_EQ(&data, index.get(reinterpret_cast<void *>(0x2000)));
+}
+
+TEST(LockFreePointerIndexTest, givenReadersConstantlyEnteringInNewEpochWhenSnapshotIsReplacedThenSnapshotsRetiredBeforeTheyEnteredAreReclaimed) {
+    MockLockFreePointerIndex index;
+    IndexedData data = {0x100};
+
+    index.insert(reinterpret_cast<void *>(0x1000), data.size, &data);
+
+    auto &oldEpochReaders = index.readerShards[0].activeReaders[index.readerEpoch % 2];
+    oldEpochReaders++;
+    index.insert(reinterpret_cast<void *>(0x2000), data.size, &data);
+    EXPECT_EQ(1u, index.getNumRetiredSnapshots());
+
+    auto &newEpochReaders = index.readerShards[1].activeReaders[index.readerEpoch % 2];
+    EXPECT_NE(&oldEpochReaders, &newEpochReaders);
+    newEpochReaders++;
+    oldEpochReaders--;
+    index.insert(reinterpret_cast<void *>(0x3000), data.size, &data);
+    EXPECT_EQ(1u, index.getNumRetiredSnapshots());
+
+    newEpochReaders--;
+    index.remove(reinterpret_cast<void *>(0x3000));
+    EXPECT_EQ(0u, index.getNumRetiredSnapshots());
+}
+
+TEST(LockFreePointerIndexTest, givenMultipleReaderThreadsAndConcurrentWriterWhenGettingPointersThenStableEntriesAreAlwaysFound) {
+    LockFreePointerIndex<IndexedData> index;
+    constexpr size_t numStableEntries = 256u;
+    constexpr size_t entrySize = 0x1000u;
+    constexpr uintptr_t baseAddress = 0x100000u;
+    constexpr uintptr_t transientBaseAddress = baseAddress + 2 * numStableEntries * entrySize;
+    std::vector<IndexedData> stableData(numStableEntries, IndexedData{entrySize});
+    IndexedData transientData = {entrySize};
+
+    for (size_t i = 0; i < numStableEntries; i++) {
+        index.insert(reinterpret_cast<void *>(baseAddress + 2 * i * entrySize), entrySize, &stableData[i]);
+    }
+
+    const auto numReaders = std::max(2u, std::min(32u, std::thread::hardware_concurrency()));
+    constexpr size_t lookupsPerReader = 20000u;
+    std::atomic<bool> writerDone{false};
+    std::atomic<size_t> failedLookups{0u};
+
+    std::thread writer([&]() {
+        for (size_t i = 0; i < 1000u; i++) {
+            const auto address = reinterpret_cast<void *>(transientBaseAddress + (i % 16) * entrySize);
+            index.insert(address, entrySize, &transientData);
+            index.remove(address);
+        }
+        writerDone = true;
+    });
+
+    std::vector<std::thread> readers;
+    for (uint32_t reader = 0; reader < numReaders; reader++) {
+        readers.emplace_back([&, reader]() {
+            for (size_t i = 0; i < lookupsPerReader; i++) {
+                const auto entryId = (i * 7u + reader) % numStableEntries;
+                const auto address = baseAddress + 2 * entryId * entrySize + (i % entrySize);
+                if (index.get(reinterpret_cast<void *>(address)) != &stableData[entryId] ||
+                    index.get(reinterpret_cast<void *>(address + entrySize)) != nullptr) {
+                    failedLookups++;
+                }
+            }
+        });
+    }
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    writer.join();
+
+    EXPECT_TRUE(writerDone);
+    EXPECT_EQ(0u, failedLookups);
+    EXPECT_EQ(numStableEntries, index.getNumEntries());
+    EXPECT_EQ(nullptr, index.get(reinterpret_cast<void *>(transientBaseAddress)));
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <atomic>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenDefaultSettingsWhenGettingWorkersCountThenItIsBoundedByItemsCountAndMaxWorkersCount) {
+    EXPECT_EQ(1u, ParallelFor::getWorkersCount(0u));
+    EXPECT_EQ(1u, ParallelFor::getWorkersCount(ParallelFor::minItemsPerWorker - 1));
+    EXPECT_EQ(1u, ParallelFor::getWorkersCount(ParallelFor::minItemsPerWorker));
+
+    auto workersCount = ParallelFor::getWorkersCount(ParallelFor::minItemsPerWorker * 1000);
+    EXPECT_LE(1u, workersCount);
+    EXPECT_GE(ParallelFor::maxWorkersCount, workersCount);
+    EXPECT_GE(std::max(std::thread::hardware_concurrency(), 1u), workersCount);
+}
+
+TEST(ParallelForTest, givenModuleLoadWorkerThreadsSetWhenGettingWorkersCountThenDebugValueIsUsedAndBoundedByItemsCount) {
+    DebugManagerStateRestore restorer;
+
+    debugManager.flags.ModuleLoadWorkerThreads.set(0);
+    EXPECT_EQ(1u, ParallelFor::getWorkersCount(1000u));
+
+    debugManager.flags.ModuleLoadWorkerThreads.set(4);
+    EXPECT_EQ(4u, ParallelFor::getWorkersCount(1000u));
+    EXPECT_EQ(2u, ParallelFor::getWorkersCount(2u));
+    EXPECT_EQ(1u, ParallelFor::getWorkersCount(0u));
+}
+
+TEST(ParallelForTest, givenMultipleWorkersWhenRunningParallelForThenEachItemIsProcessedExactlyOnce) {
+    DebugManagerStateRestore restorer;
+
+    constexpr size_t itemsCount = 1001u;
+    for (auto workersCount : {1, 3, 8}) {
+        debugManager.flags.ModuleLoadWorkerThreads.set(workersCount);
+
+        std::vector<std::atomic<uint32_t>> processedItems(itemsCount);
+        parallelFor(itemsCount, [&](size_t itemId) {
+            processedItems[itemId]++;
+        });
+
+        for (auto &processedItem : processedItems) {
+            EXPECT_EQ(1u, processedItem.load());
+        }
+    }
+}
+
+TEST(ParallelForTest, givenNoItemsWhenRunningParallelForThenFunctionIsNotCalled) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ModuleLoadWorkerThreads.set(4);
+
+    uint32_t calls = 0u;
+    parallelFor(0u, [&](size_t itemId) {
+        calls++;
+    });
+    EXPECT_EQ(0u, calls);
+}
@@ -20,6 +20,24 @@
 
 using namespace NEO;
 
+class MockStagingBufferManager : public StagingBufferManager {
+  public:
+    using StagingBufferManager::StagingBufferManager;
+
+    WaitStatus waitForChunk(TaskCountType taskCountToWait, CommandStreamReceiver *csr) override {
+        waitForChunkCalled++;
+        lastWaitedCsr = csr;
+        if (waitStatusToReturn == WaitStatus::ready) {
+            *csr->getTagAddress() = taskCountToWait;
+        }
+        return waitStatusToReturn;
+    }
+
+    size_t waitForChunkCalled = 0;
+    CommandStreamReceiver *lastWaitedCsr = nullptr;
+    WaitStatus waitStatusToReturn = WaitStatus::ready;
+};
+
 class StagingBufferManagerFixture : public DeviceFixture {
   public:
     void setUp() {
@@ -273,3 +291,198 @@ HWTEST_F(StagingBufferManagerTest, givenStagingBufferWhenDirectSubmissionEnabled
     svmAllocsManager->freeSVMAlloc(usmBuffer);
     delete[] nonUsmBuffer;
 }
+
+TEST_F(StagingBufferManagerTest, givenPipelineDepthWhenTaskCountNotReadyThenWaitForOldestChunkInsteadOfAllocatingNewBuffer) {
+    constexpr size_t numOfChunkCopies = 8;
+    constexpr size_t totalCopySize = stagingBufferSize * numOfChunkCopies;
+    constexpr size_t pipelineDepth = 2;
+    debugManager.flags.StagingBufferPipelineDepth.set(pipelineDepth);
+
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto mockStagingBufferManager = new MockStagingBufferManager(svmAllocsManager.get(), rootDeviceIndices, deviceBitfields);
+    stagingBufferManager.reset(mockStagingBufferManager);
+
+    *csr->getTagAddress() = csr->peekTaskCount();
+    copyThroughStagingBuffers(totalCopySize, numOfChunkCopies, pipelineDepth);
+    EXPECT_EQ(numOfChunkCopies - pipelineDepth, mockStagingBufferManager->waitForChunkCalled);
+}
+
+TEST_F(StagingBufferManagerTest, givenPipelineDepthAndChunksTrackedByOtherCsrWhenWaitingForOldestChunkThenWaitOnCsrWhichSubmittedChunk) {
+    constexpr size_t pipelineDepth = 1;
+    debugManager.flags.StagingBufferPipelineDepth.set(pipelineDepth);
+
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto mockStagingBufferManager = new MockStagingBufferManager(svmAllocsManager.get(), rootDeviceIndices, deviceBitfields);
+    stagingBufferManager.reset(mockStagingBufferManager);
+
+    MockCommandStreamReceiver otherCsr(*pDevice->getExecutionEnvironment(), pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    otherCsr.initializeTagAllocation();
+    *otherCsr.getTagAddress() = 0u;
+    *csr->getTagAddress() = csr->peekTaskCount();
+
+    auto usmBuffer = allocateDeviceBuffer(stagingBufferSize);
+    auto nonUsmBuffer = new unsigned char[stagingBufferSize];
+    ChunkCopyFunction chunkCopy = [&](void *chunkDst, void *stagingBuffer, const void *chunkSrc, size_t chunkSize) {
+        otherCsr.taskCount++;
+        return 0;
+    };
+    EXPECT_EQ(0, stagingBufferManager->performCopy(usmBuffer, nonUsmBuffer, stagingBufferSize, chunkCopy, &otherCsr));
+    EXPECT_EQ(0u, mockStagingBufferManager->waitForChunkCalled);
+
+    ChunkCopyFunction chunkCopyOnCsr = [&](void *chunkDst, void *stagingBuffer, const void *chunkSrc, size_t chunkSize) {
+        return 0;
+    };
+    EXPECT_EQ(0, stagingBufferManager->performCopy(usmBuffer, nonUsmBuffer, stagingBufferSize, chunkCopyOnCsr, csr));
+    EXPECT_EQ(1u, mockStagingBufferManager->waitForChunkCalled);
+    EXPECT_EQ(&otherCsr, mockStagingBufferManager->lastWaitedCsr);
+
+    svmAllocsManager->freeSVMAlloc(usmBuffer);
+    delete[] nonUsmBuffer;
+}
+
+TEST_F(StagingBufferManagerTest, givenPipelineDepthWhenPerformReadCopyThenPendingReadChunkCountsIntoPipelineDepth) {
+    constexpr size_t numOfChunkCopies = 4;
+    constexpr size_t totalCopySize = stagingBufferSize * numOfChunkCopies;
+    debugManager.flags.StagingBufferPipelineDepth.set(1);
+
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto mockStagingBufferManager = new MockStagingBufferManager(svmAllocsManager.get(), rootDeviceIndices, deviceBitfields);
+    stagingBufferManager.reset(mockStagingBufferManager);
+
+    auto usmBuffer = allocateDeviceBuffer(totalCopySize);
+    auto nonUsmBuffer = new unsigned char[totalCopySize];
+    memset(usmBuffer, 0xFF, totalCopySize);
+    memset(nonUsmBuffer, 0, totalCopySize);
+
+    ChunkCopyFunction chunkRead = [&](void *chunkDst, void *stagingBuffer, const void *chunkSrc, size_t chunkSize) {
+        memcpy(stagingBuffer, chunkSrc, chunkSize);
+        reinterpret_cast<MockCommandStreamReceiver *>(csr)->taskCount++;
+        return 0;
+    };
+    auto initialNumOfUsmAllocations = svmAllocsManager->svmAllocs.getNumAllocs();
+    auto ret = stagingBufferManager->performReadCopy(nonUsmBuffer, usmBuffer, totalCopySize, chunkRead, csr);
+    auto newUsmAllocations = svmAllocsManager->svmAllocs.getNumAllocs() - initialNumOfUsmAllocations;
+
+    EXPECT_EQ(0, ret.chunkCopyStatus);
+    EXPECT_EQ(WaitStatus::ready, ret.waitStatus);
+    EXPECT_EQ(0, memcmp(usmBuffer, nonUsmBuffer, totalCopySize));
+    EXPECT_EQ(1u, newUsmAllocations);
+    EXPECT_EQ(numOfChunkCopies, mockStagingBufferManager->waitForChunkCalled);
+    svmAllocsManager->freeSVMAlloc(usmBuffer);
+    delete[] nonUsmBuffer;
+}
+
+TEST_F(StagingBufferManagerTest, givenStagingBufferWhenPerformReadCopyThenCopyDataAndReuseBuffers) {
+    constexpr size_t numOfChunkCopies = 8;
+    constexpr size_t remainder = 1024;
+    constexpr size_t totalCopySize = stagingBufferSize * numOfChunkCopies + remainder;
+    auto usmBuffer = allocateDeviceBuffer(totalCopySize);
+    auto nonUsmBuffer = new unsigned char[totalCopySize];
+
+    size_t chunkCounter = 0;
+    memset(usmBuffer, 0xFF, totalCopySize);
+    memset(nonUsmBuffer, 0, totalCopySize);
+
+    ChunkCopyFunction chunkRead = [&](void *chunkDst, void *stagingBuffer, const void *chunkSrc, size_t chunkSize) {
+        chunkCounter++;
+        EXPECT_NE(0, memcmp(chunkDst, chunkSrc, chunkSize));
+        memcpy(stagingBuffer, chunkSrc, chunkSize);
+        reinterpret_cast<MockCommandStreamReceiver *>(csr)->taskCount++;
+        return 0;
+    };
+    auto initialNumOfUsmAllocations = svmAllocsManager->svmAllocs.getNumAllocs();
+    auto ret = stagingBufferManager->performReadCopy(nonUsmBuffer, usmBuffer, totalCopySize, chunkRead, csr);
+    auto newUsmAllocations = svmAllocsManager->svmAllocs.getNumAllocs() - initialNumOfUsmAllocations;
+
+    EXPECT_EQ(0, ret.chunkCopyStatus);
+    EXPECT_EQ(WaitStatus::ready, ret.waitStatus);
+    EXPECT_EQ(0, memcmp(usmBuffer, nonUsmBuffer, totalCopySize));
+    EXPECT_EQ(numOfChunkCopies + 1, chunkCounter);
+    EXPECT_EQ(2u, newUsmAllocations);
+    svmAllocsManager->freeSVMAlloc(usmBuffer);
+    delete[] nonUsmBuffer;
+}
+
+TEST_F(StagingBufferManagerTest, givenStagingBufferWhenFailedChunkReadThenEarlyReturnWithFailure) {
+    constexpr size_t numOfChunkCopies = 8;
+    constexpr size_t totalCopySize = stagingBufferSize * numOfChunkCopies;
+    constexpr int expectedErrorCode = 1;
+    auto usmBuffer = allocateDeviceBuffer(totalCopySize);
+    auto nonUsmBuffer = new unsigned char[totalCopySize];
+
+    size_t chunkCounter = 0;
+    memset(usmBuffer, 0xFF, totalCopySize);
+    memset(nonUsmBuffer, 0, totalCopySize);
+
+    ChunkCopyFunction chunkRead = [&](void *chunkDst, void *stagingBuffer, const void *chunkSrc, size_t chunkSize) {
+        chunkCounter++;
+        memcpy(stagingBuffer, chunkSrc, chunkSize);
+        reinterpret_cast<MockCommandStreamReceiver *>(csr)->taskCount++;
+        return chunkCounter == 2 ? expectedErrorCode : 0;
+    };
+    auto ret = stagingBufferManager->performReadCopy(nonUsmBuffer, usmBuffer, totalCopySize, chunkRead, csr);
+
+    EXPECT_EQ(expectedErrorCode, ret.chunkCopyStatus);
+    EXPECT_EQ(2u, chunkCounter);
+    EXPECT_NE(0, memcmp(usmBuffer, nonUsmBuffer, totalCopySize));
+    svmAllocsManager->freeSVMAlloc(usmBuffer);
+    delete[] nonUsmBuffer;
+}
+
+TEST_F(StagingBufferManagerTest, givenGpuHangWhenPerformReadCopyThenReturnGpuHangAndDontCopyData) {
+    constexpr size_t numOfChunkCopies = 4;
+    constexpr size_t totalCopySize = stagingBufferSize * numOfChunkCopies;
+
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto mockStagingBufferManager = new MockStagingBufferManager(svmAllocsManager.get(), rootDeviceIndices, deviceBitfields);
+    mockStagingBufferManager->waitStatusToReturn = WaitStatus::gpuHang;
+    stagingBufferManager.reset(mockStagingBufferManager);
+
+    auto usmBuffer = allocateDeviceBuffer(totalCopySize);
+    auto nonUsmBuffer = new unsigned char[totalCopySize];
+    memset(usmBuffer, 0xFF, totalCopySize);
+    memset(nonUsmBuffer, 0, totalCopySize);
+
+    size_t chunkCounter = 0;
+    ChunkCopyFunction chunkRead = [&](void *chunkDst, void *stagingBuffer, const void *chunkSrc, size_t chunkSize) {
+        chunkCounter++;
+        memcpy(stagingBuffer, chunkSrc, chunkSize);
+        reinterpret_cast<MockCommandStreamReceiver *>(csr)->taskCount++;
+        return 0;
+    };
+    auto ret = stagingBufferManager->performReadCopy(nonUsmBuffer, usmBuffer, totalCopySize, chunkRead, csr);
+
+    EXPECT_EQ(0, ret.chunkCopyStatus);
+    EXPECT_EQ(WaitStatus::gpuHang, ret.waitStatus);
+    EXPECT_EQ(2u, chunkCounter);
+    EXPECT_EQ(1u, mockStagingBufferManager->waitForChunkCalled);
+    EXPECT_NE(0, memcmp(usmBuffer, nonUsmBuffer, stagingBufferSize));
+    svmAllocsManager->freeSVMAlloc(usmBuffer);
+    delete[] nonUsmBuffer;
+}
+
+TEST_F(StagingBufferManagerTest, givenStagingReadEnabledWhenValidForStagingReadThenReturnTrueOnlyForDeviceUsmToHostCopy) {
+    constexpr size_t bufferSize = 1024;
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, 0u, rootDeviceIndices, deviceBitfields);
+    auto hostUsmBuffer = svmAllocsManager->createHostUnifiedMemoryAllocation(bufferSize, unifiedMemoryProperties);
+    auto deviceUsmBuffer = allocateDeviceBuffer(bufferSize);
+    unsigned char nonUsmBuffer[bufferSize];
+
+    EXPECT_FALSE(stagingBufferManager->isValidForStagingRead(nonUsmBuffer, deviceUsmBuffer, false));
+
+    debugManager.flags.EnableReadWithStagingBuffers.set(1);
+    EXPECT_TRUE(stagingBufferManager->isValidForStagingRead(nonUsmBuffer, deviceUsmBuffer, false));
+    EXPECT_FALSE(stagingBufferManager->isValidForStagingRead(nonUsmBuffer, deviceUsmBuffer, true));
+    EXPECT_FALSE(stagingBufferManager->isValidForStagingRead(nonUsmBuffer, hostUsmBuffer, false));
+    EXPECT_FALSE(stagingBufferManager->isValidForStagingRead(deviceUsmBuffer, nonUsmBuffer, false));
+    EXPECT_FALSE(stagingBufferManager->isValidForStagingRead(hostUsmBuffer, deviceUsmBuffer, false));
+
+    svmAllocsManager->freeSVMAlloc(deviceUsmBuffer);
+    svmAllocsManager->freeSVMAlloc(hostUsmBuffer);
+}
@@ -86,6 +86,7 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::gfxAllocations;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
+    using BaseClass::returnedTags;
     using BaseClass::returnTagToDeferredPool;
     using BaseClass::rootDeviceIndices;
     using BaseClass::TagAllocator;
@@ -464,6 +465,87 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool wasnt allocated
 }
 
+TEST_F(TagAllocatorTest, givenNodeCacheEnabledWhenReturningTagThenItIsLinkedToReturnedTagsAndNotTrackedAsUsed) {
+    debugManager.flags.EnableTagAllocatorNodeCache.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield);
+
+    auto node = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+    EXPECT_TRUE(tagAllocator.usedTags.peekIsEmpty());
+
+    tagAllocator.returnTag(node);
+
+    EXPECT_EQ(node, tagAllocator.returnedTags.load());
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*node));
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+}
+
+TEST_F(TagAllocatorTest, givenNodeCacheEnabledAndEmptyFreeListWhenAskingForNewTagThenReturnedTagsAreMovedToFreeListInBulk) {
+    debugManager.flags.EnableTagAllocatorNodeCache.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 3, 1, deviceBitfield);
+
+    TagNode<TimeStamps> *nodes[3] = {};
+    for (auto &node : nodes) {
+        node = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+    }
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+
+    for (auto &node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(nullptr, tagAllocator.returnedTags.load());
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(3u, tagAllocator.getTotalTagCount());
+
+    bool nodeFromPool = (node == nodes[0] || node == nodes[1] || node == nodes[2]);
+    EXPECT_TRUE(nodeFromPool);
+
+    auto freeNodesCount = 0u;
+    for (auto &cachedNode : nodes) {
+        if (tagAllocator.freeTags.peekContains(*cachedNode)) {
+            freeNodesCount++;
+        }
+    }
+    EXPECT_EQ(2u, freeNodesCount);
+}
+
+TEST_F(TagAllocatorTest, givenNodeCacheEnabledWhenTagWhichCannotBeReleasedIsReturnedThenItIsDeferred) {
+    debugManager.flags.EnableTagAllocatorNodeCache.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, deviceBitfield);
+
+    auto node = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+    node->setDoNotReleaseNodes(true);
+    tagAllocator.returnTag(node);
+
+    EXPECT_EQ(nullptr, tagAllocator.returnedTags.load());
+    EXPECT_TRUE(tagAllocator.deferredTags.peekContains(*node));
+}
+
+TEST_F(TagAllocatorTest, givenTagAllocatorWhenPreallocatingTagsThenPoolIsGrownOnlyWhenNeeded) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1, deviceBitfield);
+    EXPECT_EQ(4u, tagAllocator.getTotalTagCount());
+
+    tagAllocator.preallocateTags(3);
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.preallocateTags(9);
+    EXPECT_EQ(3u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(3u, tagAllocator.getTagPoolCount());
+    EXPECT_EQ(12u, tagAllocator.getTotalTagCount());
+
+    std::vector<TagNodeBase *> nodes;
+    for (auto i = 0u; i < 12u; i++) {
+        nodes.push_back(tagAllocator.getTag());
+    }
+    EXPECT_EQ(3u, tagAllocator.getGraphicsAllocationsCount());
+
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     MockTagAllocator<TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>> timestampPacketAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>), false, mockDeviceBitfield);
     MockTagAllocator<HwTimeStamps> hwTimeStampsAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(HwTimeStamps), false, mockDeviceBitfield);
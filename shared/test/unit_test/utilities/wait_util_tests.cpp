@@ -16,6 +16,8 @@ using namespace NEO;
 
 namespace CpuIntrinsicsTests {
 extern std::atomic<uint32_t> pauseCounter;
+extern std::atomic<uint32_t> umwaitCounter;
+extern std::atomic<uint64_t> lastUmwaitCounter;
 } // namespace CpuIntrinsicsTests
 
 struct WaitPredicateOnlyFixture {
@@ -98,3 +100,102 @@ TEST_F(WaitPredicateOnlyTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsC
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+TEST(AdaptiveWaitPolicyTest, givenNoCompletionsRecordedWhenGettingThresholdsThenMinimalThresholdsAreUsed) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+
+    EXPECT_EQ(0, waitPolicy.getAverageCompletionTime());
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::minSpinTimeNs, waitPolicy.getSpinThreshold());
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::minSpinTimeNs, waitPolicy.getMonitorWaitThreshold());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenRecordedCompletionsWhenGettingThresholdsThenThresholdsFollowAverageCompletionTime) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+
+    waitPolicy.recordCompletion(10'000);
+    EXPECT_EQ(10'000, waitPolicy.getAverageCompletionTime());
+    EXPECT_EQ(20'000, waitPolicy.getSpinThreshold());
+    EXPECT_EQ(80'000, waitPolicy.getMonitorWaitThreshold());
+
+    waitPolicy.recordCompletion(18'000);
+    EXPECT_EQ(11'000, waitPolicy.getAverageCompletionTime());
+
+    for (uint32_t i = 0; i < 256; i++) {
+        waitPolicy.recordCompletion(100'000'000);
+    }
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::maxSpinTimeNs, waitPolicy.getSpinThreshold());
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::maxMonitorWaitTimeNs, waitPolicy.getMonitorWaitThreshold());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenWaitTimeWhenGettingPhaseThenSpinIsFollowedByMonitorWaitAndYield) {
+    VariableBackup<bool> backupWaitpkgUse(&WaitUtils::waitpkgUse, true);
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    waitPolicy.recordCompletion(10'000);
+
+    EXPECT_EQ(WaitUtils::WaitPhase::spin, waitPolicy.getPhase(0));
+    EXPECT_EQ(WaitUtils::WaitPhase::spin, waitPolicy.getPhase(19'999));
+    EXPECT_EQ(WaitUtils::WaitPhase::monitorWait, waitPolicy.getPhase(20'000));
+    EXPECT_EQ(WaitUtils::WaitPhase::monitorWait, waitPolicy.getPhase(79'999));
+    EXPECT_EQ(WaitUtils::WaitPhase::yield, waitPolicy.getPhase(80'000));
+
+    WaitUtils::waitpkgUse = false;
+    EXPECT_EQ(WaitUtils::WaitPhase::spin, waitPolicy.getPhase(19'999));
+    EXPECT_EQ(WaitUtils::WaitPhase::yield, waitPolicy.getPhase(20'000));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenWaitTimeWhenGettingMonitorWaitCounterModifierThenItGrowsUpToLimit) {
+    VariableBackup<uint64_t> backupWaitpkgCounterValue(&WaitUtils::waitpkgCounterValue, 1000u);
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    waitPolicy.recordCompletion(10'000);
+
+    EXPECT_EQ(1000u, waitPolicy.getMonitorWaitCounterModifier(20'000));
+    EXPECT_EQ(3000u, waitPolicy.getMonitorWaitCounterModifier(60'000));
+    EXPECT_EQ(1000u * WaitUtils::AdaptiveWaitPolicy::maxMonitorWaitCounterScale, waitPolicy.getMonitorWaitCounterModifier(10'000'000));
+}
+
+TEST_F(WaitPredicateOnlyTest, givenSpinPhaseWhenWaitingWithPolicyThenOnlyPauseIsUsed) {
+    WaitUtils::init();
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+
+    volatile TagAddressType pollValue = 1u;
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+
+    EXPECT_FALSE(WaitUtils::waitFunctionWithPolicy(&pollValue, 3u, waitPolicy, 0));
+    EXPECT_EQ(oldPauseCount + WaitUtils::adaptiveSpinPauseCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmwaitCount, CpuIntrinsicsTests::umwaitCounter);
+
+    pollValue = 3u;
+    EXPECT_TRUE(WaitUtils::waitFunctionWithPolicy(&pollValue, 3u, waitPolicy, 0));
+}
+
+TEST_F(WaitPredicateOnlyTest, givenMonitorWaitPhaseWhenWaitingWithPolicyThenUmwaitIsUsedWithScaledCounter) {
+    WaitUtils::init();
+    VariableBackup<bool> backupWaitpkgUse(&WaitUtils::waitpkgUse, true);
+    VariableBackup<uint64_t> backupWaitpkgCounterValue(&WaitUtils::waitpkgCounterValue, 1000u);
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    waitPolicy.recordCompletion(10'000);
+
+    volatile TagAddressType pollValue = 1u;
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+
+    EXPECT_FALSE(WaitUtils::waitFunctionWithPolicy(&pollValue, 3u, waitPolicy, 40'000));
+    EXPECT_EQ(oldPauseCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmwaitCount + 1, CpuIntrinsicsTests::umwaitCounter);
+
+    pollValue = 3u;
+    EXPECT_TRUE(WaitUtils::waitFunctionWithPolicy(&pollValue, 3u, waitPolicy, 40'000));
+    EXPECT_EQ(oldUmwaitCount + 1, CpuIntrinsicsTests::umwaitCounter);
+}
+
+TEST_F(WaitPredicateOnlyTest, givenYieldPhaseWhenWaitingWithPolicyThenDefaultWaitFunctionIsUsed) {
+    WaitUtils::init();
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+
+    volatile TagAddressType pollValue = 1u;
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+
+    EXPECT_FALSE(WaitUtils::waitFunctionWithPolicy(&pollValue, 3u, waitPolicy, WaitUtils::AdaptiveWaitPolicy::maxMonitorWaitTimeNs));
+    EXPECT_EQ(oldPauseCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+}